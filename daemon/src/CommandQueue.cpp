@@ -48,30 +48,44 @@
 #include "Event.h"
 #include "Kernel.h"
 #include "Memory.h"
+#include "StagingPool.h"
 
 #include "command/Command.h"
-#include "command/CopyDataCommand.h"
 #include "command/SetCompleteCommand.h"
 
+#include <dclasio/message/CommandMessage.h>
+
+#include <dcl/DataTransfer.h>
+#include <dcl/DCLException.h>
 #include <dcl/DCLTypes.h>
 #include <dcl/Event.h>
+#include <dcl/Host.h>
 #include <dcl/Kernel.h>
 #include <dcl/Memory.h>
+#include <dcl/Process.h>
 
 #include <dcl/util/Logger.h>
 
 #define __CL_ENABLE_EXCEPTIONS
 #ifdef __APPLE__
 #include <OpenCL/cl.hpp>
+#include <OpenCL/cl_wwu_dcl.h>
 #else
 #include <CL/cl.hpp>
+#include <CL/cl_wwu_dcl.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstring>
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <ostream>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -124,6 +138,547 @@ void logEventProfilingInfo(cl_event object_, cl_int execution_status, void *user
 }
 #endif
 
+/*!
+ * \brief Relays a buffer range from a parent to the children of a compute node in a broadcast.
+ *
+ * The buffer range is received from the parent (if any) into mapped memory,
+ * and then sent to all children concurrently. The relay's user event is
+ * completed when all data transfers are complete.
+ * Failures are reported by the relay's user event. The data is received and
+ * forwarded in any case, such that the data streams of the parent and the
+ * children stay in sync (see Pipeline).
+ */
+class Relay : public std::enable_shared_from_this<Relay> {
+public:
+    Relay(
+            dcl::Process *                      parent,
+            const std::vector<dcl::Process *>&  children,
+            size_t                              size,
+            void *                              ptr,
+            const cl::UserEvent&                event) :
+        _parent(parent), _children(children), _size(size), _ptr(ptr),
+        _event(event), _pending(children.size()), _status(CL_COMPLETE) { }
+
+    /*!
+     * \brief Starts the relay, when mapping the buffer range has completed or failed
+     */
+    void start(cl_int execution_status) {
+        if (execution_status != CL_COMPLETE) {
+            /* The buffer range could not be mapped. The data is received into
+             * a scratch buffer nevertheless and forwarded to the children. */
+            dcl::util::Logger << dcl::util::Error
+                    << "Failed to map buffer for relay (status=" << execution_status
+                    << ')' << std::endl;
+            _status = execution_status;
+            try {
+                _scratch.reset(new char[_size]());
+            } catch (const std::bad_alloc&) {
+                _event.setStatus(CL_OUT_OF_HOST_MEMORY);
+                return;
+            }
+        }
+
+        if (_parent) {
+            try {
+                auto self = shared_from_this();
+                auto recv = _parent->receiveData(_size, data());
+                recv->setCallback([self](cl_int status) { self->forward(status); });
+            } catch (const dcl::IOException& e) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Data receipt failed: " << e.what() << std::endl;
+                forward(CL_IO_ERROR_WWU);
+            }
+        } else {
+            forward(CL_SUCCESS);
+        }
+    }
+
+private:
+    void * data() const {
+        if (_scratch) return _scratch.get(); // data is discarded
+        return _ptr;
+    }
+
+    void forward(cl_int status) {
+        /* The data is forwarded even after its receipt failed, as the
+         * children await it */
+        if (status != CL_SUCCESS) _status = status;
+        if (_children.empty()) {
+            _event.setStatus(_status);
+            return;
+        }
+
+        auto self = shared_from_this();
+        for (auto child : _children) {
+            try {
+                auto send = child->sendData(_size, data());
+                send->setCallback([self](cl_int status) { self->sent(status); });
+            } catch (const dcl::IOException& e) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Data sending failed: " << e.what() << std::endl;
+                sent(CL_IO_ERROR_WWU);
+            }
+        }
+    }
+
+    void sent(cl_int status) {
+        if (status != CL_SUCCESS) _status = status;
+        if (--_pending == 0) _event.setStatus(_status);
+    }
+
+    dcl::Process *_parent;
+    std::vector<dcl::Process *> _children;
+    size_t _size;
+    void *_ptr;
+    std::unique_ptr<char[]> _scratch; //!< Buffer for discarding data, if the buffer range could not be mapped
+    cl::UserEvent _event;
+    std::atomic<size_t> _pending; //!< Number of pending data transfers to children
+    std::atomic<cl_int> _status; //!< Completion status of the relay
+};
+
+/*!
+ * \brief Callback used to start a relay.
+ */
+void executeRelay(cl_event event, cl_int execution_status, void *user_data) {
+    std::unique_ptr<std::shared_ptr<Relay>> relay(static_cast<std::shared_ptr<Relay> *>(user_data));
+    assert(relay != nullptr);
+    (*relay)->start(execution_status);
+}
+
+/*!
+ * \brief Forwards a buffer range chunk by chunk along a chain of compute nodes in a multicast upload.
+ *
+ * The chunks are received from the predecessor (or the host) into mapped
+ * memory. Each chunk is sent to the successor as soon as it and all preceding
+ * chunks have been received, such that the successor receives the chunks in
+ * order. The forward event is completed when all chunks have been received and
+ * forwarded.
+ * When the data has been written locally, the successor's acknowledgement is
+ * awaited, and the completion status of the chain is sent to the predecessor.
+ * The complete event is completed afterwards.
+ * Failures are only reported by the acknowledgements. All chunks are received
+ * and forwarded in any case, such that the data streams of all processes of
+ * the chain stay in sync, and every compute node and the host obtain a final
+ * status.
+ */
+class Pipeline : public std::enable_shared_from_this<Pipeline> {
+public:
+    Pipeline(
+            dcl::Host&              host,
+            dcl::object_id          commandId,
+            dcl::Process *          predecessor,
+            dcl::Process *          successor,
+            size_t                  size,
+            size_t                  chunkSize,
+            void *                  ptr,
+            const cl::UserEvent&    forwarded,
+            const cl::UserEvent&    complete) :
+        _host(host), _commandId(commandId), _predecessor(predecessor),
+        _successor(successor), _size(size), _chunkSize(chunkSize), _ptr(ptr),
+        _forwarded(forwarded), _complete(complete),
+        _chunks((size + chunkSize - 1) / chunkSize), _next(0),
+        _pending(_chunks * (successor ? 2 : 1)), _status(CL_COMPLETE),
+        _ack(CL_COMPLETE) { }
+
+    /*!
+     * \brief Starts receiving chunks, when mapping the buffer range has completed or failed
+     */
+    void start(cl_int execution_status) {
+        _received.assign(_chunks, false);
+
+        if (execution_status != CL_COMPLETE) {
+            /* The buffer range could not be mapped. The chunks are received
+             * into a scratch buffer nevertheless and forwarded to the
+             * successor. As their data is discarded, a single chunk is
+             * sufficient for all chunks. */
+            dcl::util::Logger << dcl::util::Error
+                    << "Failed to map buffer for multicast upload (ID=" << _commandId
+                    << ", status=" << execution_status << ')' << std::endl;
+            _status = execution_status;
+            try {
+                _scratch.reset(new char[chunkLength(0)]);
+            } catch (const std::bad_alloc&) {
+                _forwarded.setStatus(CL_OUT_OF_HOST_MEMORY);
+                return;
+            }
+        }
+
+        if (!_predecessor) {
+            /* Start data transfer on host */
+            try {
+                dclasio::message::CommandExecutionStatusChangedMessage message(_commandId, CL_SUBMITTED);
+                _host.sendMessage(message);
+            } catch (const dcl::IOException& e) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Failed to send update of command execution status to host (ID=" << _commandId
+                        << ", status=CL_SUBMITTED), error: " << e.what() << std::endl;
+                failed(CL_IO_ERROR_WWU);
+                return;
+            }
+        }
+
+        dcl::Process& source = _predecessor ? *_predecessor : _host;
+        auto self = shared_from_this();
+        for (size_t chunk = 0; chunk < _chunks; ++chunk) {
+            try {
+                auto recv = source.receiveData(chunkLength(chunk), chunkPointer(chunk));
+                recv->setCallback([self, chunk](cl_int status) { self->received(chunk, status); });
+            } catch (const dcl::IOException& e) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Data receipt failed: " << e.what() << std::endl;
+                received(chunk, CL_IO_ERROR_WWU);
+            }
+        }
+    }
+
+    /*!
+     * \brief Completes the chain, when the data has been written locally
+     */
+    void finish(cl_int execution_status) {
+        if (_successor) {
+            try {
+                auto self = shared_from_this();
+                auto recv = _successor->receiveData(sizeof(_ack), &_ack);
+                recv->setCallback([self, execution_status](cl_int status) {
+                    self->acknowledge(execution_status, status);
+                });
+            } catch (const dcl::IOException& e) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Data receipt failed: " << e.what() << std::endl;
+                acknowledge(execution_status, CL_IO_ERROR_WWU);
+            }
+        } else {
+            acknowledge(execution_status, CL_SUCCESS);
+        }
+    }
+
+private:
+    size_t chunkLength(size_t chunk) const {
+        return std::min(_chunkSize, _size - chunk * _chunkSize);
+    }
+
+    void * chunkPointer(size_t chunk) const {
+        if (_scratch) return _scratch.get(); // data is discarded
+        return static_cast<char *>(_ptr) + chunk * _chunkSize;
+    }
+
+    void received(size_t chunk, cl_int status) {
+        if (status != CL_SUCCESS) _status = status;
+
+        if (_successor) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _received[chunk] = true;
+            /* Forward all chunks which have been received in order */
+            for (; _next < _chunks && _received[_next]; ++_next) {
+                forward(_next);
+            }
+        }
+
+        transferred(status);
+    }
+
+    /*!
+     * \brief Fails all chunks without receiving them
+     *
+     * The chunks are still forwarded to the successor, as it awaits them. As
+     * their data is invalid, the failure is reported by the acknowledgements.
+     */
+    void failed(cl_int status) {
+        for (size_t chunk = 0; chunk < _chunks; ++chunk) {
+            received(chunk, status);
+        }
+    }
+
+    void forward(size_t chunk) {
+        /* Chunks are forwarded even after a data transfer failed, such that
+         * the successor's data stream stays in sync */
+        try {
+            auto self = shared_from_this();
+            auto send = _successor->sendData(chunkLength(chunk), chunkPointer(chunk));
+            send->setCallback([self](cl_int status) { self->transferred(status); });
+        } catch (const dcl::IOException& e) {
+            dcl::util::Logger << dcl::util::Error
+                    << "Data sending failed: " << e.what() << std::endl;
+            transferred(CL_IO_ERROR_WWU);
+        }
+    }
+
+    void transferred(cl_int status) {
+        if (status != CL_SUCCESS) _status = status;
+        if (--_pending == 0) _forwarded.setStatus(_status);
+    }
+
+    void acknowledge(cl_int execution_status, cl_int status) {
+        /* Report the first failure along the chain */
+        if (execution_status < 0) {
+            status = execution_status;
+        } else if (status == CL_SUCCESS) {
+            status = _ack;
+        }
+
+        if (_predecessor) {
+            try {
+                auto ack = std::make_shared<cl_int>(status);
+                /* The callback keeps the acknowledgement alive until it has been sent */
+                _predecessor->sendData(sizeof(*ack), ack.get())->setCallback(
+                        [ack](cl_int) { });
+            } catch (const dcl::IOException& e) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Data sending failed: " << e.what() << std::endl;
+                status = CL_IO_ERROR_WWU;
+            }
+        }
+
+        _complete.setStatus(status);
+    }
+
+    dcl::Host& _host;
+    dcl::object_id _commandId;
+    dcl::Process *_predecessor; //!< Process from which chunks are received, or \c NULL if received from the host
+    dcl::Process *_successor; //!< Process to which chunks are forwarded, or \c NULL
+    size_t _size;
+    size_t _chunkSize;
+    void *_ptr;
+    std::unique_ptr<char[]> _scratch; //!< Chunk for discarding data, if the buffer range could not be mapped
+    cl::UserEvent _forwarded;
+    cl::UserEvent _complete;
+    size_t _chunks; //!< Number of chunks
+    std::vector<bool> _received; //!< Received chunks
+    size_t _next; //!< Next chunk to forward
+    std::mutex _mutex; //!< Protects received chunks and next chunk to forward
+    std::atomic<size_t> _pending; //!< Number of pending data transfers
+    std::atomic<cl_int> _status; //!< Completion status of the data transfers
+    cl_int _ack; //!< Completion status of the successors
+};
+
+/*!
+ * \brief Callback used to start a pipeline.
+ */
+void executePipeline(cl_event event, cl_int execution_status, void *user_data) {
+    std::unique_ptr<std::shared_ptr<Pipeline>> pipeline(static_cast<std::shared_ptr<Pipeline> *>(user_data));
+    assert(pipeline != nullptr);
+    (*pipeline)->start(execution_status);
+}
+
+/*!
+ * \brief Callback used to finish a pipeline.
+ */
+void finishPipeline(cl_event event, cl_int execution_status, void *user_data) {
+    std::unique_ptr<std::shared_ptr<Pipeline>> pipeline(static_cast<std::shared_ptr<Pipeline> *>(user_data));
+    assert(pipeline != nullptr);
+    (*pipeline)->finish(execution_status);
+}
+
+/*!
+ * \brief Sends a buffer range chunk by chunk from a staging buffer to the host.
+ *
+ * Each chunk is read from the device into the staging buffer separately. A
+ * chunk is sent as soon as it and all preceding chunks have been read, such
+ * that the host receives the chunks in order, while the following chunks are
+ * still read from the device. The staging buffer is retained until all chunks
+ * have been sent.
+ * All chunks are sent even after reading or sending a chunk failed, as the
+ * host awaits them. The chunks following a failure are filled with zeros. The
+ * completion status is sent after the last chunk, such that the host completes
+ * its command with it.
+ */
+class Download : public std::enable_shared_from_this<Download> {
+public:
+    Download(
+            dcl::Host&                                      host,
+            dcl::object_id                                  commandId,
+            const std::shared_ptr<dcld::StagingBuffer>&     staging,
+            size_t                                          size,
+            size_t                                          chunkSize) :
+        _host(host), _commandId(commandId), _staging(staging), _size(size),
+        _chunkSize(chunkSize), _read((size + chunkSize - 1) / chunkSize, false),
+        _next(0), _submitted(false), _status(CL_COMPLETE) { }
+
+    /*!
+     * \brief Sends all chunks which have been read in order, when a chunk has been read
+     */
+    void read(size_t chunk, cl_int execution_status) {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (execution_status != CL_COMPLETE) _status = execution_status;
+        _read[chunk] = true;
+        for (; _next < _read.size() && _read[_next]; ++_next) {
+            send(_next);
+        }
+    }
+
+private:
+    void send(size_t chunk) {
+        if (chunk == 0) {
+            /* Start data receipt on host */
+            try {
+                dclasio::message::CommandExecutionStatusChangedMessage message(_commandId, CL_SUBMITTED);
+                _host.sendMessage(message);
+                _submitted = true;
+            } catch (const dcl::IOException& e) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Failed to send update of command execution status to host (ID=" << _commandId
+                        << ", status=CL_SUBMITTED), error: " << e.what() << std::endl;
+                _status = CL_IO_ERROR_WWU;
+            }
+        }
+        if (!_submitted) {
+            /* The host does not receive any data */
+            return;
+        }
+
+        size_t length = std::min(_chunkSize, _size - chunk * _chunkSize);
+        char *ptr = _staging->ptr() + chunk * _chunkSize;
+        if (_status != CL_COMPLETE) {
+            /* Do not send invalid data after reading or sending failed */
+            std::memset(ptr, 0, length);
+        }
+
+        try {
+            /* The callback retains this download until the chunk has been sent */
+            auto self = shared_from_this();
+            _host.sendData(length, ptr)->setCallback(
+                            [self](cl_int status) {
+                if (status != CL_SUCCESS) {
+                    dcl::util::Logger << dcl::util::Error
+                            << "Data sending failed (command ID=" << self->_commandId
+                            << ')' << std::endl;
+                }
+            });
+        } catch (const dcl::IOException& e) {
+            dcl::util::Logger << dcl::util::Error
+                    << "Data sending failed: " << e.what() << std::endl;
+            _status = CL_IO_ERROR_WWU;
+        }
+
+        if (chunk + 1 == _read.size()) {
+            /* Send completion status after the last chunk */
+            try {
+                auto status = std::make_shared<cl_int>(_status);
+                /* The callback keeps the status alive until it has been sent */
+                _host.sendData(sizeof(*status), status.get())->setCallback(
+                        [status](cl_int) { });
+            } catch (const dcl::IOException& e) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Data sending failed: " << e.what() << std::endl;
+            }
+        }
+    }
+
+    dcl::Host& _host;
+    dcl::object_id _commandId;
+    std::shared_ptr<dcld::StagingBuffer> _staging;
+    size_t _size;
+    size_t _chunkSize;
+    std::vector<bool> _read; //!< Chunks read from the device
+    size_t _next; //!< Next chunk to send
+    bool _submitted; //!< \c true, if the host has been requested to receive the chunks
+    cl_int _status; //!< Completion status of reading and sending
+    std::mutex _mutex; //!< Protects read chunks, next chunk to send, and status
+};
+
+/*!
+ * \brief Callback used to send a chunk of a download, when it has been read.
+ */
+void executeDownload(cl_event event, cl_int execution_status, void *user_data) {
+    std::unique_ptr<std::pair<std::shared_ptr<Download>, size_t>> chunk(
+            static_cast<std::pair<std::shared_ptr<Download>, size_t> *>(user_data));
+    assert(chunk != nullptr);
+    chunk->first->read(chunk->second, execution_status);
+}
+
+/*!
+ * \brief Receives a buffer range chunk by chunk from the host into a staging buffer.
+ *
+ * The receipt of all chunks is started at once, as the host's data is matched
+ * in the order of data receipts. The copy event of a chunk is completed as soon
+ * as the chunk has been received, such that it is written to the device while
+ * the following chunks are still received.
+ */
+void receiveChunks(
+        dcl::Host& host,
+        dcl::object_id commandId,
+        const std::shared_ptr<dcld::StagingBuffer>& staging,
+        size_t size,
+        size_t chunkSize,
+        std::vector<cl::UserEvent>& copyData) {
+    /* Start data transfer on host */
+    try {
+        dclasio::message::CommandExecutionStatusChangedMessage message(commandId, CL_SUBMITTED);
+        host.sendMessage(message);
+    } catch (const dcl::IOException& e) {
+        dcl::util::Logger << dcl::util::Error
+                << "Failed to send update of command execution status to host (ID=" << commandId
+                << ", status=CL_SUBMITTED), error: " << e.what() << std::endl;
+        for (auto& event : copyData) event.setStatus(CL_IO_ERROR_WWU);
+        return;
+    }
+
+    for (size_t chunk = 0; chunk < copyData.size(); ++chunk) {
+        try {
+            /* The callback retains the staging buffer until the chunk has been received */
+            cl::UserEvent event = copyData[chunk];
+            host.receiveData(std::min(chunkSize, size - chunk * chunkSize),
+                    staging->ptr() + chunk * chunkSize)->setCallback(
+                            [event, staging](cl_int status) mutable { event.setStatus(status); });
+        } catch (const dcl::IOException& e) {
+            dcl::util::Logger << dcl::util::Error
+                    << "Data receipt failed: " << e.what() << std::endl;
+            copyData[chunk].setStatus(CL_IO_ERROR_WWU);
+        }
+    }
+}
+
+/*!
+ * \brief Native events which are joined into a single user event.
+ */
+struct JoinData {
+    std::atomic<size_t> pending;
+    std::atomic<cl_int> status;
+    cl::UserEvent event;
+};
+
+/*!
+ * \brief Callback used to complete a user event when all joined native events are complete.
+ */
+void executeJoin(cl_event event, cl_int execution_status, void *user_data) {
+    auto join = static_cast<JoinData *>(user_data);
+    assert(join != nullptr);
+    if (execution_status < 0) join->status = execution_status;
+    if (--join->pending == 0) {
+        join->event.setStatus(join->status);
+        delete join;
+    }
+}
+
+/*!
+ * \brief Joins a list of native events into a single user event.
+ *
+ * The user event is completed when all native events are complete, or
+ * terminated if any native event is terminated.
+ */
+cl::UserEvent joinEvents(const cl::Context& context, const VECTOR_CLASS<cl::Event>& events) {
+    cl::UserEvent joined(context);
+
+    if (events.empty()) {
+        joined.setStatus(CL_COMPLETE);
+        return joined;
+    }
+
+    auto join = new JoinData;
+    join->pending = events.size();
+    join->status  = CL_COMPLETE;
+    join->event   = joined;
+
+    /* WARNING: do not use join after this point, as the callbacks of the
+     *          native events delete it concurrently */
+    for (auto event : events) {
+        event.setCallback(CL_COMPLETE, &executeJoin, join);
+    }
+
+    return joined;
+}
+
 cl::NDRange createNDRange(const std::vector<size_t>& vector) {
     switch (vector.size()) {
     case 0:
@@ -242,28 +797,37 @@ void CommandQueue::enqueueReadBuffer(
         bool blocking,
         size_t offset,
         size_t size,
+        size_t chunkSize,
         const VECTOR_CLASS<cl::Event>& nativeEventWaitList,
         dcl::object_id commandId,
-        cl::Event& mapData, cl::Event& unmapData) {
-    cl::UserEvent copyData(*_context);
-
-    // enqueue map buffer (implicit download)
-    void *ptr = _commandQueue.enqueueMapBuffer(
-            *buffer,
-            CL_FALSE,    // non-blocking map
-            CL_MAP_READ, // map for reading
-            offset, size,
-            (nativeEventWaitList.empty() ? nullptr : &nativeEventWaitList),
-            &mapData);
+        cl::Event& startData, cl::Event& endData) {
+    auto staging = _context->stagingPool().allocate(size);
+    size_t chunks = (chunkSize && size > chunkSize) ? (size + chunkSize - 1) / chunkSize : 1;
+    VECTOR_CLASS<cl::Event> readData;
+
+    if (chunks == 1) chunkSize = size;
+
+    // enqueue read of each chunk into staging buffer
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        VECTOR_CLASS<cl::Event> readEventWaitList;
+        if (chunk > 0) {
+            readEventWaitList.assign(1, endData);
+        } else {
+            readEventWaitList = nativeEventWaitList;
+        }
+        _commandQueue.enqueueReadBuffer(
+                *buffer,
+                CL_FALSE, // non-blocking read
+                offset + chunk * chunkSize, std::min(chunkSize, size - chunk * chunkSize),
+                staging->ptr() + chunk * chunkSize,
+                (readEventWaitList.empty() ? nullptr : &readEventWaitList),
+                &endData);
+        readData.push_back(endData);
+    }
+    startData = readData.front();
 #ifdef PROFILE
-    mapData.setCallback(CL_COMPLETE, &logEventProfilingInfo, new std::string("map buffer for reading"));
+    endData.setCallback(CL_COMPLETE, &logEventProfilingInfo, new std::string("read buffer into staging buffer"));
 #endif
-    // enqueue unmap buffer
-    VECTOR_CLASS<cl::Event> unmapEventWaitList(1, copyData);
-    _commandQueue.enqueueUnmapMemObject(
-            *buffer,
-            ptr,
-            &unmapEventWaitList, &unmapData);
 #ifdef FORCE_FLUSH
     _commandQueue.flush();
 #else
@@ -273,10 +837,13 @@ void CommandQueue::enqueueReadBuffer(
 #endif
 
     try {
-        // schedule data transfer
-        mapData.setCallback(CL_COMPLETE, &executeCommand,
-                new command::CopyDataCommand<command::DeviceToHost>(
-                        _context->host(), commandId, size, ptr, copyData));
+        // schedule data sending
+        auto download = std::make_shared<Download>(
+                _context->host(), commandId, staging, size, chunkSize);
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            readData[chunk].setCallback(CL_COMPLETE, &executeDownload,
+                    new std::pair<std::shared_ptr<Download>, size_t>(download, chunk));
+        }
         /* The read buffer command is finished on the host, such that no
          * 'command complete' message must be sent by the compute node. */
     } catch (const std::bad_alloc&) {
@@ -289,40 +856,36 @@ void CommandQueue::enqueueWriteBuffer(
         bool blocking,
         size_t offset,
         size_t size,
+        size_t chunkSize,
         const VECTOR_CLASS<cl::Event>& nativeEventWaitList,
         dcl::object_id commandId,
-        cl::Event& mapData, cl::Event& unmapData) {
-    cl::UserEvent copyData(*_context);
-
-    // enqueue map buffer
-    /* !!! WARNING !!!
-     * NVIDIA only: the reference count of events in wait list is *not*
-     * increased by clEnqueueMapBuffer. This may be a bug, if the event is not
-     * retained by other means than its reference count.
-     * !!!!!!!!!!!!!!! */
-    void *ptr = _commandQueue.enqueueMapBuffer(
-            *buffer,
-            CL_FALSE,     // non-blocking map
-            CL_MAP_WRITE, // map for writing
-            offset, size,
-            (nativeEventWaitList.empty() ? nullptr : &nativeEventWaitList),
-            &mapData);
-    // enqueue unmap buffer (implicit upload)
-    VECTOR_CLASS<cl::Event> unmapEventWaitList(1, copyData);
-    /* !!! WARNING !!!
-     * NVIDIA only: the reference count of copyData is *not* increased by
-     * clEnqueueUnmapMemObject. This may be a bug, if the event is not retained
-     * by other means than its reference count.
-     * !!!!!!!!!!!!!!! */
-//    std::cout << "!!! before unmap copyData refCount=" << copyData.getInfo<CL_EVENT_REFERENCE_COUNT>() << std::endl;
-//    ::clRetainEvent(copyData()); // tentative fix for NVIDIA
-    _commandQueue.enqueueUnmapMemObject(
-            *buffer,
-            ptr,
-            &unmapEventWaitList, &unmapData);
-//    std::cout << "!!! after unmap copyData refCount=" << copyData.getInfo<CL_EVENT_REFERENCE_COUNT>() << std::endl;
+        cl::Event& startData, cl::Event& endData) {
+    auto staging = _context->stagingPool().allocate(size);
+    size_t chunks = (chunkSize && size > chunkSize) ? (size + chunkSize - 1) / chunkSize : 1;
+    std::vector<cl::UserEvent> copyData;
+
+    if (chunks == 1) chunkSize = size;
+
+    // enqueue write of each chunk from staging buffer, when it has been received
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        copyData.push_back(cl::UserEvent(*_context));
+        VECTOR_CLASS<cl::Event> writeEventWaitList(1, copyData.back());
+        if (chunk > 0) {
+            writeEventWaitList.push_back(endData);
+        } else {
+            writeEventWaitList.insert(std::end(writeEventWaitList),
+                    std::begin(nativeEventWaitList), std::end(nativeEventWaitList));
+        }
+        _commandQueue.enqueueWriteBuffer(
+                *buffer,
+                CL_FALSE, // non-blocking write
+                offset + chunk * chunkSize, std::min(chunkSize, size - chunk * chunkSize),
+                staging->ptr() + chunk * chunkSize,
+                &writeEventWaitList, &endData);
+        if (chunk == 0) startData = endData;
+    }
 #ifdef PROFILE
-    unmapData.setCallback(CL_COMPLETE, &logEventProfilingInfo, new std::string("unmap buffer after writing"));
+    endData.setCallback(CL_COMPLETE, &logEventProfilingInfo, new std::string("write buffer from staging buffer"));
 #endif
 #ifdef FORCE_FLUSH
     _commandQueue.flush();
@@ -333,21 +896,59 @@ void CommandQueue::enqueueWriteBuffer(
 #endif
 
     try {
-        // schedule data transfer
-        mapData.setCallback(CL_COMPLETE, &executeCommand,
-                new command::CopyDataCommand<command::HostToDevice>(
-                        _context->host(), commandId, size, ptr, copyData));
+        staging->retainUntil(endData);
+        /* Schedule data receipt
+         * Data is received into the staging buffer regardless of the event
+         * wait list. A 'command submitted' message is sent to the host. */
+        receiveChunks(_context->host(), commandId, staging, size, chunkSize, copyData);
         // schedule completion message for host
         /* A 'command complete' message is sent to the host.
          * Note that this message must also be sent, if no event is associated
          * with this command, such that a blocking write succeeds. */
-        unmapData.setCallback(CL_COMPLETE, &executeCommand,
+        endData.setCallback(CL_COMPLETE, &executeCommand,
                 new command::SetCompleteCommand(_context->host(), commandId, cl::UserEvent(*_context)));
     } catch (const std::bad_alloc&) {
         throw cl::Error(CL_OUT_OF_RESOURCES);
     }
 }
 
+cl::Event CommandQueue::enqueueRelay(
+        const cl::Buffer& buffer,
+        size_t offset,
+        size_t cb,
+        dcl::Process *source,
+        const std::vector<dcl::Process *>& destinations,
+        const VECTOR_CLASS<cl::Event>& nativeEventWaitList) {
+    cl::Event mapData, unmapData;
+    cl::UserEvent relayData(*_context);
+
+    /* Enqueue map buffer */
+    void *ptr = _commandQueue.enqueueMapBuffer(
+            buffer,
+            CL_FALSE, // non-blocking map
+            (source ? CL_MAP_WRITE : CL_MAP_READ),
+            offset, cb,
+            &nativeEventWaitList, &mapData);
+    /* Enqueue unmap buffer when data has been received and forwarded */
+    VECTOR_CLASS<cl::Event> unmapEventWaitList(1, relayData);
+    _commandQueue.enqueueUnmapMemObject(
+            buffer,
+            ptr,
+            &unmapEventWaitList, &unmapData);
+    _commandQueue.flush();
+
+    try {
+        /* Schedule data relay */
+        mapData.setCallback(CL_COMPLETE, &executeRelay,
+                new std::shared_ptr<Relay>(std::make_shared<Relay>(
+                        source, destinations, cb, ptr, relayData)));
+    } catch (const std::bad_alloc&) {
+        throw cl::Error(CL_OUT_OF_RESOURCES);
+    }
+
+    return unmapData;
+}
+
 void CommandQueue::enqueuePhonyMarker(
         bool blocking,
         const VECTOR_CLASS<cl::Event>& nativeEventWaitList,
@@ -431,93 +1032,334 @@ void CommandQueue::enqueueCopyBuffer(
 
     if (event) { // an event should be associated with this command
         try {
-            *event = std::make_shared<SimpleEvent>(commandId, _context, dstImpl, copyBuffer);
+            *event = std::make_shared<SimpleEvent>(commandId, _context,
+                    dstImpl, dstOffset, size, copyBuffer);
         } catch (const std::bad_alloc&) {
             throw cl::Error(CL_OUT_OF_RESOURCES);
         }
     }
 }
 
-void CommandQueue::enqueueReadBuffer(
-        const std::shared_ptr<dcl::Buffer>& buffer,
-        bool blockingRead,
-        size_t offset,
-        size_t size,
+void CommandQueue::enqueueBroadcastBuffer(
+        const std::shared_ptr<dcl::Buffer>& src,
+        const std::vector<std::shared_ptr<dcl::CommandQueue>>& commandQueues,
+        const std::vector<std::shared_ptr<dcl::Buffer>>& dsts,
+        size_t srcOffset,
+        const std::vector<size_t>& dstOffsets,
+        size_t cb,
+        dcl::Process *parent,
+        const std::vector<dcl::Process *>& children,
         const std::vector<std::shared_ptr<dcl::Event>> *eventWaitList,
         dcl::object_id commandId,
         std::shared_ptr<dcl::Event> *event) {
-    auto bufferImpl = std::dynamic_pointer_cast<Buffer>(buffer);
+    auto srcImpl = std::dynamic_pointer_cast<Buffer>(src);
+    std::vector<std::shared_ptr<Buffer>> dstImpls;
+    std::vector<cl::CommandQueue> nativeCommandQueues;
+    VECTOR_CLASS<cl::Event> nativeEventWaitList;
+    VECTOR_CLASS<cl::Event> broadcastEvents;
+
+    if (dsts.empty() || commandQueues.size() != dsts.size() ||
+            dstOffsets.size() != dsts.size()) {
+        throw cl::Error(CL_INVALID_VALUE);
+    }
+    /* The root holds the source buffer, while all other compute nodes
+     * receive the data from their parent */
+    if (!parent && !srcImpl) throw cl::Error(CL_INVALID_MEM_OBJECT);
+
+    for (size_t i = 0; i < dsts.size(); ++i) {
+        auto dstImpl = std::dynamic_pointer_cast<Buffer>(dsts[i]);
+        auto commandQueueImpl = std::dynamic_pointer_cast<CommandQueue>(commandQueues[i]);
+        if (!dstImpl) throw cl::Error(CL_INVALID_MEM_OBJECT);
+        if (!commandQueueImpl) throw cl::Error(CL_INVALID_COMMAND_QUEUE);
+        dstImpls.push_back(dstImpl);
+        nativeCommandQueues.push_back(*commandQueueImpl);
+    }
+
+    /* Obtain wait list of native events
+     * Only the root waits for the event wait list, as the other compute nodes
+     * receive the data when the root's wait list is complete. */
+    if (eventWaitList) {
+        synchronize(*eventWaitList, nativeEventWaitList);
+    }
+
+    /* The buffer range which is relayed to the children. On the root, this is
+     * the source range, otherwise the range of the first destination buffer. */
+    auto buffer = parent ? dstImpls.front() : srcImpl;
+    size_t offset = parent ? dstOffsets.front() : srcOffset;
+
+    if (parent || !children.empty()) {
+        cl::Event relayData = enqueueRelay(*buffer, offset, cb,
+                parent, children, nativeEventWaitList);
+
+        broadcastEvents.push_back(relayData);
+        if (parent) {
+            /* The first destination buffer has been written by the relay;
+             * the remaining destination buffers are copied from it */
+            nativeEventWaitList.assign(1, relayData);
+        }
+    }
+
+    /* Enqueue copies to (remaining) destination buffers */
+    for (size_t i = (parent ? 1 : 0); i < dstImpls.size(); ++i) {
+        cl::Event copyBuffer;
+
+        nativeCommandQueues[i].enqueueCopyBuffer(
+                *buffer, *dstImpls[i],
+                offset, dstOffsets[i], cb,
+                &nativeEventWaitList, &copyBuffer);
+        nativeCommandQueues[i].flush();
+
+        broadcastEvents.push_back(copyBuffer);
+    }
+
+    dcl::util::Logger << dcl::util::Debug
+            << "Enqueued broadcast of buffer range [" << offset << ", "
+            << offset + cb << ") to " << children.size() << " compute node(s)"
+            << std::endl;
+
+    if (event) { // an event should be associated with this command
+        try {
+            *event = std::make_shared<SimpleEvent>(commandId, _context,
+                    std::vector<std::shared_ptr<Memory>>(
+                            std::begin(dstImpls), std::end(dstImpls)),
+                    joinEvents(*_context, broadcastEvents));
+        } catch (const std::bad_alloc&) {
+            throw cl::Error(CL_OUT_OF_RESOURCES);
+        }
+    }
+}
+
+void CommandQueue::enqueueReduceBuffer(
+        const std::vector<std::shared_ptr<dcl::Buffer>>& srcs,
+        const std::shared_ptr<dcl::Buffer>& dst,
+        const std::shared_ptr<dcl::Kernel>& kernel,
+        const std::vector<size_t>& offset,
+        const std::vector<size_t>& global,
+        const std::vector<size_t>& local,
+        dcl::Process *parent,
+        const std::vector<dcl::Process *>& children,
+        const std::vector<std::shared_ptr<dcl::Event>> *eventWaitList,
+        dcl::object_id commandId,
+        std::shared_ptr<dcl::Event> *event) {
+    auto dstImpl = std::dynamic_pointer_cast<Buffer>(dst);
+    auto kernelImpl = std::dynamic_pointer_cast<Kernel>(kernel);
     VECTOR_CLASS<cl::Event> nativeEventWaitList;
+    cl::Event reduceBuffer;
+    bool initialized = false;
+
+    if (!dstImpl) throw cl::Error(CL_INVALID_MEM_OBJECT);
+    if (!kernelImpl) throw cl::Error(CL_INVALID_KERNEL);
+    if (srcs.empty() && children.empty()) throw cl::Error(CL_INVALID_VALUE);
+
+    size_t size = dstImpl->size();
+    cl::Kernel nativeKernel = *kernelImpl;
+
+    /* Obtain wait list of native events */
+    if (eventWaitList) {
+        synchronize(*eventWaitList, nativeEventWaitList);
+    }
+
+    /* The partial result is accumulated in the destination buffer on the
+     * root, and in a temporary buffer on all other compute nodes */
+    cl::Buffer result = parent ? cl::Buffer(*_context, CL_MEM_READ_WRITE, size) :
+            static_cast<cl::Buffer>(*dstImpl);
+
+    /* Commands are chained explicitly, as the command queue may execute
+     * commands out of order */
+    auto combine = [&](const cl::Buffer& operand) {
+        nativeKernel.setArg(0, result);
+        nativeKernel.setArg(1, operand);
+        _commandQueue.enqueueNDRangeKernel(
+                nativeKernel,
+                createNDRange(offset), createNDRange(global), createNDRange(local),
+                &nativeEventWaitList, &reduceBuffer);
+        nativeEventWaitList.assign(1, reduceBuffer);
+    };
+
+    /* Combine local source buffers */
+    for (const auto& src : srcs) {
+        auto srcImpl = std::dynamic_pointer_cast<Buffer>(src);
+        if (!srcImpl) throw cl::Error(CL_INVALID_MEM_OBJECT);
+        cl::Buffer operand = *srcImpl;
+
+        if (initialized) {
+            combine(operand);
+        } else {
+            if (operand() != result()) {
+                _commandQueue.enqueueCopyBuffer(operand, result, 0, 0, size,
+                        &nativeEventWaitList, &reduceBuffer);
+                nativeEventWaitList.assign(1, reduceBuffer);
+            }
+            initialized = true;
+        }
+    }
+
+    /* Combine partial results of children
+     * Partial results are received concurrently into temporary buffers */
+    for (auto child : children) {
+        if (initialized) {
+            cl::Buffer operand(*_context, CL_MEM_READ_WRITE, size);
+            nativeEventWaitList.push_back(enqueueRelay(operand, 0, size,
+                    child, std::vector<dcl::Process *>(), VECTOR_CLASS<cl::Event>()));
+            combine(operand);
+        } else {
+            reduceBuffer = enqueueRelay(result, 0, size,
+                    child, std::vector<dcl::Process *>(), nativeEventWaitList);
+            nativeEventWaitList.assign(1, reduceBuffer);
+            initialized = true;
+        }
+    }
+
+    if (parent) {
+        /* Send partial result to parent */
+        reduceBuffer = enqueueRelay(result, 0, size,
+                nullptr, std::vector<dcl::Process *>(1, parent), nativeEventWaitList);
+    } else if (!reduceBuffer()) {
+        /* The destination buffer is the only source buffer, such that no
+         * command has been enqueued */
+        reduceBuffer = joinEvents(*_context, nativeEventWaitList);
+    }
+    _commandQueue.flush();
+
+    dcl::util::Logger << dcl::util::Debug
+            << "Enqueued reduction of " << srcs.size() << " buffer(s) and "
+            << children.size() << " partial result(s)"
+            << std::endl;
+
+    if (event) { // an event should be associated with this command
+        try {
+            *event = std::make_shared<SimpleEvent>(commandId, _context,
+                    dstImpl, 0, 0, reduceBuffer);
+        } catch (const std::bad_alloc&) {
+            throw cl::Error(CL_OUT_OF_RESOURCES);
+        }
+    }
+}
+
+void CommandQueue::enqueueWriteBuffers(
+        const std::vector<std::shared_ptr<dcl::CommandQueue>>& commandQueues,
+        const std::vector<std::shared_ptr<dcl::Buffer>>& buffers,
+        const std::vector<size_t>& offsets,
+        size_t cb,
+        size_t chunkSize,
+        dcl::Process *predecessor,
+        dcl::Process *successor,
+        const std::vector<std::shared_ptr<dcl::Event>> *eventWaitList,
+        dcl::object_id commandId,
+        std::shared_ptr<dcl::Event> *event) {
+    std::vector<std::shared_ptr<Buffer>> bufferImpls;
+    std::vector<cl::CommandQueue> nativeCommandQueues;
+    VECTOR_CLASS<cl::Event> nativeEventWaitList;
+    VECTOR_CLASS<cl::Event> writeEvents;
     cl::Event mapData, unmapData;
-    cl::UserEvent copyData(*_context);
+    cl::UserEvent forwardData(*_context);
+    cl::UserEvent completeData(*_context);
 
-    if (!bufferImpl) throw cl::Error(CL_INVALID_MEM_OBJECT);
+    if (buffers.empty() || commandQueues.size() != buffers.size() ||
+            offsets.size() != buffers.size() || cb == 0) {
+        throw cl::Error(CL_INVALID_VALUE);
+    }
+
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        auto bufferImpl = std::dynamic_pointer_cast<Buffer>(buffers[i]);
+        auto commandQueueImpl = std::dynamic_pointer_cast<CommandQueue>(commandQueues[i]);
+        if (!bufferImpl) throw cl::Error(CL_INVALID_MEM_OBJECT);
+        if (!commandQueueImpl) throw cl::Error(CL_INVALID_COMMAND_QUEUE);
+        bufferImpls.push_back(bufferImpl);
+        nativeCommandQueues.push_back(*commandQueueImpl);
+    }
 
     /* Obtain wait list of native events */
     if (eventWaitList) {
         synchronize(*eventWaitList, nativeEventWaitList);
     }
 
-    /* Enqueue map buffer (implicit download) */
+    /* Enqueue map of the first buffer range, which receives the data */
     void *ptr = _commandQueue.enqueueMapBuffer(
-            *bufferImpl,
-            CL_FALSE,    // non-blocking map
-            CL_MAP_READ, // map for reading
-            offset, size,
+            *bufferImpls.front(),
+            CL_FALSE,     // non-blocking map
+            CL_MAP_WRITE, // map for writing
+            offsets.front(), cb,
             &nativeEventWaitList, &mapData);
-    /* Enqueue unmap buffer
-     * Only create a native event for unmapping, if an event should be
-     * associated with this read buffer command */
-    nativeEventWaitList.assign(1, copyData);
+    /* Enqueue unmap buffer when all chunks have been received and forwarded */
+    VECTOR_CLASS<cl::Event> unmapEventWaitList(1, forwardData);
     _commandQueue.enqueueUnmapMemObject(
-            *bufferImpl,
+            *bufferImpls.front(),
             ptr,
-            &nativeEventWaitList, event ? &unmapData : nullptr);
-#ifdef FORCE_FLUSH
+            &unmapEventWaitList, &unmapData);
     _commandQueue.flush();
-#else
-    if (blockingRead) {
-        _commandQueue.flush();
+    writeEvents.push_back(unmapData);
+
+    /* Enqueue copies to remaining buffers */
+    nativeEventWaitList.assign(1, unmapData);
+    for (size_t i = 1; i < bufferImpls.size(); ++i) {
+        cl::Event copyBuffer;
+
+        nativeCommandQueues[i].enqueueCopyBuffer(
+                *bufferImpls.front(), *bufferImpls[i],
+                offsets.front(), offsets[i], cb,
+                &nativeEventWaitList, &copyBuffer);
+        nativeCommandQueues[i].flush();
+
+        writeEvents.push_back(copyBuffer);
     }
-#endif
 
-    try {
-        /* Schedule data sending
-         * A 'command submitted' message will be sent to the host in order to
-         * start data receipt. */
-        mapData.setCallback(CL_COMPLETE, &executeCommand,
-                new command::CopyDataCommand<command::DeviceToHost>(
-                        _context->host(), commandId, size, ptr, copyData));
-        /* The read buffer command is finished on the host such that no 'command
-         * complete' message must be sent by the compute node. */
+    cl::UserEvent writeData = joinEvents(*_context, writeEvents);
 
-        if (event) { // an event should be associated with this command
-            /* WARNING: No callback must be registered for any native event of
-             * the ReadMemoryEvent object, that access the object. As the host
-             * finishes the read buffer command, the application may delete the
-             * ReadMemoryEvent object, while or even *before* the callbacks are
-             * processed. Thus, a callback that accesses the ReadMemoryEvent
-             * object may raise a SIGSEGV. */
-            *event = std::make_shared<ReadMemoryEvent>(commandId, _context,
-                    mapData, unmapData);
+    try {
+        auto pipeline = std::make_shared<Pipeline>(_context->host(), commandId,
+                predecessor, successor, cb, (chunkSize ? chunkSize : cb), ptr,
+                forwardData, completeData);
+
+        /* Schedule data receipt and forwarding */
+        mapData.setCallback(CL_COMPLETE, &executePipeline,
+                new std::shared_ptr<Pipeline>(pipeline));
+        /* Schedule acknowledgement to predecessor */
+        writeData.setCallback(CL_COMPLETE, &finishPipeline,
+                new std::shared_ptr<Pipeline>(pipeline));
+        if (!predecessor && !event) {
+            /* Schedule completion message for host
+             * The first compute node completes the upload when all compute
+             * nodes of the chain have acknowledged it. */
+            completeData.setCallback(CL_COMPLETE, &executeCommand,
+                    new command::SetCompleteCommand(_context->host(), commandId, cl::UserEvent(*_context)));
         }
     } catch (const std::bad_alloc&) {
         throw cl::Error(CL_OUT_OF_RESOURCES);
     }
+
+    dcl::util::Logger << dcl::util::Debug
+            << "Enqueued multicast upload of " << cb << " bytes in chunks of "
+            << (chunkSize ? chunkSize : cb) << " bytes to " << buffers.size()
+            << " buffer(s)" << (successor ? " and successor" : "")
+            << std::endl;
+
+    if (event) { // an event should be associated with this command
+        /* The first compute node's event completes the upload for the host,
+         * when all compute nodes of the chain have acknowledged it */
+        try {
+            *event = std::make_shared<SimpleEvent>(commandId, _context,
+                    std::vector<std::shared_ptr<Memory>>(
+                            std::begin(bufferImpls), std::end(bufferImpls)),
+                    (predecessor ? writeData : completeData));
+        } catch (const std::bad_alloc&) {
+            throw cl::Error(CL_OUT_OF_RESOURCES);
+        }
+    }
 }
 
-void CommandQueue::enqueueWriteBuffer(
+void CommandQueue::enqueueReadBuffer(
         const std::shared_ptr<dcl::Buffer>& buffer,
-        bool blockingWrite,
+        bool blockingRead,
         size_t offset,
         size_t size,
+        size_t chunkSize,
         const std::vector<std::shared_ptr<dcl::Event>> *eventWaitList,
         dcl::object_id commandId,
         std::shared_ptr<dcl::Event> *event) {
     auto bufferImpl = std::dynamic_pointer_cast<Buffer>(buffer);
     VECTOR_CLASS<cl::Event> nativeEventWaitList;
-    cl::Event mapData, unmapData;
-    cl::UserEvent copyData(*_context);
+    cl::Event startData, endData;
 
     if (!bufferImpl) throw cl::Error(CL_INVALID_MEM_OBJECT);
 
@@ -526,82 +1368,79 @@ void CommandQueue::enqueueWriteBuffer(
         synchronize(*eventWaitList, nativeEventWaitList);
     }
 
-    /* Enqueue map buffer */
-    void *ptr = _commandQueue.enqueueMapBuffer(
-            *bufferImpl,
-            CL_FALSE,     // non-blocking map
-            CL_MAP_WRITE, // map for writing
-            offset, size,
-            &nativeEventWaitList, &mapData);
-    /* Enqueue unmap buffer (implicit upload) */
-    nativeEventWaitList.assign(1, copyData);
-    _commandQueue.enqueueUnmapMemObject(
-            *bufferImpl,
-            ptr,
-            &nativeEventWaitList, &unmapData);
-#ifdef FORCE_FLUSH
-    _commandQueue.flush();
-#else
-    if (blockingWrite) {
-        _commandQueue.flush();
+    /* Enqueue read buffer into staging buffer
+     * A 'command submitted' message will be sent to the host in order to
+     * start data receipt. */
+    enqueueReadBuffer(bufferImpl, blockingRead, offset, size, chunkSize,
+            nativeEventWaitList, commandId, startData, endData);
+    /* The read buffer command is finished on the host such that no 'command
+     * complete' message must be sent by the compute node. */
+
+    if (event) { // an event should be associated with this command
+        /* WARNING: No callback must be registered for any native event of
+         * the ReadMemoryEvent object, that access the object. As the host
+         * finishes the read buffer command, the application may delete the
+         * ReadMemoryEvent object, while or even *before* the callbacks are
+         * processed. Thus, a callback that accesses the ReadMemoryEvent
+         * object may raise a SIGSEGV. */
+        try {
+            *event = std::make_shared<ReadMemoryEvent>(commandId, _context,
+                    startData, endData);
+        } catch (const std::bad_alloc&) {
+            throw cl::Error(CL_OUT_OF_RESOURCES);
+        }
     }
-#endif
+}
 
-    try {
-        /* TODO Sketch of a possible solution for a command-based implementation
-         * Complex commands, i.e., commands which include interaction with the
-         * host, should be implemented by a class and must be independent of an
-         * event. */
-#if 0
-        /* The write buffer command notifies the host about its submission and
-         * completion, regardless an event is associated with it or not. */
-        std::shared_ptr<command::WriteBuffer> writeBuffer(
-                std::make_shared<command::WriteBufferCommand>(_context->host(),
-                        commandId, size, ptr, mapBuffer, dataReceipt, unmapData));
+void CommandQueue::enqueueWriteBuffer(
+        const std::shared_ptr<dcl::Buffer>& buffer,
+        bool blockingWrite,
+        size_t offset,
+        size_t size,
+        size_t chunkSize,
+        const std::vector<std::shared_ptr<dcl::Event>> *eventWaitList,
+        dcl::object_id commandId,
+        std::shared_ptr<dcl::Event> *event) {
+    auto bufferImpl = std::dynamic_pointer_cast<Buffer>(buffer);
+    VECTOR_CLASS<cl::Event> nativeEventWaitList;
+    cl::Event startData, endData;
 
-        if (event) { // an event should be associated with this command
-            /* An event wrapper retains its associated command for further
-             * commands from the host. Moreover, it broadcast command execution
-             * status changes to other compute nodes in the command's context,
-             * while the command only communicates with the host. */
-            *event = std::make_shared<WriteMemoryEvent>(commandId, _context,
-                    bufferImpl, writeBuffer);
-        }
-#else
-        /* Schedule data receipt
-         * A 'command submitted' message will be sent to the host. */
-        mapData.setCallback(CL_COMPLETE, &executeCommand,
-                new command::CopyDataCommand<command::HostToDevice>(
-                        _context->host(), commandId, size, ptr, copyData));
-        /* Schedule completion message for host
-         * A 'command complete' message is sent to the host.
-         * Note that this message must also be sent, if no event is associated
-         * with this command, such that a blocking write succeeds. */
-        unmapData.setCallback(CL_COMPLETE, &executeCommand,
-                new command::SetCompleteCommand(_context->host(), commandId, cl::UserEvent(*_context)));
+    if (!bufferImpl) throw cl::Error(CL_INVALID_MEM_OBJECT);
 
-        if (event) { // an event should be associated with this command
-            /* This event must only broadcast its status on other compute nodes
-             * but not to the host, as a 'command complete' message is already
-             * sent to the host by the callback that has been set for the native
-             * event unmapData. */
-            /* FIXME Avoid race condition in write buffer command
-             * Callbacks are registered for unmapData to 1) notify the host
-             * about command completion, and 2) to synchronize the memory object
-             * associated with WriteMemoryEvent.
-             * As the execution order of callback is unspecified, the host may
-             * be notified about command completion (callback 1) before
-             * callback 2 is executed. If the application and the network
-             * respond quickly to callback 1 in order to delete the
-             * WriteMemoryEvent object, it may be deleted *before* callback 2 is
-             * processed. In this case callback 2 tries to access the deleted
-             * WriteMemoryEvent object, such that a SIGSEGV will be raised. */
+    /* Obtain wait list of native events */
+    if (eventWaitList) {
+        synchronize(*eventWaitList, nativeEventWaitList);
+    }
+
+    /* Enqueue write buffer from staging buffer
+     * A 'command submitted' message is sent to the host in order to start
+     * data sending, and a 'command complete' message is sent when the write
+     * is complete. */
+    enqueueWriteBuffer(bufferImpl, blockingWrite, offset, size, chunkSize,
+            nativeEventWaitList, commandId, startData, endData);
+
+    if (event) { // an event should be associated with this command
+        /* This event must only broadcast its status on other compute nodes
+         * but not to the host, as a 'command complete' message is already
+         * sent to the host by the callback that has been set for the native
+         * event endData. */
+        /* FIXME Avoid race condition in write buffer command
+         * Callbacks are registered for endData to 1) notify the host about
+         * command completion, and 2) to synchronize the memory object
+         * associated with WriteMemoryEvent.
+         * As the execution order of callback is unspecified, the host may
+         * be notified about command completion (callback 1) before
+         * callback 2 is executed. If the application and the network
+         * respond quickly to callback 1 in order to delete the
+         * WriteMemoryEvent object, it may be deleted *before* callback 2 is
+         * processed. In this case callback 2 tries to access the deleted
+         * WriteMemoryEvent object, such that a SIGSEGV will be raised. */
+        try {
             *event = std::make_shared<WriteMemoryEvent>(commandId, _context,
-                    bufferImpl, mapData, unmapData);
+                    bufferImpl, offset, size, startData, endData);
+        } catch (const std::bad_alloc&) {
+            throw cl::Error(CL_OUT_OF_RESOURCES);
         }
-#endif
-    } catch (const std::bad_alloc&) {
-        throw cl::Error(CL_OUT_OF_RESOURCES);
     }
 }
 
@@ -627,16 +1466,16 @@ void CommandQueue::enqueueMapBuffer(
     if (map_flags & CL_MAP_READ) {
         /* The mapped memory region has to be synchronized, i.e., it has to be
          * downloaded to the mapped host pointer. */
-        cl::Event mapData, unmapData;
+        cl::Event startData, endData;
 
-        enqueueReadBuffer(bufferImpl, blockingMap, offset, size,
-                nativeEventWaitList, commandId, mapData, unmapData);
+        enqueueReadBuffer(bufferImpl, blockingMap, offset, size, 0,
+                nativeEventWaitList, commandId, startData, endData);
 
         if (event) { // an event should be associated with this command
             /* The event must only broadcast its status on other compute nodes
              * but not to the host, as a 'command complete' message will be sent
              * to the host by the callback that has been set for the native
-             * event unmapData. */
+             * event endData. */
             /* WARNING: No callback must be registered for any native event of
              * the CompoundNodeEvent object, that access the object. As the order
              * of execution of callbacks is undefined, the application may delete
@@ -645,7 +1484,7 @@ void CommandQueue::enqueueMapBuffer(
              * raise a SIGSEGV. */
             try {
                 *event = std::make_shared<ReadMemoryEvent>(commandId, _context,
-                        mapData, unmapData);
+                        startData, endData);
             } catch (const std::bad_alloc&) {
                 throw cl::Error(CL_OUT_OF_RESOURCES);
             }
@@ -698,19 +1537,19 @@ void CommandQueue::enqueueUnmapBuffer(
     if (map_flags & CL_MAP_WRITE) {
         /* The mapped memory region has to be synchronized, i.e. its data
          * has to be uploaded to the buffer. */
-        cl::Event mapData, unmapData;
+        cl::Event startData, endData;
 
-        enqueueWriteBuffer(bufferImpl, false, offset, size,
-                nativeEventWaitList, commandId, mapData, unmapData);
+        enqueueWriteBuffer(bufferImpl, false, offset, size, 0,
+                nativeEventWaitList, commandId, startData, endData);
 
         if (event) { // an event should be associated with this command
             /* The event must only broadcast its status on other compute nodes
              * but not to the host, as a 'command complete' message will be sent
              * to the host by the callback that has been set for the native
-             * event unmapData. */
+             * event endData. */
             try {
                 *event = std::make_shared<WriteMemoryEvent>(commandId, _context,
-                        bufferImpl, mapData, unmapData);
+                        bufferImpl, offset, size, startData, endData);
             } catch (const std::bad_alloc&) {
                 throw cl::Error(CL_OUT_OF_RESOURCES);
             }
@@ -49,6 +49,7 @@
 #include <dcl/Event.h>
 #include <dcl/Kernel.h>
 #include <dcl/Memory.h>
+#include <dcl/Process.h>
 
 #define __CL_ENABLE_EXCEPTIONS
 #ifdef __APPLE__
@@ -102,11 +103,50 @@ public:
             dcl::object_id                                  commandId,
             std::shared_ptr<dcl::Event> *                   event);
 
+    void enqueueBroadcastBuffer(
+            const std::shared_ptr<dcl::Buffer>&                     src,
+            const std::vector<std::shared_ptr<dcl::CommandQueue>>&  commandQueues,
+            const std::vector<std::shared_ptr<dcl::Buffer>>&        dsts,
+            size_t                                                  srcOffset,
+            const std::vector<size_t>&                              dstOffsets,
+            size_t                                                  cb,
+            dcl::Process *                                          parent,
+            const std::vector<dcl::Process *>&                      children,
+            const std::vector<std::shared_ptr<dcl::Event>> *        eventWaitList,
+            dcl::object_id                                          commandId,
+            std::shared_ptr<dcl::Event> *                           event);
+
+    void enqueueReduceBuffer(
+            const std::vector<std::shared_ptr<dcl::Buffer>>&    srcs,
+            const std::shared_ptr<dcl::Buffer>&                 dst,
+            const std::shared_ptr<dcl::Kernel>&                 kernel,
+            const std::vector<size_t>&                          offset,
+            const std::vector<size_t>&                          global,
+            const std::vector<size_t>&                          local,
+            dcl::Process *                                      parent,
+            const std::vector<dcl::Process *>&                  children,
+            const std::vector<std::shared_ptr<dcl::Event>> *    eventWaitList,
+            dcl::object_id                                      commandId,
+            std::shared_ptr<dcl::Event> *                       event);
+
+    void enqueueWriteBuffers(
+            const std::vector<std::shared_ptr<dcl::CommandQueue>>&  commandQueues,
+            const std::vector<std::shared_ptr<dcl::Buffer>>&        buffers,
+            const std::vector<size_t>&                              offsets,
+            size_t                                                  cb,
+            size_t                                                  chunkSize,
+            dcl::Process *                                          predecessor,
+            dcl::Process *                                          successor,
+            const std::vector<std::shared_ptr<dcl::Event>> *        eventWaitList,
+            dcl::object_id                                          commandId,
+            std::shared_ptr<dcl::Event> *                           event);
+
     void enqueueReadBuffer(
             const std::shared_ptr<dcl::Buffer>&             buffer,
             bool                                            blockingRead,
             size_t                                          offset,
             size_t                                          size,
+            size_t                                          chunkSize,
             const std::vector<std::shared_ptr<dcl::Event>> *eventWaitList,
             dcl::object_id                                  commandId,
             std::shared_ptr<dcl::Event> *                   event);
@@ -116,6 +156,7 @@ public:
             bool                                            blockingWrite,
             size_t                                          offset,
             size_t                                          size,
+            size_t                                          chunkSize,
             const std::vector<std::shared_ptr<dcl::Event>> *eventWaitList,
             dcl::object_id                                  commandId,
             std::shared_ptr<dcl::Event> *                   event);
@@ -187,25 +228,73 @@ private:
             const std::vector<std::shared_ptr<dcl::Event>>& eventWaitList,
             VECTOR_CLASS<cl::Event>&                        nativeEventWaitList);
 
+    /*!
+     * \brief Enqueues a download of a buffer range to the host.
+     *
+     * The buffer range is read into a staging buffer chunk by chunk. Each
+     * chunk is sent to the host as soon as it has been read, while the
+     * following chunks are still read from the device.
+     *
+     * \param[in]  chunkSize   size of the chunks, or 0 to read the buffer range at once
+     * \param[out] startData   native event associated with reading the first chunk
+     * \param[out] endData     native event associated with reading the last chunk
+     */
     void enqueueReadBuffer(
             const std::shared_ptr<Buffer>&  buffer,
             bool                            blocking,
             size_t                          offset,
             size_t                          size,
+            size_t                          chunkSize,
             const VECTOR_CLASS<cl::Event>&  nativeEventWaitList,
             dcl::object_id                  commandId,
-            cl::Event&                      mapData,
-            cl::Event&                      unmapData);
+            cl::Event&                      startData,
+            cl::Event&                      endData);
 
+    /*!
+     * \brief Enqueues an upload of a buffer range from the host.
+     *
+     * The buffer range is received into a staging buffer chunk by chunk. Each
+     * chunk is written to the device as soon as it has been received, while
+     * the following chunks are still received from the host. The host is
+     * notified when the last chunk has been written.
+     *
+     * \param[in]  chunkSize   size of the chunks, or 0 to write the buffer range at once
+     * \param[out] startData   native event associated with writing the first chunk
+     * \param[out] endData     native event associated with writing the last chunk
+     */
     void enqueueWriteBuffer(
             const std::shared_ptr<Buffer>&  buffer,
             bool                            blocking,
             size_t                          offset,
             size_t                          size,
+            size_t                          chunkSize,
             const VECTOR_CLASS<cl::Event>&  nativeEventWaitList,
             dcl::object_id                  commandId,
-            cl::Event&                      mapData,
-            cl::Event&                      unmapData);
+            cl::Event&                      startData,
+            cl::Event&                      endData);
+
+    /*!
+     * \brief Enqueues a relay of a buffer range between compute nodes.
+     *
+     * The buffer range is mapped, received from a source process (if any),
+     * sent to all destination processes, and unmapped.
+     *
+     * \param[in]  buffer              the buffer
+     * \param[in]  offset              offset of the buffer range
+     * \param[in]  cb                  size of the buffer range in bytes
+     * \param[in]  source              the process from which the buffer range
+     *             is received, or \c NULL
+     * \param[in]  destinations        the processes to which the buffer range is sent
+     * \param[in]  nativeEventWaitList events to wait for before mapping
+     * \return the native event associated with unmapping the buffer range
+     */
+    cl::Event enqueueRelay(
+            const cl::Buffer&                   buffer,
+            size_t                              offset,
+            size_t                              cb,
+            dcl::Process *                      source,
+            const std::vector<dcl::Process *>&  destinations,
+            const VECTOR_CLASS<cl::Event>&      nativeEventWaitList);
 
     void enqueuePhonyMarker(
             bool                            blocking,
@@ -43,6 +43,7 @@
 
 #include "Context.h"
 #include "Device.h"
+#include "StagingPool.h"
 
 #include <dcl/Binary.h>
 #include <dcl/ComputeNode.h>
@@ -111,6 +112,7 @@ Context::Context(
 
 	_context = cl::Context(nativeDevices, properties, &onContextError, _listener.get());
     _ioCommandQueue = cl::CommandQueue(_context, nativeDevices.front());
+    _stagingPool = std::make_shared<StagingPool>(_context, nativeDevices.front());
 }
 
 Context::~Context() { }
@@ -127,6 +129,10 @@ const cl::CommandQueue& Context::ioCommandQueue() const {
     return _ioCommandQueue;
 }
 
+StagingPool& Context::stagingPool() const {
+    return *_stagingPool;
+}
+
 const std::vector<dcl::ComputeNode *>& Context::computeNodes() const {
 	return _computeNodes;
 }
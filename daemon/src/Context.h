@@ -44,6 +44,8 @@
 #ifndef CONTEXT_H_
 #define CONTEXT_H_
 
+#include "StagingPool.h"
+
 #include <dcl/ComputeNode.h>
 #include <dcl/Context.h>
 #include <dcl/ContextListener.h>
@@ -69,7 +71,7 @@ namespace dcld {
  *
  * This wrapper is required to notify context listeners about context errors.
  * Moreover, this wrapper holds a command queue for asynchronously reading and
- * writing data.
+ * writing data, and a pool of staging buffers for data transfers.
  */
 class Context: public dcl::Context {
 public:
@@ -86,6 +88,7 @@ public:
 
     dcl::Host& host() const;
     const cl::CommandQueue& ioCommandQueue() const;
+    StagingPool& stagingPool() const;
     const std::vector<dcl::ComputeNode *>& computeNodes() const;
 
 private:
@@ -108,6 +111,8 @@ private:
      */
     cl::CommandQueue _ioCommandQueue;
 
+    std::shared_ptr<StagingPool> _stagingPool; //!< Staging buffers for data transfers
+
     std::shared_ptr<dcl::ContextListener> _listener;
 };
 
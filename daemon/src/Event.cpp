@@ -53,6 +53,7 @@
 #include <dcl/DCLException.h>
 #include <dcl/DCLTypes.h>
 #include <dcl/Host.h>
+#include <dcl/Process.h>
 #include <dcl/Remote.h>
 
 #include <dcl/util/Clock.h>
@@ -68,12 +69,14 @@
 #endif
 
 #include <cassert>
+#include <cstddef>
 #if 0
 #include <functional>
 #endif
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <vector>
 
 namespace {
 
@@ -111,6 +114,19 @@ void onEventComplete(cl_event object_, cl_int execution_status,
     event->onExecutionStatusChanged(execution_status);
 }
 
+/*!
+ * \brief Checks if profiling is enabled for the command queue of an event
+ */
+bool isProfilingEnabled(const cl::Event& event) {
+    try {
+        cl::CommandQueue commandQueue = event.getInfo<CL_EVENT_COMMAND_QUEUE>();
+        return (commandQueue() != nullptr) &&
+                (commandQueue.getInfo<CL_QUEUE_PROPERTIES>() & CL_QUEUE_PROFILING_ENABLE);
+    } catch (const cl::Error&) {
+        return false;
+    }
+}
+
 } /* unnamed namespace */
 
 /* ****************************************************************************/
@@ -120,25 +136,41 @@ namespace dcld {
 Event::Event(
         const std::shared_ptr<Context>& context,
         const std::vector<std::shared_ptr<Memory>>& memoryObjects) :
-	_context(context), _memoryObjects(memoryObjects) {
+	_context(context), _memoryObjects(memoryObjects), _offset(0), _cb(0) {
     /* do not check context here, to allow for error handling in derived classes */
 }
 
 Event::Event(
         const std::shared_ptr<Context>& context,
-        const std::shared_ptr<Memory>& memoryObject) :
-    _context(context), _memoryObjects(1, memoryObject) { }
+        const std::vector<std::shared_ptr<Memory>>& memoryObjects,
+        size_t offset, size_t cb) :
+    _context(context), _memoryObjects(memoryObjects),
+    _offset(cb ? offset : 0), _cb(cb) { }
+
+Event::Event(
+        const std::shared_ptr<Context>& context,
+        const std::shared_ptr<Memory>& memoryObject,
+        size_t offset, size_t cb) :
+    _context(context), _memoryObjects(1, memoryObject),
+    _offset(cb ? offset : 0), _cb(cb) { }
 
 Event::Event(
         const std::shared_ptr<Context>& context) :
-    _context(context) { }
+    _context(context), _offset(0), _cb(0) { }
+
+size_t Event::modifiedSize(const Memory& memoryObject) const {
+    return _cb ? _cb : memoryObject.size();
+}
 
 /* ****************************************************************************/
 
 RemoteEvent::RemoteEvent(dcl::object_id id,
         const std::shared_ptr<Context>& context,
-        const std::vector<std::shared_ptr<Memory>>& memoryObjects) :
-    dcl::Remote(id), Event(context, memoryObjects) {
+        const std::vector<std::shared_ptr<Memory>>& memoryObjects,
+        size_t offset, size_t cb,
+        dcl::Process *source) :
+    dcl::Remote(id), Event(context, memoryObjects, offset, cb),
+    _complete(false), _source(source) {
     if (!context) throw cl::Error(CL_INVALID_CONTEXT);
 
     _event = cl::UserEvent(*_context);
@@ -159,21 +191,28 @@ void RemoteEvent::synchronize(
 
     if (       !_memoryObjects.empty() /* synchronization of memory objects required */
             &&     _syncEvents.empty() /* no synchronization performed yet */) {
+        /* Changes are either acquired directly from the event's compute
+         * node, or from the host which forwards them from that compute node */
+        dcl::Process& source = _source ? *_source : _context->host();
+
         /*
          * Trigger event synchronization on host
+         * The host requests the event's compute node to release the changes
+         * to the source process.
          */
         /* TODO Use SychronizationListener interface to send message */
-        /* TODO Send message to event owner (host or compute node) */
         dclasio::message::EventSynchronizationMessage msg(_id);
         _context->host().sendMessage(msg);
         dcl::util::Logger << dcl::util::Debug
-                << "Sent event synchronization message to host (ID=" << _id << ')'
+                << "Sent event synchronization message to host (ID=" << _id
+                << ", source='" << source.url() << "')"
                 << std::endl;
 
         for (auto memoryObject : _memoryObjects) {
             cl::Event acquire; /* Event representing the acquire operation of the current memory object.
                                 * Serves as synchronization point for following commands and other devices */
-            memoryObject->acquire(_context->host(), commandQueue, _event, &acquire);
+            memoryObject->acquire(source, commandQueue,
+                    _offset, modifiedSize(*memoryObject), _event, &acquire);
             _syncEvents.push_back(acquire);
         }
     }
@@ -189,9 +228,18 @@ void RemoteEvent::getProfilingInfo(cl_profiling_info param_name,
     throw cl::Error(CL_PROFILING_INFO_NOT_AVAILABLE);
 }
 
+void RemoteEvent::onSubscribe(dcl::Process& computeNode) {
+    dcl::util::Logger << dcl::util::Error
+            << "Subscription attempt on replacement event (ID=" << _id << ')'
+            << std::endl;
+}
+
 void RemoteEvent::onExecutionStatusChanged(cl_int executionStatus) {
     assert(executionStatus == CL_COMPLETE || executionStatus < 0);
+    std::lock_guard<std::mutex> lock(_statusMutex);
+    if (_complete) return; // status has already been set
     _event.setStatus(executionStatus);
+    _complete = true;
 }
 
 void RemoteEvent::onSynchronize(dcl::Process& process) {
@@ -206,16 +254,19 @@ LocalEvent::LocalEvent(dcl::object_id id,
         const std::shared_ptr<Context>& context,
 		const std::vector<std::shared_ptr<Memory>>& memoryObjects) :
 	dcl::Remote(id), Event(context, memoryObjects),
-	_received(dcl::util::clock.getTime()) {
+	_received(dcl::util::clock.getTime()),
+	_complete(false), _executionStatus(CL_QUEUED) {
     /* local events are created by command queue methods, which should pass checked arguments */
     assert(context != nullptr && "Invalid context");
 }
 
 LocalEvent::LocalEvent(dcl::object_id id,
         const std::shared_ptr<Context>& context,
-        const std::shared_ptr<Memory>& memoryObject) :
-    dcl::Remote(id), Event(context, memoryObject),
-	_received(dcl::util::clock.getTime()) {
+        const std::shared_ptr<Memory>& memoryObject,
+        size_t offset, size_t cb) :
+    dcl::Remote(id), Event(context, memoryObject, offset, cb),
+	_received(dcl::util::clock.getTime()),
+	_complete(false), _executionStatus(CL_QUEUED) {
     /* local events are created by command queue methods, which should pass checked arguments */
     assert(context != nullptr && "Invalid context");
 }
@@ -223,7 +274,8 @@ LocalEvent::LocalEvent(dcl::object_id id,
 LocalEvent::LocalEvent(dcl::object_id id,
         const std::shared_ptr<Context>& context) :
     dcl::Remote(id), Event(context),
-	_received(dcl::util::clock.getTime()) {
+	_received(dcl::util::clock.getTime()),
+	_complete(false), _executionStatus(CL_QUEUED) {
     /* local events are created by command queue methods, which should pass checked arguments */
     assert(context != nullptr && "Invalid context");
 }
@@ -231,6 +283,68 @@ LocalEvent::LocalEvent(dcl::object_id id,
 LocalEvent::~LocalEvent() {
 }
 
+void LocalEvent::onSubscribe(dcl::Process& computeNode) {
+    {
+        std::lock_guard<std::mutex> lock(_subscribersMutex);
+        if (!_complete) {
+            _subscribers.push_back(&computeNode);
+            return;
+        }
+    }
+
+    /* Command is already complete */
+    dclasio::message::CommandExecutionStatusChangedMessage message(
+            _id, _executionStatus, _context->host().get_id());
+    try {
+        computeNode.sendMessage(message);
+
+        dcl::util::Logger << dcl::util::Debug
+                << "Sent update of command execution status to compute node '" << computeNode.url()
+                << "' (ID=" << _id << ", status=" << _executionStatus << ')'
+                << std::endl;
+    } catch (const dcl::IOException& err) {
+        dcl::util::Logger << dcl::util::Error
+                << "Sending update of command execution status to compute node '" << computeNode.url()
+                << "' failed (ID=" << _id << ", status=" << _executionStatus << ')'
+                << std::endl;
+    }
+}
+
+void LocalEvent::notifySubscribers(cl_int executionStatus) {
+    std::vector<dcl::Process *> subscribers;
+
+    {
+        std::lock_guard<std::mutex> lock(_subscribersMutex);
+        if (_complete) return; // final execution status already sent
+        _complete = true;
+        _executionStatus = executionStatus;
+        subscribers.swap(_subscribers);
+    }
+
+    if (subscribers.empty()) return;
+
+    /* The host of this event is specified, as the subscribers do not know
+     * which host this message refers to */
+    dclasio::message::CommandExecutionStatusChangedMessage message(
+            _id, executionStatus, _context->host().get_id());
+    for (auto subscriber : subscribers) {
+        try {
+            subscriber->sendMessage(message);
+        } catch (const dcl::IOException& err) {
+            dcl::util::Logger << dcl::util::Error
+                    << "Sending update of command execution status to compute node '" << subscriber->url()
+                    << "' failed (ID=" << _id << ", status=" << executionStatus << ')'
+                    << std::endl;
+        }
+    }
+
+    dcl::util::Logger << dcl::util::Debug
+            << "Sent update of command execution status to compute nodes (ID=" << _id
+            << ", status=" << executionStatus
+            << ", compute nodes=" << subscribers.size() << ')'
+            << std::endl;
+}
+
 void LocalEvent::onSynchronize(dcl::Process& process) {
     cl::CommandQueue commandQueue = _context->ioCommandQueue();
 
@@ -242,9 +356,11 @@ void LocalEvent::onSynchronize(dcl::Process& process) {
     /* Acquire changes to memory objects associated with this event.
      * The acquire operations are performed using the context's I/O command
      * queue. This queue is reserved for synchronization and thus does not
-     * interfere (e.g., deadlock) with application commands. */
+     * interfere (e.g., deadlock) with application commands.
+     * Only the range modified by this event's command is released. */
     for (auto memoryObject : _memoryObjects) {
-        memoryObject->release(process, commandQueue, *this);
+        memoryObject->release(process, commandQueue,
+                _offset, modifiedSize(*memoryObject), *this);
     }
 
     /* The I/O command queue must be flushed to ensure instant execution of the
@@ -267,8 +383,9 @@ SimpleEvent::SimpleEvent(dcl::object_id id,
 SimpleEvent::SimpleEvent(dcl::object_id id,
         const std::shared_ptr<Context>& context,
         const std::shared_ptr<Memory>& memoryObject,
+        size_t offset, size_t cb,
         const cl::Event& event) :
-    LocalEvent(id, context, memoryObject), _event(event)
+    LocalEvent(id, context, memoryObject, offset, cb), _event(event)
 {
     /* Schedule event status update notification */
     _event.setCallback(CL_COMPLETE, &onEventComplete, this);
@@ -300,20 +417,44 @@ void SimpleEvent::getProfilingInfo(cl_profiling_info param_name,
 }
 
 void SimpleEvent::onExecutionStatusChanged(cl_int executionStatus) {
-    dclasio::message::CommandExecutionStatusChangedMessage message(_id, executionStatus);
+    /* Substitute events on other compute nodes are notified directly, rather
+     * than by the host. Subscribers are notified first, as the host may
+     * release this event right after it has received the status. */
+    notifySubscribers(executionStatus);
+
+    /* Send profiling info along with the completion, such that the host need
+     * not request it separately */
+    std::vector<cl_ulong> profilingInfo;
+    if (executionStatus == CL_COMPLETE && isProfilingEnabled(_event)) {
+        try {
+            cl_ulong received, queued, submit, start, end;
+            getProfilingInfo(CL_PROFILING_COMMAND_RECEIVED_WWU, received);
+            getProfilingInfo(CL_PROFILING_COMMAND_QUEUED, queued);
+            getProfilingInfo(CL_PROFILING_COMMAND_SUBMIT, submit);
+            getProfilingInfo(CL_PROFILING_COMMAND_START, start);
+            getProfilingInfo(CL_PROFILING_COMMAND_END, end);
+            profilingInfo = { received, queued, submit, start, end };
+        } catch (const cl::Error& err) {
+            dcl::util::Logger << dcl::util::Warning
+                    << "Profiling info not available (ID=" << _id
+                    << ", error=" << err.err() << ')'
+                    << std::endl;
+        }
+    }
+
+    dclasio::message::CommandExecutionStatusChangedMessage message(
+            _id, executionStatus, profilingInfo);
 
     try {
-        /* Broadcast execution status to remote events */
         _context->host().sendMessage(message);
-        sendMessage(_context->computeNodes(), message);
 
         dcl::util::Logger << dcl::util::Debug
-                << "Sent update of command execution status (ID=" << _id
+                << "Sent update of command execution status to host (ID=" << _id
                 << ", status=" << executionStatus << ')'
                 << std::endl;
     } catch (const dcl::IOException& err) {
         dcl::util::Logger << dcl::util::Error
-                << "Sending update of command execution status failed (ID=" << _id
+                << "Sending update of command execution status to host failed (ID=" << _id
                 << ", status=" << executionStatus << ')'
                 << std::endl;
     }
@@ -327,25 +468,9 @@ SimpleNodeEvent::SimpleNodeEvent(dcl::object_id id,
     SimpleEvent(id, context, event) { }
 
 void SimpleNodeEvent::onExecutionStatusChanged(cl_int executionStatus) {
-    if (!_context->computeNodes().empty()) {
-        dclasio::message::CommandExecutionStatusChangedMessage message(_id, executionStatus);
-
-        try {
-            /* Broadcast execution status to remote on other compute nodes.
-             * No message has to be sent to the host. */
-            sendMessage(_context->computeNodes(), message);
-
-            dcl::util::Logger << dcl::util::Debug
-                    << "Sent update of command execution status to compute nodes (ID=" << _id
-                    << ", status=" << executionStatus << ')'
-                    << std::endl;
-        } catch (const dcl::IOException& err) {
-            dcl::util::Logger << dcl::util::Error
-                    << "Sending update of command execution status to compute nodes failed (ID=" << _id
-                    << ", status=" << executionStatus << ')'
-                    << std::endl;
-        }
-    }
+    /* Send execution status to substitute events on other compute nodes.
+     * No message has to be sent to the host. */
+    notifySubscribers(executionStatus);
 }
 
 /* ****************************************************************************/
@@ -353,9 +478,10 @@ void SimpleNodeEvent::onExecutionStatusChanged(cl_int executionStatus) {
 CompoundEvent::CompoundEvent(dcl::object_id id,
         const std::shared_ptr<Context>& context,
         const std::shared_ptr<Memory>& memoryObject,
+        size_t offset, size_t cb,
         const cl::Event& startEvent,
         const cl::Event& endEvent) :
-    LocalEvent(id, context, memoryObject), _startEvent(startEvent),
+    LocalEvent(id, context, memoryObject, offset, cb), _startEvent(startEvent),
     _endEvent(endEvent) { }
 
 CompoundEvent::CompoundEvent(dcl::object_id id,
@@ -426,33 +552,18 @@ void ReadMemoryEvent::onExecutionStatusChanged(cl_int executionStatus) {
 WriteMemoryEvent::WriteMemoryEvent(dcl::object_id id,
         const std::shared_ptr<Context>& context,
         const std::shared_ptr<Memory>& memoryObject,
+        size_t offset, size_t cb,
         const cl::Event& startEvent,
         const cl::Event& endEvent) :
-    CompoundEvent(id, context, memoryObject, startEvent, endEvent) {
+    CompoundEvent(id, context, memoryObject, offset, cb, startEvent, endEvent) {
     /* Schedule event status update notification */
     _endEvent.setCallback(CL_COMPLETE, &onEventComplete, this);
 }
 
 void WriteMemoryEvent::onExecutionStatusChanged(cl_int executionStatus) {
-    if (!_context->computeNodes().empty()) {
-        dclasio::message::CommandExecutionStatusChangedMessage message(_id, executionStatus);
-
-        try {
-            /* Broadcast execution status to remote on other compute nodes.
-             * No message has to be sent to the host. */
-            sendMessage(_context->computeNodes(), message);
-
-            dcl::util::Logger << dcl::util::Debug
-                    << "Sent update of command execution status to compute nodes (ID=" << _id
-                    << ", status=" << executionStatus << ')'
-                    << std::endl;
-        } catch (const dcl::IOException& err) {
-            dcl::util::Logger << dcl::util::Error
-                    << "Sending update of command execution status to compute nodes failed (ID=" << _id
-                    << ", status=" << executionStatus << ')'
-                    << std::endl;
-        }
-    }
+    /* Send execution status to substitute events on other compute nodes.
+     * No message has to be sent to the host. */
+    notifySubscribers(executionStatus);
 }
 
 } /* namespace dcld */
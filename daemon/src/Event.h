@@ -58,6 +58,7 @@
 #include <CL/cl.hpp>
 #endif
 
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -74,15 +75,24 @@ class Memory;
  *
  * This wrapper associates a native event (not part of this class, hence it is
  * abstract) with a context and a list of memory objects.
+ * Optionally, the range of the memory objects which has been modified by the
+ * event's command can be specified, such that only this range is synchronized.
  */
 class Event: public dcl::Event {
 public:
     Event(
             const std::shared_ptr<Context>&               context,
             const std::vector<std::shared_ptr<Memory>>&   memoryObjects);
+    Event(
+            const std::shared_ptr<Context>&               context,
+            const std::vector<std::shared_ptr<Memory>>&   memoryObjects,
+            size_t                                        offset,
+            size_t                                        cb);
     Event(
             const std::shared_ptr<Context>& context,
-            const std::shared_ptr<Memory>&  memoryObject);
+            const std::shared_ptr<Memory>&  memoryObject,
+            size_t                          offset,
+            size_t                          cb);
     Event(
             const std::shared_ptr<Context>& context);
 
@@ -101,6 +111,17 @@ protected:
      * a command in an event wait list.
      */
     std::vector<std::shared_ptr<Memory>> _memoryObjects;
+    size_t _offset; //!< Offset of the modified range of the memory objects
+    size_t _cb; //!< Size of the modified range of the memory objects, or 0 if entire memory objects are modified
+
+    /*!
+     * \brief Returns the size of the modified range of a memory object associated with this event
+     *
+     * \param[in]  memoryObject    a memory object associated with this event
+     * \return the size of the modified range in bytes
+     */
+    size_t modifiedSize(
+            const Memory& memoryObject) const;
 
 private:
     /* Events must be non-copyable */
@@ -121,10 +142,27 @@ private:
  */
 class RemoteEvent: public dcl::Remote, public Event {
 public:
+    /*!
+     * \brief Creates a substitute for an event of another compute node.
+     *
+     * \param[in]  id             the event's ID
+     * \param[in]  context        the context associated with the event
+     * \param[in]  memoryObjects  the memory objects associated with the event
+     * \param[in]  offset         offset of the range of the memory objects
+     *             modified by the event's command
+     * \param[in]  cb             size of the modified range in bytes; if 0, the
+     *             entire memory objects are acquired
+     * \param[in]  source         the process from which changes associated with
+     *             the event are acquired; if \c NULL, they are acquired from
+     *             the context's host
+     */
     RemoteEvent(
             dcl::object_id                                id,
             const std::shared_ptr<Context>&               context,
-            const std::vector<std::shared_ptr<Memory>>&   memoryObjects);
+            const std::vector<std::shared_ptr<Memory>>&   memoryObjects,
+            size_t                                        offset,
+            size_t                                        cb,
+            dcl::Process *                                source = nullptr);
 
     operator cl::Event() const;
 
@@ -145,10 +183,21 @@ public:
             cl_profiling_info   param_name,
             cl_ulong&           param_value) const;
 
+    void onSubscribe(
+            dcl::Process& computeNode);
+
     /*
      * Command listener API
      */
 
+    /*!
+     * \brief Sets the status of the native user event
+     *
+     * The final execution status may be received twice, from the event's
+     * compute node and from the host, if the host releases the event before
+     * the status from the event's compute node has been received. Only the
+     * first status is applied.
+     */
     void onExecutionStatusChanged(
             cl_int executionStatus);
 
@@ -161,6 +210,9 @@ public:
 
 private:
     cl::UserEvent _event; //!< Native user event
+    bool _complete; //!< true, if the final execution status has been set
+    std::mutex _statusMutex; //!< Mutex for execution status
+    dcl::Process *_source; //!< Process from which changes are acquired, or NULL for the host
     std::vector<cl::Event> _syncEvents; //!< Native events used for synchronization
     mutable std::mutex _syncMutex; //!< Mutex for synchronization event list
 };
@@ -186,13 +238,22 @@ public:
     LocalEvent(
             dcl::object_id                  id,
             const std::shared_ptr<Context>& context,
-            const std::shared_ptr<Memory>&  memoryObject);
+            const std::shared_ptr<Memory>&  memoryObject,
+            size_t                          offset,
+            size_t                          cb);
     LocalEvent(
             dcl::object_id                  id,
             const std::shared_ptr<Context>& context);
 
     ~LocalEvent();
 
+    /*
+     * Event API
+     */
+
+    void onSubscribe(
+            dcl::Process& computeNode);
+
     /*
      * Synchronization listener API
      */
@@ -201,7 +262,23 @@ public:
             dcl::Process& process);
 
 protected:
+    /*!
+     * \brief Sends the final execution status to the subscribed compute nodes
+     *
+     * Compute nodes which subscribe later are sent the status when subscribing.
+     *
+     * \param[in]  executionStatus the final command execution status
+     */
+    void notifySubscribers(
+            cl_int executionStatus);
+
     cl_ulong _received; //!< Receipt time of associated command
+
+private:
+    std::vector<dcl::Process *> _subscribers; //!< Compute nodes which hold a substitute event
+    bool _complete; //!< true, if the final execution status has been sent to subscribers
+    cl_int _executionStatus; //!< Final execution status
+    std::mutex _subscribersMutex; //!< Mutex for subscribers
 };
 
 /* ****************************************************************************/
@@ -210,8 +287,9 @@ protected:
  * \brief A decorator for a single native event.
  *
  * This is a basic implementation of the LocalEvent class. It forwards API
- * calls to its native events and broadcasts a 'command complete' message when
- * the command associated with this event is completed or terminated.
+ * calls to its native events and sends a 'command complete' message to the
+ * host and to the subscribed compute nodes when the command associated with
+ * this event is completed or terminated.
  */
 class SimpleEvent: public LocalEvent {
 public:
@@ -227,6 +305,8 @@ public:
             dcl::object_id                  id,
             const std::shared_ptr<Context>& context,
             const std::shared_ptr<Memory>&  memoryObject,
+            size_t                          offset,
+            size_t                          cb,
             const cl::Event&                event);
     SimpleEvent(
             dcl::object_id                  id,
@@ -258,7 +338,7 @@ private:
 
 /*!
  * This is an implementation of the SimpleEvent class which sends a 'command
- * complete' message to other compute nodes, but *not* to the host. This message
+ * complete' message to subscribed compute nodes, but *not* to the host. This message
  * is sent to the host by the mechanism that implements the associated command,
  * while this event is only responsible for sending the message to other compute
  * nodes.
@@ -300,6 +380,8 @@ public:
             dcl::object_id                  id,
             const std::shared_ptr<Context>& context,
             const std::shared_ptr<Memory>&  memoryObject,
+            size_t                          offset,
+            size_t                          cb,
             const cl::Event&                startEvent,
             const cl::Event&                endEvent);
     CompoundEvent(
@@ -362,7 +444,7 @@ public:
  * \brief A compound event associated with a write buffer or write image command.
  *
  * This is an implementation of the CompoundEvent class which sends a 'command
- * complete' message to other compute nodes, but *not* to the host. This message
+ * complete' message to subscribed compute nodes, but *not* to the host. This message
  * is sent to the host by the mechanism that implements the 'write memory
  * object' command while this event is only responsible for sending the message
  * to other compute nodes.
@@ -373,6 +455,8 @@ public:
             dcl::object_id                  id,
             const std::shared_ptr<Context>& context,
             const std::shared_ptr<Memory>&  memoryObject,
+            size_t                          offset,
+            size_t                          cb,
             const cl::Event&                startEvent,
             const cl::Event&                endEvent);
 
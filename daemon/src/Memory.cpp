@@ -44,12 +44,15 @@
 #include "Memory.h"
 
 #include "Context.h"
+#include "StagingPool.h"
 
 #include <dcl/DataTransfer.h>
 #include <dcl/DCLException.h>
 #include <dcl/Process.h>
 
+#include <dcl/util/Clock.h>
 #include <dcl/util/Logger.h>
+#include <dcl/util/Trace.h>
 
 #define __CL_ENABLE_EXCEPTIONS
 #ifdef __APPLE__
@@ -71,8 +74,9 @@ namespace {
 struct ExecData {
     dcl::Process *process;
     size_t size;
-    void *ptr;
+    std::shared_ptr<dcld::StagingBuffer> staging;
     cl::UserEvent event;
+    cl_ulong start; //!< time of starting the acquire or release operation
 };
 
 void execAcquire(cl_event event, cl_int execution_status, void *user_data) {
@@ -88,9 +92,16 @@ void execAcquire(cl_event event, cl_int execution_status, void *user_data) {
                 << std::endl;
 
         try {
-            auto recv = syncData->process->receiveData(syncData->size, syncData->ptr);
-            recv->setCallback(
-                    std::bind(&cl::UserEvent::setStatus, syncData->event, std::placeholders::_1));
+            auto recv = syncData->process->receiveData(syncData->size, syncData->staging->ptr(),
+                    dcl::DataTransfer::Priority::BACKGROUND);
+            cl::UserEvent dataReceipt(syncData->event);
+            size_t size = syncData->size;
+            cl_ulong start = syncData->start;
+            recv->setCallback([dataReceipt, size, start](cl_int status) mutable {
+                dcl::util::tracer.record("Acquire", "consistency", start,
+                        dcl::util::clock.getTime(), size);
+                dataReceipt.setStatus(status);
+            });
         } catch (const dcl::IOException& e) {
             dcl::util::Logger << dcl::util::Error
                     << "Data receipt failed: " << e.what() << std::endl;
@@ -118,20 +129,29 @@ void execRelease(cl_event event, cl_int execution_status, void *user_data) {
                 << std::endl;
 
         try {
-            auto send = syncData->process->sendData(syncData->size, syncData->ptr);
-            send->setCallback(
-                    std::bind(&cl::UserEvent::setStatus, syncData->event, std::placeholders::_1));
+            /* The callback retains the staging buffer until the data has been sent */
+            auto staging = syncData->staging;
+            size_t size = syncData->size;
+            cl_ulong start = syncData->start;
+            auto send = syncData->process->sendData(syncData->size, staging->ptr(),
+                    dcl::DataTransfer::Priority::BACKGROUND);
+            send->setCallback([staging, size, start](cl_int status) {
+                dcl::util::tracer.record("Release", "consistency", start,
+                        dcl::util::clock.getTime(), size);
+                if (status != CL_SUCCESS) {
+                    dcl::util::Logger << dcl::util::Error
+                            << "(SYN) Releasing memory object data failed"
+                            << std::endl;
+                }
+            });
         } catch (const dcl::IOException& e) {
             dcl::util::Logger << dcl::util::Error
                     << "Data sending failed: " << e.what() << std::endl;
-            syncData->event.setStatus(CL_IO_ERROR_WWU);
         }
     } else {
         dcl::util::Logger << dcl::util::Error
                 << "(SYN) Releasing memory object data failed"
                 << std::endl;
-
-        syncData->event.setStatus(execution_status);
     }
 }
 
@@ -212,83 +232,78 @@ Buffer::operator cl::Buffer() const {
 void Buffer::acquire(
         dcl::Process& process,
         const cl::CommandQueue& commandQueue,
+        size_t offset, size_t cb,
         const cl::Event& releaseEvent,
         cl::Event *acquireEvent) {
-    cl::Event mapEvent;
+    cl::Event writeEvent;
     cl::UserEvent dataReceipt(*_context);
 
     dcl::util::Logger << dcl::util::Debug
-            << "(SYN) Acquiring buffer from process '" << process.url() << '\''
+            << "(SYN) Acquiring buffer range [" << offset << ", " << offset + cb
+            << ") from process '" << process.url() << '\''
             << std::endl;
 
-    /* map buffer to host memory when releaseEvent is complete */
-    VECTOR_CLASS<cl::Event> mapWaitList(1, releaseEvent);
-    void *ptr = commandQueue.enqueueMapBuffer(
+    auto staging = _context->stagingPool().allocate(cb);
+
+    /* write buffer range from staging buffer when acquire operation is complete */
+    VECTOR_CLASS<cl::Event> writeWaitList(1, dataReceipt);
+    commandQueue.enqueueWriteBuffer(
             _buffer,
             CL_FALSE,
-            CL_MAP_WRITE,
-            0, size(),
-            &mapWaitList, &mapEvent);
+            offset, cb,
+            staging->ptr(),
+            &writeWaitList, &writeEvent);
+    staging->retainUntil(writeEvent);
+    if (acquireEvent) *acquireEvent = writeEvent;
 
     auto syncData = new ExecData;
     syncData->process = &process;
-    syncData->size    = size();
-    syncData->ptr     = ptr;
+    syncData->size    = cb;
+    syncData->staging = staging;
     syncData->event   = dataReceipt;
+    syncData->start   = dcl::util::clock.getTime();
 
-    /* receive buffer data when mapping is complete */
-    mapEvent.setCallback(CL_COMPLETE, &execAcquire, syncData);
+    /* receive buffer data into staging buffer when releaseEvent is complete */
+    cl::Event(releaseEvent).setCallback(CL_COMPLETE, &execAcquire, syncData);
 
     /* WARNING: do not use syncData after this point, as the callback of
-     *          mapEvent deletes it concurrently */
-
-    /* unmap buffer when acquire operation is complete */
-    VECTOR_CLASS<cl::Event> unmapWaitList(1, dataReceipt);
-    commandQueue.enqueueUnmapMemObject(
-            _buffer,
-            ptr,
-            &unmapWaitList, acquireEvent);
+     *          releaseEvent deletes it concurrently */
 }
 
 void Buffer::release(
         dcl::Process& process,
         const cl::CommandQueue& commandQueue,
+        size_t offset, size_t cb,
         const cl::Event& releaseEvent) const {
-    cl::Event mapEvent;
-    cl::UserEvent dataSending(*_context);
+    cl::Event readEvent;
 
     dcl::util::Logger << dcl::util::Debug
-            << "(SYN) Releasing buffer to process '" << process.url() << '\''
+            << "(SYN) Releasing buffer range [" << offset << ", " << offset + cb
+            << ") to process '" << process.url() << '\''
             << std::endl;
 
-    /* map buffer when releaseEvent is complete */
-    VECTOR_CLASS<cl::Event> mapWaitList(1, releaseEvent);
-    void *ptr = commandQueue.enqueueMapBuffer(
+    auto staging = _context->stagingPool().allocate(cb);
+
+    /* read buffer range into staging buffer when releaseEvent is complete */
+    VECTOR_CLASS<cl::Event> readWaitList(1, releaseEvent);
+    commandQueue.enqueueReadBuffer(
             _buffer,
             CL_FALSE,
-            CL_MAP_READ,
-            0, size(),
-            &mapWaitList, &mapEvent
-    );
+            offset, cb,
+            staging->ptr(),
+            &readWaitList, &readEvent);
 
     auto syncData = new ExecData;
     syncData->process = &process;
-    syncData->size    = size();
-    syncData->ptr     = ptr;
-    syncData->event   = dataSending;
+    syncData->size    = cb;
+    syncData->staging = staging;
+    syncData->start   = dcl::util::clock.getTime();
 
-    /* send buffer data when mapping is complete */
-    mapEvent.setCallback(CL_COMPLETE, &execRelease, syncData);
+    /* send buffer data when reading is complete */
+    readEvent.setCallback(CL_COMPLETE, &execRelease, syncData);
 
     /* WARNING: do not use syncData after this point, as the callback of
-     *          mapEvent deletes it concurrently */
-
-    /* unmap buffer when acquire operation is complete */
-    VECTOR_CLASS<cl::Event> unmapWaitList(1, dataSending);
-    commandQueue.enqueueUnmapMemObject(
-            _buffer,
-            ptr,
-            &unmapWaitList, nullptr);
+     *          readEvent deletes it concurrently */
 }
 
 } /* namespace dcld */
@@ -102,12 +102,16 @@ public:
      *
      * \param[in]  process      the process from which the changes should be acquired
      * \param[in]  commandQueue command queue for uploading the received data
+     * \param[in]  offset       offset of the range of this memory object to be acquired
+     * \param[in]  cb           size of the range to be acquired in bytes
      * \param[in]  releaseEvent event that releases the changes to be acquired
      * \param[out] acquireEvent event associated with this acquire operation
      */
     virtual void acquire(
             dcl::Process&           process,
             const cl::CommandQueue& commandQueue,
+            size_t                  offset,
+            size_t                  cb,
             const cl::Event&        releaseEvent,
             cl::Event *             acquireEvent) = 0;
 
@@ -116,16 +120,22 @@ public:
      *
      * The updated data of this memory object are sent to the requesting \c process.
      * \c commandQueue is used to obtain the data from the local OpenCL implementation.
+     * Only the range of this memory object which has been modified by the
+     * command associated with \c releaseEvent is sent.
      *
      * \param[in]  process      the process that requested the acquire operation
      * \param[in]  commandQueue command queue for downloading data before
      *                          sending
+     * \param[in]  offset       offset of the range of this memory object to be released
+     * \param[in]  cb           size of the range to be released in bytes
      * \param[in]  releaseEvent event associated with the operation that
      *                          releases the changes to be acquired
      */
     virtual void release(
             dcl::Process&           process,
             const cl::CommandQueue& commandQueue,
+            size_t                  offset,
+            size_t                  cb,
             const cl::Event&        releaseEvent) const = 0;
 
 protected:
@@ -161,12 +171,16 @@ public:
     void acquire(
             dcl::Process&           process,
             const cl::CommandQueue& commandQueue,
+            size_t                  offset,
+            size_t                  cb,
             const cl::Event&        releaseEvent,
             cl::Event *             acquireEvent);
 
     void release(
             dcl::Process&           process,
             const cl::CommandQueue& commandQueue,
+            size_t                  offset,
+            size_t                  cb,
             const cl::Event&        releaseEvent) const;
 
 private:
@@ -214,7 +214,9 @@ void Session::addEvent(
 std::shared_ptr<dcl::Event> Session::createEvent(
         dcl::object_id id,
         const std::shared_ptr<dcl::Context>& context,
-        const std::vector<std::shared_ptr<dcl::Memory>>& memoryObjects) {
+        const std::vector<std::shared_ptr<dcl::Memory>>& memoryObjects,
+        size_t offset, size_t cb,
+        dcl::ComputeNode *computeNode) {
     std::vector<std::shared_ptr<Memory>> memoryObjectImpls;
 
     /* Verify memory objects */
@@ -230,7 +232,8 @@ std::shared_ptr<dcl::Event> Session::createEvent(
      * substitute event is controlled by messages about execution status changes
      * of its associated command. */
     auto event = std::make_shared<RemoteEvent>(
-            id, std::dynamic_pointer_cast<Context>(context), memoryObjectImpls);
+            id, std::dynamic_pointer_cast<Context>(context), memoryObjectImpls,
+            offset, cb, computeNode);
     /* Add event to list */
     _events.insert(event);
 
@@ -138,7 +138,10 @@ public:
 	std::shared_ptr<dcl::Event> createEvent(
             dcl::object_id                                      id,
             const std::shared_ptr<dcl::Context>&                context,
-            const std::vector<std::shared_ptr<dcl::Memory>>&    memoryObjects);
+            const std::vector<std::shared_ptr<dcl::Memory>>&    memoryObjects,
+            size_t                                              offset,
+            size_t                                              cb,
+            dcl::ComputeNode *                                  computeNode);
 	void releaseEvent(
 	        const std::shared_ptr<dcl::Event>& event);
 
@@ -0,0 +1,205 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file StagingPool.cpp
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include "StagingPool.h"
+
+#include <dcl/util/Environment.h>
+#include <dcl/util/Logger.h>
+
+#define __CL_ENABLE_EXCEPTIONS
+#ifdef __APPLE__
+#include <OpenCL/cl.hpp>
+#else
+#include <CL/cl.hpp>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+namespace {
+
+/*!
+ * \brief Returns the capacity of staging pools
+ *
+ * The capacity is set in bytes by the environment variable
+ * DCL_STAGING_POOL_SIZE. If it is set to 0, memory regions are not reused.
+ */
+size_t stagingPoolCapacity() {
+    static const size_t capacity = dcl::util::getEnvSize(
+            "DCL_STAGING_POOL_SIZE", dcld::StagingPool::DEFAULT_CAPACITY);
+    return capacity;
+}
+
+/*!
+ * \brief Callback used to release a staging buffer.
+ *
+ * Deleting the reference passed as \c user_data releases the staging buffer.
+ */
+void releaseStagingBuffer(cl_event /* event */, cl_int /* execution_status */, void *user_data) {
+    assert(user_data != nullptr);
+    delete static_cast<std::shared_ptr<dcld::StagingBuffer> *>(user_data);
+}
+
+} /* unnamed namespace */
+
+/* ****************************************************************************/
+
+namespace dcld {
+
+StagingBuffer::StagingBuffer(
+        const std::shared_ptr<StagingPool>& pool,
+        size_t sizeClass,
+        const cl::Buffer& buffer,
+        void *ptr) :
+    _pool(pool), _sizeClass(sizeClass), _buffer(buffer), _ptr(ptr) {
+}
+
+StagingBuffer::~StagingBuffer() {
+    _pool->release(_sizeClass, _buffer, _ptr);
+}
+
+char * StagingBuffer::ptr() const {
+    return static_cast<char *>(_ptr);
+}
+
+void StagingBuffer::retainUntil(cl::Event event) {
+    event.setCallback(CL_COMPLETE, &releaseStagingBuffer,
+            new std::shared_ptr<StagingBuffer>(shared_from_this()));
+}
+
+/* ****************************************************************************/
+
+const size_t StagingPool::MIN_SIZE_CLASS;
+const size_t StagingPool::DEFAULT_CAPACITY;
+
+StagingPool::StagingPool(
+        const cl::Context& context,
+        const cl::Device& device) :
+    _context(context), _commandQueue(context, device),
+    _capacity(stagingPoolCapacity()), _size(0) {
+}
+
+StagingPool::~StagingPool() {
+    try {
+        for (auto& sizeClass : _regions) {
+            for (auto& region : sizeClass.second) {
+                _commandQueue.enqueueUnmapMemObject(region.buffer, region.ptr);
+            }
+        }
+        _commandQueue.flush();
+    } catch (const cl::Error& err) {
+        dcl::util::Logger << dcl::util::Error
+                << "OpenCL error (ID=" << err.err() << "): " << err.what()
+                << std::endl;
+    }
+}
+
+std::shared_ptr<StagingBuffer> StagingPool::allocate(
+        size_t size) {
+    size_t sizeClass = MIN_SIZE_CLASS;
+    Region region;
+
+    /* Round size up to the next power of two
+     * Memory regions which exceed the pool's capacity are never reused and
+     * thus not rounded */
+    while (sizeClass < size && (sizeClass << 1) > sizeClass) sizeClass <<= 1;
+    if (sizeClass < size || sizeClass > _capacity) sizeClass = std::max(size, MIN_SIZE_CLASS);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto i = _regions.find(sizeClass);
+        if (i != std::end(_regions) && !i->second.empty()) {
+            region = i->second.back();
+            i->second.pop_back();
+            _size -= sizeClass;
+
+            return std::shared_ptr<StagingBuffer>(new StagingBuffer(
+                    shared_from_this(), sizeClass, region.buffer, region.ptr));
+        }
+    }
+
+    /* Allocate and pin a new memory region */
+    region.buffer = cl::Buffer(_context,
+            CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, sizeClass);
+    region.ptr = _commandQueue.enqueueMapBuffer(region.buffer, CL_TRUE,
+            CL_MAP_READ | CL_MAP_WRITE, 0, sizeClass);
+
+    dcl::util::Logger << dcl::util::Debug
+            << "Allocated staging buffer (size=" << sizeClass << ')'
+            << std::endl;
+
+    return std::shared_ptr<StagingBuffer>(new StagingBuffer(
+            shared_from_this(), sizeClass, region.buffer, region.ptr));
+}
+
+void StagingPool::release(
+        size_t sizeClass,
+        const cl::Buffer& buffer,
+        void *ptr) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_size + sizeClass <= _capacity) {
+            Region region = { buffer, ptr };
+            _regions[sizeClass].push_back(region);
+            _size += sizeClass;
+            return;
+        }
+    }
+
+    /* Pool is full: release memory region */
+    try {
+        _commandQueue.enqueueUnmapMemObject(buffer, ptr);
+        _commandQueue.flush();
+    } catch (const cl::Error& err) {
+        dcl::util::Logger << dcl::util::Error
+                << "OpenCL error (ID=" << err.err() << "): " << err.what()
+                << std::endl;
+    }
+}
+
+} /* namespace dcld */
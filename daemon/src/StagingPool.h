@@ -0,0 +1,185 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file StagingPool.h
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#ifndef STAGINGPOOL_H_
+#define STAGINGPOOL_H_
+
+#define __CL_ENABLE_EXCEPTIONS
+#ifdef __APPLE__
+#include <OpenCL/cl.hpp>
+#else
+#include <CL/cl.hpp>
+#endif
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace dcld {
+
+class StagingPool;
+
+/* ****************************************************************************/
+
+/*!
+ * \brief A page-locked host memory region leased from a staging pool.
+ *
+ * Data is received from the network into a staging buffer, and written from
+ * it to a device (or vice versa). The memory region is returned to its pool
+ * when the staging buffer is deleted.
+ */
+class StagingBuffer : public std::enable_shared_from_this<StagingBuffer> {
+public:
+    ~StagingBuffer();
+
+    /*!
+     * \brief Returns a pointer to the staging buffer's memory region
+     */
+    char * ptr() const;
+
+    /*!
+     * \brief Keeps this staging buffer alive until a native event is complete
+     *
+     * This method must be used to keep the staging buffer alive while a
+     * non-blocking read or write command accesses it.
+     *
+     * \param[in]  event    the event to wait for
+     */
+    void retainUntil(
+            cl::Event event);
+
+private:
+    friend class StagingPool;
+
+    StagingBuffer(
+            const std::shared_ptr<StagingPool>& pool,
+            size_t                              sizeClass,
+            const cl::Buffer&                   buffer,
+            void *                              ptr);
+
+    /* Staging buffers must be non-copyable */
+    StagingBuffer(
+            const StagingBuffer& rhs) = delete;
+    StagingBuffer& operator=(
+            const StagingBuffer& rhs) = delete;
+
+    std::shared_ptr<StagingPool> _pool; //!< Pool which the memory region is returned to
+    size_t _sizeClass; //!< Size of the memory region
+    cl::Buffer _buffer; //!< Native buffer which provides the memory region
+    void *_ptr; //!< Mapped memory region
+};
+
+/* ****************************************************************************/
+
+/*!
+ * \brief A pool of page-locked host memory regions for data transfers.
+ *
+ * Each memory region is provided by a native buffer allocated with
+ * CL_MEM_ALLOC_HOST_PTR, which is mapped once, such that it is pinned by most
+ * OpenCL implementations. Memory regions are allocated in size classes of
+ * powers of two and reused, such that a data transfer does not allocate or
+ * pin memory. Unused memory regions are retained up to the pool's capacity.
+ */
+class StagingPool : public std::enable_shared_from_this<StagingPool> {
+public:
+    /*!
+     * \brief Creates a staging pool
+     *
+     * The capacity of the pool is set in bytes by the environment variable
+     * DCL_STAGING_POOL_SIZE.
+     *
+     * \param[in]  context  the context in which memory regions are allocated
+     * \param[in]  device   the device used to map memory regions
+     */
+    StagingPool(
+            const cl::Context&  context,
+            const cl::Device&   device);
+    virtual ~StagingPool();
+
+    /*!
+     * \brief Leases a staging buffer from this pool
+     *
+     * \param[in]  size the minimum size of the staging buffer in bytes
+     * \return a staging buffer
+     */
+    std::shared_ptr<StagingBuffer> allocate(
+            size_t size);
+
+    static const size_t MIN_SIZE_CLASS = 64 * 1024; //!< smallest size class: 64 KiB
+    static const size_t DEFAULT_CAPACITY = 256 * 1024 * 1024; //!< default capacity: 256 MiB
+
+private:
+    friend class StagingBuffer;
+
+    struct Region {
+        cl::Buffer buffer;
+        void *ptr;
+    };
+
+    /* Staging pools must be non-copyable */
+    StagingPool(
+            const StagingPool& rhs) = delete;
+    StagingPool& operator=(
+            const StagingPool& rhs) = delete;
+
+    /*!
+     * \brief Returns a memory region to this pool
+     */
+    void release(
+            size_t              sizeClass,
+            const cl::Buffer&   buffer,
+            void *              ptr);
+
+    cl::Context _context;
+    cl::CommandQueue _commandQueue; //!< Command queue for mapping memory regions
+    size_t _capacity; //!< Maximum size of unused memory regions in bytes
+    size_t _size; //!< Size of unused memory regions in bytes
+    std::map<size_t, std::vector<Region>> _regions; //!< Unused memory regions per size class
+    std::mutex _mutex; //!< Protects unused memory regions
+};
+
+} /* namespace dcld */
+
+#endif /* STAGINGPOOL_H_ */
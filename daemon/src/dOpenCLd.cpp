@@ -197,8 +197,9 @@ cl::Platform getPlatform(const std::string *platformName) {
 
 namespace dcld {
 
-dOpenCLd::dOpenCLd(const std::string& url, const std::string *platform) :
-	_communicationManager(dcl::ComputeNodeCommunicationManager::create(url)),
+dOpenCLd::dOpenCLd(const std::string& url, const std::string *platform,
+        unsigned int numThreads) :
+	_communicationManager(dcl::ComputeNodeCommunicationManager::create(url, numThreads)),
     _platform(getPlatform(platform)) {
     initializeDevices();
 }
@@ -329,8 +330,11 @@ void dOpenCLd::disconnected(dcl::Host& host) {
 }
 
 bool dOpenCLd::connected(dcl::ComputeNode& computeNode) {
-	/* TODO Implement dOpenCLd::connected for compute nodes */
-	return false;
+	/* Other compute nodes connect to this compute node to acquire changes
+	 * of memory objects directly, i.e., without passing them through the host */
+	dcl::util::Logger << dcl::util::Info
+			<< "Compute node connected (url='" << computeNode.url() << "')" << std::endl;
+	return true;
 }
 
 void dOpenCLd::disconnected(dcl::ComputeNode& computeNode) {
@@ -83,10 +83,13 @@ public:
      * \param[in]  url          URL which the daemon should bind to
      * \param[in]  platformName name of the platform which the daemon should attach to
      *             If platformName is \c NULL, the first platform available will be used.
+     * \param[in]  numThreads   number of threads used to execute requests
+     *             If numThreads is 0, one thread per hardware thread will be used.
      */
 	dOpenCLd(
 			const std::string& url,
-			const std::string *platform = nullptr);
+			const std::string *platform = nullptr,
+			unsigned int numThreads = 0);
 	virtual ~dOpenCLd();
 
 	/*!
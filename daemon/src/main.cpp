@@ -101,6 +101,7 @@ int main(int argc, char **argv) {
     boost::program_options::variables_map vm;
 	std::string platform;
 	std::string url;
+	unsigned int numThreads = 0;
 
 	try {
 	    boost::program_options::options_description options("Allowed options");
@@ -113,6 +114,8 @@ int main(int argc, char **argv) {
             ("help", "produce help message")
             ("platform,p", boost::program_options::value<std::string>(&platform),
                     "OpenCL platform to use")
+            ("threads,t", boost::program_options::value<unsigned int>(&numThreads),
+                    "number of threads executing requests (default: number of hardware threads)")
             ;
         arguments.add_options()
             ("hostname", boost::program_options::value<std::string>(&url),
@@ -236,7 +239,8 @@ int main(int argc, char **argv) {
     try {
         // create daemon instance
         dcl_daemon.reset(new dcld::dOpenCLd(url,
-                (vm.count("platform") ? &platform : nullptr)));
+                (vm.count("platform") ? &platform : nullptr),
+                numThreads));
 		dcl_daemon->run();
 		dcl_daemon.reset(); // destroy daemon
 	} catch (const dcl::DCLException& err) {
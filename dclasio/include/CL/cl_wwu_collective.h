@@ -81,13 +81,17 @@ extern "C"
  * where the same host memory is copied to multiple destination buffers.
  * A command queue has to be specified for each destination buffer in order to
  * determine the device where the buffer is migrated to.
- * Upload is performed in two steps: 1) upload host memory to compute node;
- * 2) upload data to buffers using clEnqueueWriteBuffer.
+ * The host memory is read and uploaded only once: the compute nodes of the
+ * command queues form a chain, where the host memory is uploaded to the first
+ * compute node, and each compute node forwards the data chunk by chunk to the
+ * next compute node while still receiving it. On each compute node, the data
+ * is copied to all destination buffers on that compute node.
+ * The host memory must not be modified until the command is complete.
  *
  * @param[in]  command_queue_list  a list of command queues
  * @param[in]  num_buffers         number of destination buffers
  * @param[in]  buffer_list         the buffers to broadcast to (receive buffers)
- * @param[in]  offsets
+ * @param[in]  offsets             offsets of the destination buffer ranges, or NULL
  * @param[in]  cb                  the number of bytes to broadcast
  * @param[in]  ptr                 pointer to host memory that should be broadcasted
  * @param[in]  num_events_in_wait_list
@@ -145,6 +149,11 @@ clEnqueueBroadcastBufferWWU(
 /**
  * @brief Reduces a set of buffers into a single buffer
  *
+ * The source buffers are reduced pairwise along a tree of the compute nodes
+ * that hold them. Partial results are exchanged between compute nodes
+ * directly, and only the final result is written to the destination buffer.
+ * The source buffers are not modified.
+ *
  * @param[in]  command_queue        command queue for writing destination buffer
  * @param[in]  num_src_buffers      number of buffers to reduce
  * @param[in]  src_buffer_list      the buffers to reduce (send buffers)
@@ -152,7 +161,11 @@ clEnqueueBroadcastBufferWWU(
  * @param[in]  kernel               a kernel for reducing two buffers
  *             This kernel must accept at least two arguments, but may also use
  *             more. The two mandatory arguments must be CL_KERNEL_ARG_1 and
- *             CL_KERNEL_ARG_2.
+ *             CL_KERNEL_ARG_2, i.e., the first and second argument. The kernel
+ *             must combine the second buffer into the first one. All other
+ *             arguments must be set before the reduction is enqueued. The
+ *             sizes of all buffers must be equal to the destination buffer's
+ *             size.
  * @param[in]  work_dim
  * @param[in]  global_work_offset
  * @param[in]  global_work_size
@@ -115,6 +115,10 @@ typedef intptr_t    cl_device_properties_WWU;
 /* cl_device_info */
 #define CL_DEVICE_COMPUTE_NODE_WWU                     0x1040
 
+/* cl_mem_info */
+#define CL_MEM_COHERENCE_HITS_WWU                      0x1180
+#define CL_MEM_COHERENCE_MISSES_WWU                    0x1181
+
 #ifndef CL_VERSION_1_2
 /* cl_program_info */
 /* Provide CL_PROGRAM_NUM_KERNELS for forward compatibility of OpenCL 1.1 */
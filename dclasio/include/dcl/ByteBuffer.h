@@ -57,11 +57,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -81,6 +83,12 @@ template<> struct serialization<cl_ulong>  { static const size_t size = sizeof(c
 template<> struct serialization<float>     { static const size_t size = sizeof(float);     }; // 32 bit
 template<> struct serialization<double>    { static const size_t size = sizeof(double);    }; // 64 bit
 
+/*!
+ * \brief Type trait for types whose vectors can be serialized as a single block of memory
+ */
+template<typename T> struct is_contiguously_serializable : std::integral_constant<bool,
+        std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> { };
+
 } // anonymous namespace
 
 /* ****************************************************************************/
@@ -99,6 +107,15 @@ namespace dcl {
  * Deserialization is *not* type-safe, i.e., it is the caller's responsibility
  * to extract serialized data correctly.
  * This class is not thread-safe for performance reasons.
+ *
+ * The buffer's memory is allocated from a thread-local pool of recycled
+ * blocks, such that creating and growing buffers usually does not allocate
+ * heap memory.
+ *
+ * A buffer can be set up to serialize large values (strings, binaries, and
+ * vectors of arithmetic types) without copying (see set_gather_threshold).
+ * The buffer then only references these values, and its content must be
+ * obtained as a list of memory segments (see segments).
  */
 class ByteBuffer {
 public:
@@ -109,38 +126,123 @@ public:
     typedef const value_type * const_pointer;
     typedef value_type * iterator;
     typedef const value_type * const_iterator;
+    typedef std::pair<const_pointer, size_type> segment_type; //!< a contiguous part of the buffer's content
 
     const static size_type DEFAULT_SIZE = 512; //!< default buffer size in bytes
-    const static size_type DEFAULT_MAX_SIZE = 65536; //!< default maximum buffer size in bytes
 
 private:
+    /*!
+     * \brief Deleter which returns a block to the block pool of the calling thread
+     */
+    struct block_deleter {
+        block_deleter() : capacity(0) { }
+        block_deleter(
+                size_type capacity_) : capacity(capacity_) { }
+
+        void operator()(
+                value_type *block) const;
+
+        size_type capacity; //!< size of a pooled block, or 0 if the block has not been allocated from the pool
+    };
+
+    typedef std::unique_ptr<value_type[], block_deleter> block_type;
+
+    /*!
+     * \brief Obtains a block of at least the specified size from the block pool
+     * \param[in]  size the minimum block size
+     * \return a block; its size is returned by block.get_deleter().capacity
+     */
+    static block_type allocate_block(
+            size_type size);
+
+    /*!
+     * \brief A value that is referenced rather than copied into the buffer
+     */
+    struct reference_type {
+        size_type offset; //!< position of the value within the buffer's own bytes
+        const_pointer data;
+        size_type size;
+    };
+
     /*!
      * \brief Resizes the buffer to the specified internal size.
      * \param[in]  size the new internal buffer size
      * \throw std::out_of_range if \c size exceeds max_size
      */
-    inline void reserve(
-            size_type size) {
-        if (size > _max_size) throw std::out_of_range("Internal buffer overflow");
-        if (size <= _size) return; // no operation
-        /* TODO Resize buffer
-         * First, try to recover memory of read bytes just by moving content to beginning
-         * If this does not provide enough space, increase buffer size before moving content bytes to beginning */
-        assert(!"resize not implemented");
-    }
+    void reserve(
+            size_type size);
 
     /*!
      * \brief Ensures that at least \c size bytes can be written to the buffer
      * \param[in]  free the number of bytes to write
+     * \throw std::out_of_range if the buffer would exceed max_size
      */
     inline void ensure_free(
             size_type free) {
+        if (free > _max_size - _len) throw std::out_of_range("Internal buffer overflow");
         auto size = _len + free;
         if (size > _size) { // ensure required buffer size
-            while (size < _size) {
-                size *= 2; // double buffer size
+            auto new_size = std::max(_size, size_type(DEFAULT_SIZE));
+            while (new_size < size) {
+                if (new_size > _max_size / 2) {
+                    new_size = _max_size;
+                    break;
+                }
+                new_size *= 2; // double buffer size
             }
-            reserve(std::max(std::min(size, _max_size), free));
+            reserve(new_size);
+        }
+    }
+
+    /*!
+     * \brief Writes raw bytes to the buffer
+     * The bytes are only referenced, if their number exceeds the gather threshold.
+     * \param[in]  data the bytes to write
+     * \param[in]  size the number of bytes to write
+     */
+    void write(
+            const void *data,
+            size_type size);
+
+    /*!
+     * \brief Reads raw bytes from the buffer
+     * \param[out] data the location to copy the bytes to
+     * \param[in]  size the number of bytes to read
+     */
+    void read(
+            void *data,
+            size_type size);
+
+    template<typename T>
+    void write_values(
+            const std::vector<T>& values,
+            std::true_type) {
+        write(values.data(), values.size() * serialization<T>::size);
+    }
+
+    template<typename T>
+    void write_values(
+            const std::vector<T>& values,
+            std::false_type) {
+        for (const auto& value : values) {
+            operator<<(value);
+        }
+    }
+
+    template<typename T>
+    void read_values(
+            std::vector<T>& values,
+            std::true_type) {
+        read(values.data(), values.size() * serialization<T>::size);
+    }
+
+    template<typename T>
+    void read_values(
+            std::vector<T>& values,
+            std::false_type) {
+        for (auto& value : values) {
+            // remove const qualifier from value to update it from byte buffer
+            operator>>(const_cast<typename std::remove_const<decltype(value)>::type>(value));
         }
     }
 
@@ -178,20 +280,44 @@ public:
             ByteBuffer&& other);
     virtual ~ByteBuffer();
 
+    /*!
+     * \brief Creates a read-only buffer from raw bytes without copying them
+     * The buffer does *not* become owner of the bytes, such that the bytes
+     * must remain valid as long as the buffer is used.
+     * \param[in]  size     the number of bytes
+     * \param[in]  bytes    the raw bytes
+     * \return a buffer that refers to the bytes
+     */
+    static ByteBuffer view(
+            size_type size,
+            const value_type *bytes);
+
     /*!
      * \brief Restricts the buffer's maximum size to the specified value
+     * By default, the buffer's size is not limited.
      * \param[in]  max_size the buffer's maximum size
      */
     void set_max_size(
             size_type max_size);
 
+    /*!
+     * \brief Enables serialization of large values without copying them
+     * Strings, binaries, and vectors of arithmetic types which comprise at
+     * least \c threshold bytes are referenced rather than copied into the
+     * buffer. Such values must neither be modified nor destroyed as long as
+     * the buffer is used.
+     * \param[in]  threshold    the minimum size of referenced values in bytes
+     */
+    void set_gather_threshold(
+            size_type threshold);
+
     template<typename T>
     ByteBuffer& operator<<(
             const T& value) {
         ensure_free(serialization<T>::size);
         // TODO Convert to network byte order
         // TODO Use std::copy
-        memcpy(_bytes.get() + _len, &value, serialization<T>::size);
+        memcpy(_data + _len, &value, serialization<T>::size);
         _len += serialization<T>::size;
         return *this;
     }
@@ -216,9 +342,7 @@ public:
     ByteBuffer& operator<<(
             const std::vector<T>& values) {
         operator<<(values.size()); // write number of elements
-        for (const auto& value : values) {
-            operator<<(value);
-        }
+        write_values(values, is_contiguously_serializable<T>());
         return *this;
     }
 
@@ -244,7 +368,7 @@ public:
         ensure_bytes(serialization<T>::size);
         // TODO Convert to host byte order
         // TODO Use std::copy
-        memcpy(&value, _bytes.get() + _pos, serialization<T>::size);
+        memcpy(&value, _data + _pos, serialization<T>::size);
         _pos += serialization<T>::size;
         return *this;
     }
@@ -266,10 +390,7 @@ public:
         size_t size;
         operator>>(size); // read number of elements
         values.resize(size);
-        for (auto& value : values) {
-            // remove const qualifier from value to update it from byte buffer
-            operator>>(const_cast<typename std::remove_const<decltype(value)>::type>(value));
-        }
+        read_values(values, is_contiguously_serializable<T>());
         return *this;
     }
 
@@ -301,8 +422,22 @@ public:
     void resize(
             size_type size);
 
+    /*!
+     * \brief Returns the size of the buffer's content including referenced values
+     * \return the number of unread bytes
+     */
     size_type size() const;
 
+    /*!
+     * \brief Returns the buffer's content as a list of contiguous memory segments
+     * Segments either point to the buffer's own bytes or to referenced values.
+     * \param[out] segments    the buffer's content
+     */
+    void segments(
+            std::vector<segment_type>& segments) const;
+
+    /* Iterators only provide access to the buffer's own bytes, i.e., they
+     * cannot be used if the buffer references any values. */
     iterator begin();
     const_iterator begin() const;
     const_iterator cbegin() const;
@@ -316,7 +451,12 @@ private:
     size_type _len; // write count, i.e., size of buffer content *including* the read bytes
     size_type _max_size;
     size_type _size; // buffer size
-    std::unique_ptr<value_type[]> _bytes; // buffer data
+    block_type _bytes; // buffer data
+    pointer _data; // buffer data or bytes of a buffer view
+
+    size_type _gather_threshold; // minimum size of referenced values
+    std::vector<reference_type> _references; // referenced values in order of writing
+    size_type _referenced_size; // total size of referenced values
 };
 
 } // namespace dcl
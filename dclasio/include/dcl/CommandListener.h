@@ -69,6 +69,27 @@ public:
      */
     virtual void onExecutionStatusChanged(
             cl_int executionStatus) = 0;
+
+    /*!
+     * \brief Callback for profiling info sent along with a command's completion.
+     *
+     * Compute nodes send the profiling info of a command before its final
+     * execution status, if profiling is enabled for the command's queue.
+     * All times are provided by the compute node's clock.
+     * The default implementation ignores the profiling info.
+     *
+     * \param[in]  received time of receiving the command on the compute node
+     * \param[in]  queued   time of enqueuing the command
+     * \param[in]  submit   time of submitting the command
+     * \param[in]  start    time of starting the command
+     * \param[in]  end      time of finishing the command
+     */
+    virtual void onProfilingInfo(
+            cl_ulong received,
+            cl_ulong queued,
+            cl_ulong submit,
+            cl_ulong start,
+            cl_ulong end) { }
 };
 
 } /* namespace dcl */
@@ -65,6 +65,7 @@ class ComputeNode;
 class Event;
 class Kernel;
 class Memory;
+class Process;
 
 /* ****************************************************************************/
 
@@ -94,20 +95,172 @@ public:
             object_id                                   commandId,
             std::shared_ptr<Event> *                    event) = 0;
 
+    /*!
+     * \brief Enqueues this compute node's part of a broadcast
+     *
+     * The compute nodes participating in a broadcast form a tree. The root of
+     * the tree copies the source buffer to its destination buffers, while all
+     * other compute nodes receive the data from their parent into their first
+     * destination buffer and copy it to their other destination buffers. Each
+     * compute node forwards the data to its children.
+     *
+     * This method must be called on the command queue of the first
+     * destination buffer.
+     *
+     * \param[in]  src             the source buffer on the root, or \c NULL
+     * \param[in]  commandQueues   the command queues of the destination buffers
+     * \param[in]  dsts            the destination buffers on this compute node
+     * \param[in]  srcOffset       offset of the source buffer range
+     * \param[in]  dstOffsets      offsets of the destination buffer ranges
+     * \param[in]  cb              size of the broadcast range in bytes
+     * \param[in]  parent          the compute node from which the data is
+     *             received, or \c NULL on the root
+     * \param[in]  children        the compute nodes to which the data is forwarded
+     * \param[in]  eventWaitList   events to wait for before the broadcast
+     * \param[in]  commandId       command ID
+     * \param[out] event           event associated with this command, or \c NULL
+     */
+    virtual void enqueueBroadcastBuffer(
+            const std::shared_ptr<Buffer>&                      src,
+            const std::vector<std::shared_ptr<CommandQueue>>&   commandQueues,
+            const std::vector<std::shared_ptr<Buffer>>&         dsts,
+            size_t                                              srcOffset,
+            const std::vector<size_t>&                          dstOffsets,
+            size_t                                              cb,
+            Process *                                           parent,
+            const std::vector<Process *>&                       children,
+            const std::vector<std::shared_ptr<Event>> *         eventWaitList,
+            object_id                                           commandId,
+            std::shared_ptr<Event> *                            event) = 0;
+
+    /*!
+     * \brief Enqueues this compute node's part of a reduction
+     *
+     * The compute nodes participating in a reduction form a tree. Each compute
+     * node combines its source buffers and the partial results received from
+     * its children using the specified kernel. The result is sent to the
+     * parent, or written to the destination buffer on the root.
+     *
+     * The kernel combines the buffers set as its first and second argument
+     * into its first argument. All other arguments must have been set before.
+     *
+     * \param[in]  srcs            the source buffers on this compute node
+     * \param[in]  dst             the destination buffer
+     * \param[in]  kernel          the kernel which combines two buffers
+     * \param[in]  offset          global work offset
+     * \param[in]  global          global work size
+     * \param[in]  local           local work size
+     * \param[in]  parent          the compute node to which the partial result
+     *             is sent, or \c NULL on the root
+     * \param[in]  children        the compute nodes from which partial results
+     *             are received
+     * \param[in]  eventWaitList   events to wait for before the reduction
+     * \param[in]  commandId       command ID
+     * \param[out] event           event associated with this command, or \c NULL
+     */
+    virtual void enqueueReduceBuffer(
+            const std::vector<std::shared_ptr<Buffer>>& srcs,
+            const std::shared_ptr<Buffer>&              dst,
+            const std::shared_ptr<Kernel>&              kernel,
+            const std::vector<size_t>&                  offset,
+            const std::vector<size_t>&                  global,
+            const std::vector<size_t>&                  local,
+            Process *                                   parent,
+            const std::vector<Process *>&               children,
+            const std::vector<std::shared_ptr<Event>> * eventWaitList,
+            object_id                                   commandId,
+            std::shared_ptr<Event> *                    event) = 0;
+
+    /*!
+     * \brief Enqueues this compute node's part of a multicast upload
+     *
+     * The compute nodes participating in a multicast upload form a chain. Each
+     * compute node receives the data chunk by chunk from its predecessor (the
+     * host on the first compute node) into its first buffer, and forwards each
+     * chunk to its successor as soon as it has been received. The data is then
+     * copied to the other buffers on this compute node.
+     *
+     * The upload is complete when the data has been written to the buffers of
+     * this compute node and of all its successors. The first compute node
+     * reports completion to the host.
+     *
+     * This method must be called on the command queue of the first buffer.
+     *
+     * \param[in]  commandQueues   the command queues of the buffers
+     * \param[in]  buffers         the buffers on this compute node
+     * \param[in]  offsets         offsets of the buffer ranges
+     * \param[in]  cb              size of the uploaded range in bytes
+     * \param[in]  chunkSize       size of the chunks in which the data is forwarded
+     * \param[in]  predecessor     the compute node from which the data is
+     *             received, or \c NULL if it is received from the host
+     * \param[in]  successor       the compute node to which the data is
+     *             forwarded, or \c NULL on the last compute node
+     * \param[in]  eventWaitList   events to wait for before the upload
+     * \param[in]  commandId       command ID
+     * \param[out] event           event associated with this command, or \c NULL.
+     *             Only the first compute node creates an event, which
+     *             completes with the upload of the whole chain.
+     */
+    virtual void enqueueWriteBuffers(
+            const std::vector<std::shared_ptr<CommandQueue>>&   commandQueues,
+            const std::vector<std::shared_ptr<Buffer>>&         buffers,
+            const std::vector<size_t>&                          offsets,
+            size_t                                              cb,
+            size_t                                              chunkSize,
+            Process *                                           predecessor,
+            Process *                                           successor,
+            const std::vector<std::shared_ptr<Event>> *         eventWaitList,
+            object_id                                           commandId,
+            std::shared_ptr<Event> *                            event) = 0;
+
+    /*!
+     * \brief Enqueues a download of a buffer range to the host
+     *
+     * If a chunk size is specified, the data is sent chunk by chunk, such that
+     * a chunk is copied from the device while the preceding chunk is sent.
+     *
+     * \param[in]  buffer          the buffer to read from
+     * \param[in]  blockingRead    \c true, if the host blocks until the read is complete
+     * \param[in]  offset          offset of the buffer range
+     * \param[in]  size            size of the buffer range in bytes
+     * \param[in]  chunkSize       size of the chunks in which the data is
+     *             sent, or 0 to send it at once
+     * \param[in]  eventWaitList   events to wait for before the read
+     * \param[in]  commandId       command ID
+     * \param[out] event           event associated with this command, or \c NULL
+     */
     virtual void enqueueReadBuffer(
             const std::shared_ptr<Buffer>&              buffer,
             bool                                        blockingRead,
             size_t                                      offset,
             size_t                                      size,
+            size_t                                      chunkSize,
             const std::vector<std::shared_ptr<Event>> * eventWaitList,
             object_id                                   commandId,
             std::shared_ptr<Event> *                    event) = 0;
 
+    /*!
+     * \brief Enqueues an upload of a buffer range from the host
+     *
+     * If a chunk size is specified, the data is received chunk by chunk, such
+     * that a chunk is copied to the device while the next chunk is received.
+     *
+     * \param[in]  buffer          the buffer to write to
+     * \param[in]  blockingWrite   \c true, if the host blocks until the write is complete
+     * \param[in]  offset          offset of the buffer range
+     * \param[in]  size            size of the buffer range in bytes
+     * \param[in]  chunkSize       size of the chunks in which the data is
+     *             received, or 0 to receive it at once
+     * \param[in]  eventWaitList   events to wait for before the write
+     * \param[in]  commandId       command ID
+     * \param[out] event           event associated with this command, or \c NULL
+     */
     virtual void enqueueWriteBuffer(
             const std::shared_ptr<Buffer>&              buffer,
             bool                                        blockingWrite,
             size_t                                      offset,
             size_t                                      size,
+            size_t                                      chunkSize,
             const std::vector<std::shared_ptr<Event>> * eventWaitList,
             object_id                                   commandId,
             std::shared_ptr<Event> *                    event) = 0;
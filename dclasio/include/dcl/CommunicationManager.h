@@ -46,6 +46,7 @@
 #ifndef COMMUNICATIONMANAGER_H_
 #define COMMUNICATIONMANAGER_H_
 
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -128,6 +129,17 @@ public:
      */
     virtual void destroyComputeNode(
             ComputeNode *computeNode) = 0;
+
+    /*!
+     * \brief Writes the spans recorded by the host and all connected compute nodes.
+     *
+     * The time stamps of the compute nodes are converted to the host's clock,
+     * such that the spans of all processes form a single trace.
+     *
+     * \param[out] out  the stream to write the trace to
+     */
+    virtual void writeTrace(
+            std::ostream& out) = 0;
 };
 
 /* ****************************************************************************/
@@ -140,11 +152,14 @@ public:
     /*!
      * \brief Creates a new communication manager which is accessible via a given URL.
      *
-     * \param[in]  url  URL of the communication manager
+     * \param[in]  url         URL of the communication manager
+     * \param[in]  numThreads  the number of threads used to execute requests;
+     *             if 0, one thread per hardware thread is used
      * \return a communication manager instance
      */
     static ComputeNodeCommunicationManager * create(
-            const std::string& url);
+            const std::string&  url,
+            unsigned int        numThreads = 0);
 
     virtual ~ComputeNodeCommunicationManager() { }
 
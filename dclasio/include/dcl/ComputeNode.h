@@ -48,6 +48,8 @@
 
 #include "Process.h"
 
+#include "util/Clock.h"
+
 /* TODO Remove message classes from ComputeNode interface */
 #include <dclasio/message/Message.h>
 #include <dclasio/message/Request.h>
@@ -59,6 +61,7 @@
 #include <CL/cl_wwu_dcl.h>
 #endif
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -85,6 +88,16 @@ public:
             cl_compute_node_info_WWU    param_name,
             Binary&                     param) const = 0;
 
+    /*!
+     * \brief Returns the offset of the compute node's clock from the local clock.
+     *
+     * The offset is used to convert time stamps of the compute node to the
+     * local clock. It is invalid, if the clocks have not been synchronized.
+     *
+     * \return the estimated clock offset
+     */
+    virtual util::ClockOffset clockOffset() const = 0;
+
     /*!
      * \brief Sends a request message to this compute node.
      *
@@ -93,6 +106,26 @@ public:
     virtual void sendRequest(
             dclasio::message::Request& request) const = 0;
 
+    /*!
+     * \brief Sends a request message to this compute node without awaiting its response.
+     *
+     * The response to the request is not stored for a subsequent call of
+     * awaitResponse, but is passed to the specified callback when it arrives.
+     * The callback is called with the response's error code, i.e.,
+     * \c CL_SUCCESS for a default response. It is called by the communication
+     * layer's receiving thread and therefore must not block.
+     *
+     * The request may be delayed to be sent together with subsequent
+     * requests; it is sent at the latest with the next request of this
+     * compute node whose response is awaited.
+     *
+     * \param[in]  request  the request to send
+     * \param[in]  notify   the callback to call upon receipt of the response
+     */
+    virtual void sendRequest(
+            dclasio::message::Request&              request,
+            const std::function<void (cl_int)>&     notify) = 0;
+
     /*!
      * \brief Waits for this compute node's response to the specified request.
      *
@@ -61,6 +61,18 @@ namespace dcl {
  */
 class DataTransfer {
 public:
+	/*!
+	 * \brief Priority classes of data transfers
+	 *
+	 * Data transfers of normal priority are interleaved with, and take
+	 * precedence over, pending background data transfers to the same process.
+	 * Background priority is used for memory object synchronization.
+	 */
+	enum class Priority {
+		NORMAL = 0,
+		BACKGROUND = 1
+	};
+
 	virtual ~DataTransfer() { }
 
 	/*!
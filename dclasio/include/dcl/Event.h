@@ -47,6 +47,7 @@
 #define DCL_EVENT_H_
 
 #include "CommandListener.h"
+#include "Process.h"
 #include "SynchronizationListener.h"
 
 #ifdef __APPLE__
@@ -71,6 +72,18 @@ public:
             cl_profiling_info   param_name,
             cl_ulong&           param_value) const = 0;
 
+    /*!
+     * \brief Subscribes a compute node to the execution status of this event.
+     *
+     * The compute node is sent the final execution status of this event's
+     * command directly. If the command is already complete, the status is
+     * sent immediately.
+     *
+     * \param[in]  computeNode the compute node which holds a substitute event
+     */
+    virtual void onSubscribe(
+            dcl::Process& computeNode) = 0;
+
 };
 
 } /* namespace dcl */
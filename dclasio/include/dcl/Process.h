@@ -49,6 +49,7 @@
 /* TODO Remove message headers from process interface */
 #include <dclasio/message/Message.h>
 
+#include <dcl/DataTransfer.h>
 #include <dcl/DCLTypes.h>
 
 #include <cstddef>
@@ -57,8 +58,6 @@
 
 namespace dcl {
 
-class DataTransfer;
-
 /* ****************************************************************************/
 
 /*!
@@ -70,6 +69,16 @@ class Process {
 public:
     virtual ~Process() { }
 
+    /*!
+     * \brief Returns this process' ID
+     *
+     * Process IDs are unique within a dOpenCL network. Therefore, they can be
+     * used to refer to a process in messages sent to other processes.
+     *
+     * \return the process ID, or 0 if this process is not connected
+     */
+    virtual process_id get_id() const = 0;
+
     virtual const std::string& url() const = 0;
 
     /*!
@@ -87,11 +96,14 @@ public:
 	 *
 	 * \param[in]  size      size of data buffer
 	 * \param[in]  ptr       data buffer
+	 * \param[in]  priority  priority of the data transfer; must match the
+	 *                       priority of the receiving process's data receipt
 	 * \return
 	 */
 	virtual std::shared_ptr<DataTransfer> sendData(
 			size_t      size,
-			const void *ptr) = 0;
+			const void *ptr,
+			DataTransfer::Priority priority = DataTransfer::Priority::NORMAL) = 0;
 
 	/*!
 	 * \brief Receive data from host.
@@ -99,11 +111,14 @@ public:
 	 *
 	 * \param[in]  size     size of data buffer
 	 * \param[out] ptr      data buffer
+	 * \param[in]  priority priority of the data transfer; must match the
+	 *                      priority of the sending process's data sending
 	 * \return
 	 */
 	virtual std::shared_ptr<DataTransfer> receiveData(
 			size_t  size,
-			void *  ptr) = 0;
+			void *  ptr,
+			DataTransfer::Priority priority = DataTransfer::Priority::NORMAL) = 0;
 };
 
 } /* namespace dcl */
@@ -195,11 +195,22 @@ public:
      * \param[in]  id				command ID
      * \param[in]  context          the context associated with the event
      * \param[in]  memoryObjects    the memory objects associated with the event
+     * \param[in]  offset           offset of the range of the memory objects
+     *             modified by the event's command
+     * \param[in]  cb               size of the modified range in bytes; if 0,
+     *             the entire memory objects are considered modified
+     * \param[in]  computeNode      the compute node where the event's command
+     *             has been enqueued, if changes associated with the event are
+     *             acquired from that compute node directly; if \c NULL, changes
+     *             are acquired from the host
      */
 	virtual std::shared_ptr<Event> createEvent(
             object_id                                   id,
             const std::shared_ptr<Context>&             context,
-            const std::vector<std::shared_ptr<Memory>>& memoryObjects) = 0;
+            const std::vector<std::shared_ptr<Memory>>& memoryObjects,
+            size_t                                      offset,
+            size_t                                      cb,
+            ComputeNode *                               computeNode) = 0;
 
     /*!
      * \brief Deletes an event from this session.
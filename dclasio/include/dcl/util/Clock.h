@@ -51,18 +51,20 @@
 #endif
 
 #include <chrono>
+#include <deque>
 
 namespace dcl {
 
 namespace util {
 
 /*!
- * \brief A simple class for creating OpenCL-like time stamps from a global clock
+ * \brief A simple class for creating OpenCL-like time stamps from a local clock
  *
- * This clock should return monotonic time stamps which are valid on all nodes
- * of a distributed system used by dOpenCL. Thus, time stamps from different
- * nodes are comparable to each other, in order to, e.g., profile runtime of
- * commands or data transfers.
+ * This clock returns monotonic time stamps which are valid within a single
+ * process. Time stamps from other processes are mapped to this clock using a
+ * ClockOffset, such that time stamps from different nodes are comparable to
+ * each other, in order to, e.g., profile runtime of commands or data
+ * transfers.
  */
 class Clock {
 public:
@@ -77,16 +79,101 @@ public:
     cl_ulong getTime();
 
 private:
+    std::chrono::time_point<std::chrono::steady_clock> _start; //!< fixed time point to compute differences with
+};
+
+/* ****************************************************************************/
+
+/*!
+ * \brief An estimator of the offset and drift of a remote clock
+ *
+ * The offset is estimated from NTP-style samples: a request is sent at local
+ * time t0, received at remote time t1, answered at remote time t2, and the
+ * response is received at local time t3. Then, the offset of the remote clock
+ * is ((t1 - t0) + (t2 - t3)) / 2, with an error of at most half the round-trip
+ * delay (t3 - t0) - (t2 - t1).
+ *
+ * Only samples with a small round-trip delay are considered, as their offsets
+ * are most accurate. The drift of the remote clock is estimated by a linear
+ * regression of these samples, if they span a sufficient period of time.
+ */
+class ClockOffset {
+public:
+    ClockOffset();
+
+    /*!
+     * \brief Adds an offset sample
+     *
+     * \param[in]  t0  local time of sending the request
+     * \param[in]  t1  remote time of receiving the request
+     * \param[in]  t2  remote time of sending the response
+     * \param[in]  t3  local time of receiving the response
+     */
+    void addSample(
+            cl_ulong t0,
+            cl_ulong t1,
+            cl_ulong t2,
+            cl_ulong t3);
+
+    /*!
+     * \brief Checks if any samples have been added
+     *
+     * \return \c true, if the offset has been estimated, otherwise \c false
+     */
+    bool isValid() const;
+
     /*!
-     * \brief Synchronizes this clock with a global clock
+     * \brief Returns the offset of the remote clock at a specified local time
      *
-     * This methods computes the clock skew of the system clock and a global
-     * clock.
+     * \param[in]  localTime   a local time stamp
+     * \return the estimated offset (remote minus local time) in nanoseconds
+     */
+    double offset(
+            cl_ulong localTime) const;
+
+    /*!
+     * \brief Returns the drift of the remote clock
+     *
+     * \return the estimated drift in nanoseconds per nanosecond
+     */
+    double drift() const;
+
+    /*!
+     * \brief Returns the error bound of the estimated offset
+     *
+     * The error bound comprises half the round-trip delay of the best sample
+     * and the largest deviation of the considered samples from the estimate.
+     *
+     * \return the error bound in nanoseconds
+     */
+    double error() const;
+
+    /*!
+     * \brief Converts a remote time stamp to the local clock
+     *
+     * \param[in]  remoteTime  a time stamp of the remote clock
+     * \return the corresponding time stamp of the local clock
+     */
+    cl_ulong toLocalTime(
+            cl_ulong remoteTime) const;
+
+private:
+    struct Sample {
+        cl_ulong time;  //!< local time of the sample (midpoint of the round trip)
+        double offset;  //!< offset of the remote clock
+        double delay;   //!< round-trip delay
+    };
+
+    /*!
+     * \brief Computes offset, drift, and error bound from the current samples
      */
-    void sync();
+    void estimate();
 
-    cl_ulong _clockSkew; //!< clock skew in nanoseconds
-    std::chrono::time_point<std::chrono::high_resolution_clock> _start; //!< fixed time point to compute differences with
+    std::deque<Sample> _samples; //!< recent samples, oldest first
+    cl_ulong _time; //!< local reference time of the estimate
+    double _offset; //!< offset at reference time
+    double _drift; //!< drift
+    double _error; //!< error bound
 };
 
 /* ****************************************************************************/
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file Environment.h
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#ifndef ENVIRONMENT_H_
+#define ENVIRONMENT_H_
+
+#include <cstddef>
+
+namespace dcl {
+
+namespace util {
+
+/*!
+ * \brief Reads a size from an environment variable
+ *
+ * Invalid values are ignored with a warning, unless \c warn is \c false.
+ * Warnings must be disabled during static initialization, as the logger may
+ * not have been initialized yet.
+ *
+ * \param[in]  name         name of the environment variable
+ * \param[in]  defaultValue value to return if the variable is not set or invalid
+ * \param[in]  minValue     smallest valid value
+ * \param[in]  warn         if \c true, invalid values are logged
+ * \return the value of the environment variable, or \c defaultValue
+ */
+size_t getEnvSize(
+        const char *name,
+        size_t      defaultValue,
+        size_t      minValue = 0,
+        bool        warn = true);
+
+} /* namespace util */
+
+} /* namespace dcl */
+
+#endif /* ENVIRONMENT_H_ */
@@ -0,0 +1,268 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file Trace.h
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include "Clock.h"
+
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace dcl {
+
+namespace util {
+
+/*!
+ * \brief A span of time which has been recorded by a thread
+ */
+struct TraceRecord {
+    std::string name;       //!< name of the span
+    std::string category;   //!< category of the span
+    cl_uint thread;         //!< ID of the recording thread
+    cl_ulong start;         //!< start time of the span
+    cl_ulong end;           //!< end time of the span
+    cl_ulong arg;           //!< an argument of the span, e.g., an ID or a size
+};
+
+/* ****************************************************************************/
+
+/*!
+ * \brief A ring buffer of spans which is written by a single thread
+ *
+ * Spans are recorded without locking. When the buffer is full, the oldest
+ * spans are overwritten.
+ */
+class TraceBuffer {
+public:
+    /*!
+     * \brief Creates a trace buffer
+     *
+     * \param[in]  capacity the maximum number of spans in this buffer
+     * \param[in]  thread   the ID of the thread which writes this buffer
+     */
+    TraceBuffer(
+            size_t capacity,
+            cl_uint thread);
+
+    /*!
+     * \brief Records a span
+     *
+     * This method must only be called by the thread which owns this buffer.
+     * Name and category must be string literals, as they are not copied.
+     */
+    void record(
+            const char *name,
+            const char *category,
+            cl_ulong start,
+            cl_ulong end,
+            cl_ulong arg);
+
+    /*!
+     * \brief Appends the spans of this buffer to a list of records
+     *
+     * Spans which are overwritten while they are copied are dropped.
+     *
+     * \param[out] records  the list of records to append the spans to
+     */
+    void copy(
+            std::vector<TraceRecord>& records) const;
+
+private:
+    struct Span {
+        const char *name;
+        const char *category;
+        cl_ulong start;
+        cl_ulong end;
+        cl_ulong arg;
+    };
+
+    std::vector<Span> _spans; //!< ring buffer
+    std::atomic<size_t> _count; //!< number of spans ever recorded
+    cl_uint _thread; //!< ID of the owning thread
+};
+
+/* ****************************************************************************/
+
+/*!
+ * \brief A tracer which records spans into per-thread ring buffers
+ *
+ * Tracing is enabled by setting the environment variable DCL_TRACE to the
+ * name of a trace file. The size of the per-thread ring buffers is set by
+ * DCL_TRACE_BUFFER_SIZE (number of spans).
+ */
+class Tracer {
+public:
+    Tracer();
+    virtual ~Tracer();
+
+    /*!
+     * \brief Checks if tracing is enabled
+     *
+     * \return \c true, if tracing is enabled, otherwise \c false
+     */
+    bool isEnabled() const {
+        return _enabled;
+    }
+
+    /*!
+     * \brief Returns the name of the trace file
+     */
+    const std::string& fileName() const;
+
+    /*!
+     * \brief Records a span in the buffer of the calling thread
+     *
+     * Name and category must be string literals, as they are not copied.
+     */
+    void record(
+            const char *name,
+            const char *category,
+            cl_ulong start,
+            cl_ulong end,
+            cl_ulong arg = 0);
+
+    /*!
+     * \brief Returns the spans which have been recorded by all threads
+     *
+     * \param[out] records  the recorded spans
+     */
+    void collect(
+            std::vector<TraceRecord>& records) const;
+
+private:
+    bool _enabled; //!< \c true, if tracing is enabled
+    std::string _fileName; //!< name of trace file
+    size_t _capacity; //!< capacity of per-thread buffers
+
+    std::vector<std::unique_ptr<TraceBuffer>> _buffers; //!< buffers of all threads
+    mutable std::mutex _buffersMutex; //!< Mutex for buffer list
+};
+
+/* ****************************************************************************/
+
+/*!
+ * \brief Records the lifetime of a scope as a span
+ */
+class TraceSpan {
+public:
+    TraceSpan(
+            const char *name,
+            const char *category,
+            cl_ulong arg = 0);
+    ~TraceSpan();
+
+    /*!
+     * \brief Sets the argument of this span
+     */
+    void setArg(
+            cl_ulong arg);
+
+private:
+    TraceSpan(
+            const TraceSpan&) = delete;
+    TraceSpan& operator=(
+            const TraceSpan&) = delete;
+
+    const char *_name;
+    const char *_category;
+    cl_ulong _start; //!< start time
+    cl_ulong _arg;
+};
+
+/* ****************************************************************************/
+
+/*!
+ * \brief Writes spans of several processes into a Chrome trace file
+ *
+ * The file is written in the JSON trace event format, which can be viewed
+ * using chrome://tracing or Perfetto.
+ */
+class TraceWriter {
+public:
+    TraceWriter(
+            std::ostream& out);
+    virtual ~TraceWriter();
+
+    /*!
+     * \brief Writes the spans of a process
+     *
+     * All time stamps must refer to the same clock.
+     *
+     * \param[in]  pid      an ID of the process
+     * \param[in]  name     the name of the process
+     * \param[in]  records  the spans recorded by the process
+     */
+    void write(
+            cl_uint pid,
+            const std::string& name,
+            const std::vector<TraceRecord>& records);
+
+private:
+    void writeString(
+            const std::string& str);
+
+    std::ostream& _out;
+    bool _empty; //!< \c true, if no event has been written yet
+};
+
+/* ****************************************************************************/
+
+extern Tracer tracer;
+
+} // namespace util
+
+} // namespace dcl
+
+#endif /* TRACE_H_ */
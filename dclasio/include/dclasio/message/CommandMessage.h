@@ -57,6 +57,8 @@
 #include <CL/cl.h>
 #endif
 
+#include <vector>
+
 namespace dclasio {
 
 namespace message {
@@ -64,20 +66,47 @@ namespace message {
 /*!
  * \brief Notification of command execution status changes.
  *
- * This message is sent from compute nodes to the host.
+ * This message is sent from compute nodes to the host, and from the host to
+ * compute nodes which hold a substitute event for the command's event.
+ * Compute nodes also send this message directly to compute nodes which
+ * subscribed to the event (see SubscribeEvent). As object IDs are
+ * only unique per host, such a message specifies the host of the event.
+ *
+ * If profiling is enabled for the command's queue, compute nodes send the
+ * command's profiling info along with its completion to the host, such that
+ * the host need not request it separately.
  */
 class CommandExecutionStatusChangedMessage: public Message {
 public:
     CommandExecutionStatusChangedMessage();
 	CommandExecutionStatusChangedMessage(
 			dcl::object_id  commandId,
-			cl_int          status);
+			cl_int          status,
+			dcl::process_id hostId = 0);
+	CommandExecutionStatusChangedMessage(
+			dcl::object_id                  commandId,
+			cl_int                          status,
+			const std::vector<cl_ulong>&    profilingInfo);
 	CommandExecutionStatusChangedMessage(
 	        const CommandExecutionStatusChangedMessage& rhs);
 	virtual ~CommandExecutionStatusChangedMessage();
 
 	dcl::object_id commandId() const;
 	cl_int status() const;
+	/*!
+	 * \brief Returns the ID of the host of the command
+	 *
+	 * \return a process ID, or 0 if this message is sent by the host, or to the host
+	 */
+	dcl::process_id hostId() const;
+	/*!
+	 * \brief Returns the profiling info of the command
+	 *
+	 * \return the times of receiving, queuing, submitting, starting, and
+	 *         finishing the command, or an empty list if no profiling info
+	 *         is provided
+	 */
+	const std::vector<cl_ulong>& profilingInfo() const;
 
     static const class_type TYPE = 601;
 
@@ -86,17 +115,19 @@ public:
     }
 
     void pack(dcl::ByteBuffer& buf) const {
-        buf << _commandId << _status;
+        buf << _commandId << _status << _hostId << _profilingInfo;
     }
 
     void unpack(dcl::ByteBuffer& buf) {
-        buf >> _commandId >> _status;
+        buf >> _commandId >> _status >> _hostId >> _profilingInfo;
     }
 
 
 private:
 	dcl::object_id _commandId;
 	cl_int _status;
+	dcl::process_id _hostId;
+	std::vector<cl_ulong> _profilingInfo;
 };
 
 } /* namespace message */
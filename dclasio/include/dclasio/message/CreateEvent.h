@@ -49,6 +49,8 @@
 #include <dcl/ByteBuffer.h>
 #include <dcl/DCLTypes.h>
 
+#include <cstddef>
+#include <string>
 #include <vector>
 
 namespace dclasio {
@@ -61,10 +63,28 @@ namespace message {
 class CreateEvent: public Request {
 public:
     CreateEvent();
+	/*!
+	 * \brief Creates a request for a substitute event.
+	 *
+	 * \param[in]  contextId       ID of the context associated with the event
+	 * \param[in]  eventId         ID of the event
+	 * \param[in]  memObjectIds    IDs of the memory objects associated with the event
+	 * \param[in]  offset          offset of the range of the memory objects
+	 *             modified by the event's command
+	 * \param[in]  cb              size of the modified range in bytes; if 0, the
+	 *             entire memory objects are considered modified
+	 * \param[in]  computeNodeUrl  URL of the compute node where the event's command
+	 *             has been enqueued; if not empty, changes associated with the
+	 *             event are acquired directly from this compute node rather
+	 *             than from the host
+	 */
 	CreateEvent(
 			dcl::object_id                     contextId,
 			dcl::object_id                     eventId,
-			const std::vector<dcl::object_id>& memObjectIds);
+			const std::vector<dcl::object_id>& memObjectIds,
+			size_t                             offset = 0,
+			size_t                             cb = 0,
+			const std::string&                 computeNodeUrl = std::string());
 	CreateEvent(
 	        const CreateEvent& rhs);
 	virtual ~CreateEvent();
@@ -72,6 +92,9 @@ public:
 	dcl::object_id contextId() const;
 	dcl::object_id eventId() const;
 	const std::vector<dcl::object_id>& memObjectIds() const;
+	size_t offset() const;
+	size_t cb() const;
+	const std::string& computeNodeUrl() const;
 
     static const class_type TYPE = 100 + CREATE_EVENT;
 
@@ -81,18 +104,21 @@ public:
 
     void pack(dcl::ByteBuffer& buf) const {
         Request::pack(buf);
-        buf << _contextId << _eventId << _memObjectIds;
+        buf << _contextId << _eventId << _memObjectIds << _offset << _cb << _computeNodeUrl;
     }
 
     void unpack(dcl::ByteBuffer& buf) {
         Request::unpack(buf);
-        buf >> _contextId >> _eventId >> _memObjectIds;
+        buf >> _contextId >> _eventId >> _memObjectIds >> _offset >> _cb >> _computeNodeUrl;
     }
 
 private:
 	dcl::object_id _contextId;
 	dcl::object_id _eventId;
 	std::vector<dcl::object_id> _memObjectIds;
+	size_t _offset;
+	size_t _cb;
+	std::string _computeNodeUrl;
 };
 
 } /* namespace message */
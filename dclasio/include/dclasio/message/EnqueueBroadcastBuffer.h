@@ -50,14 +50,28 @@
 #include <dcl/DCLTypes.h>
 
 #include <cstddef>
+#include <string>
 #include <vector>
 
 namespace dclasio {
 namespace message {
 
+/*!
+ * \brief A request to enqueue a compute node's part of a broadcast.
+ *
+ * The compute nodes participating in a broadcast form a tree. Each compute
+ * node receives the data from its parent (unless it is the root) and forwards
+ * it to its children.
+ */
 class EnqueueBroadcastBuffer : public Request {
 public:
     EnqueueBroadcastBuffer();
+    /*!
+     * \param[in]  parentUrl   URL of the compute node from which the data is
+     *             received, or an empty string on the root
+     * \param[in]  childIds    process IDs of the compute nodes to which the
+     *             data is forwarded
+     */
 	EnqueueBroadcastBuffer(
 			const std::vector<dcl::object_id>&  commandQueueIds,
 			dcl::object_id                      commandId,
@@ -66,6 +80,8 @@ public:
 			size_t                              srcOffset,
 			const std::vector<size_t>&          dstOffsets,
 			size_t                              cb,
+			const std::string&                  parentUrl,
+			const std::vector<dcl::process_id>& childIds,
 			const std::vector<dcl::object_id> * eventIdWaitList = nullptr,
 			bool                                event = false);
 	EnqueueBroadcastBuffer(
@@ -78,6 +94,8 @@ public:
     size_t srcOffset() const;
     const std::vector<size_t>& dstOffsets() const;
     size_t cb() const;
+    const std::string& parentUrl() const;
+    const std::vector<dcl::process_id>& childIds() const;
     const std::vector<dcl::object_id>& eventIdWaitList() const;
     bool event() const;
 
@@ -90,13 +108,15 @@ public:
     void pack(dcl::ByteBuffer& buf) const {
         Request::pack(buf);
         buf << _commandQueueIds << _commandId << _srcBufferId << _dstBufferIds
-                << _srcOffset << _dstOffsets << _cb << _eventIdWaitList << _event;
+                << _srcOffset << _dstOffsets << _cb << _parentUrl << _childIds
+                << _eventIdWaitList << _event;
     }
 
     void unpack(dcl::ByteBuffer& buf) {
         Request::unpack(buf);
         buf >> _commandQueueIds >> _commandId >> _srcBufferId >> _dstBufferIds
-                >> _srcOffset >> _dstOffsets >> _cb >> _eventIdWaitList >> _event;
+                >> _srcOffset >> _dstOffsets >> _cb >> _parentUrl >> _childIds
+                >> _eventIdWaitList >> _event;
     }
 
 private:
@@ -107,6 +127,8 @@ private:
     size_t _srcOffset;
     std::vector<size_t> _dstOffsets;
     size_t _cb;
+    std::string _parentUrl;
+    std::vector<dcl::process_id> _childIds;
     std::vector<dcl::object_id> _eventIdWaitList;
     bool _event;
 };
@@ -46,10 +46,18 @@
 
 #include "Request.h"
 
+#include <dcl/Binary.h>
 #include <dcl/ByteBuffer.h>
 #include <dcl/DCLTypes.h>
 
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
 #include <cstddef>
+#include <map>
 #include <vector>
 
 namespace dclasio {
@@ -80,6 +88,46 @@ public:
     const std::vector<dcl::object_id>& eventIdWaitList() const;
     bool event() const;
 
+    /*!
+     * \brief Sets a kernel argument which is applied before the kernel is enqueued.
+     *
+     * Kernel arguments are passed with the request, such that no separate
+     * request is required for setting them.
+     *
+     * \param[in]  index    index of the argument
+     * \param[in]  size     size of the argument value
+     * \param[in]  value    pointer to the argument value
+     */
+    void setArgBinary(
+            cl_uint     index,
+            size_t      size,
+            const void *value);
+    /*!
+     * \brief Sets a memory object as kernel argument which is applied before the kernel is enqueued.
+     *
+     * \param[in]  index        index of the argument
+     * \param[in]  memObjectId  ID of the memory object
+     */
+    void setArgMemObject(
+            cl_uint         index,
+            dcl::object_id  memObjectId);
+    /*!
+     * \brief Sets a kernel argument without value which is applied before the kernel is enqueued.
+     *
+     * Such an argument is either a \c NULL memory object or an argument for
+     * which the \c __local qualifier is specified.
+     *
+     * \param[in]  index    index of the argument
+     * \param[in]  size     size of the argument
+     */
+    void setArgLocal(
+            cl_uint index,
+            size_t  size);
+
+    const std::map<cl_uint, dcl::Binary>& argBinaries() const;
+    const std::map<cl_uint, dcl::object_id>& argMemObjects() const;
+    const std::map<cl_uint, size_t>& argLocalSizes() const;
+
     static const class_type TYPE = 100 + ENQUEUE_NDRANGE_KERNEL;
 
     class_type get_type() const {
@@ -89,13 +137,15 @@ public:
     void pack(dcl::ByteBuffer& buf) const {
         Request::pack(buf);
         buf << _commandQueueId << _commandId << _kernelId << _offset << _global
-                << _local << _eventIdWaitList << _event;
+                << _local << _eventIdWaitList << _event
+                << _argBinaries << _argMemObjects << _argLocalSizes;
     }
 
     void unpack(dcl::ByteBuffer& buf) {
         Request::unpack(buf);
         buf >> _commandQueueId >> _commandId >> _kernelId >> _offset >> _global
-                >> _local >> _eventIdWaitList >> _event;
+                >> _local >> _eventIdWaitList >> _event
+                >> _argBinaries >> _argMemObjects >> _argLocalSizes;
     }
 
 private:
@@ -107,6 +157,9 @@ private:
     std::vector<size_t> _local;
     std::vector<dcl::object_id> _eventIdWaitList;
     bool _event;
+    std::map<cl_uint, dcl::Binary> _argBinaries; //!< binary kernel arguments
+    std::map<cl_uint, dcl::object_id> _argMemObjects; //!< memory objects as kernel arguments
+    std::map<cl_uint, size_t> _argLocalSizes; //!< sizes of kernel arguments without value
 };
 
 } /* namespace message */
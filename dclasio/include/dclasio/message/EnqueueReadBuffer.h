@@ -65,6 +65,7 @@ public:
 			bool                                blocking_read,
 			size_t                              offset,
 			size_t                              cb,
+			size_t                              chunkSize,
 			const std::vector<dcl::object_id> * eventIdWaitList = nullptr,
 			bool                                event = false);
 	EnqueueReadBuffer(
@@ -76,6 +77,7 @@ public:
     bool blocking() const;
     size_t offset() const;
     size_t cb() const;
+    size_t chunkSize() const;
     const std::vector<dcl::object_id>& eventIdWaitList() const;
     bool event() const;
 
@@ -87,12 +89,12 @@ public:
 
     void pack(dcl::ByteBuffer& buf) const {
         Request::pack(buf);
-        buf << _commandQueueId << _commandId << _bufferId << _blocking << _offset << _cb << _eventIdWaitList << _event;
+        buf << _commandQueueId << _commandId << _bufferId << _blocking << _offset << _cb << _chunkSize << _eventIdWaitList << _event;
     }
 
     void unpack(dcl::ByteBuffer& buf) {
         Request::unpack(buf);
-        buf >> _commandQueueId >> _commandId >> _bufferId >> _blocking >> _offset >> _cb >> _eventIdWaitList >> _event;
+        buf >> _commandQueueId >> _commandId >> _bufferId >> _blocking >> _offset >> _cb >> _chunkSize >> _eventIdWaitList >> _event;
     }
 
 private:
@@ -102,6 +104,7 @@ private:
     bool _blocking;
     size_t _offset;
     size_t _cb;
+    size_t _chunkSize; //!< Size of the chunks in which the data is transferred, or 0
     std::vector<dcl::object_id> _eventIdWaitList;
     bool _event;
 };
@@ -46,18 +46,45 @@
 
 #include "Request.h"
 
+#include <dcl/Binary.h>
 #include <dcl/ByteBuffer.h>
 #include <dcl/DCLTypes.h>
 
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
 #include <cstddef>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace dclasio {
 namespace message {
 
+/*!
+ * \brief A request to enqueue a compute node's part of a reduction.
+ *
+ * The compute nodes participating in a reduction form a tree. Each compute
+ * node combines its source buffers with the partial results of its children
+ * and sends the result to its parent (unless it is the root).
+ */
 class EnqueueReduceBuffer : public Request {
 public:
     EnqueueReduceBuffer();
+    /*!
+     * \param[in]  commandQueueId  ID of the command queue on the root, or 0 on
+     *             all other compute nodes
+     * \param[in]  contextId   ID of the context
+     * \param[in]  deviceId    ID of the device which performs the reduction,
+     *             if no command queue is specified
+     * \param[in]  parentId    process ID of the compute node to which the
+     *             partial result is sent, or 0 on the root
+     * \param[in]  childUrls   URLs of the compute nodes from which partial
+     *             results are received
+     */
 	EnqueueReduceBuffer(
 			dcl::object_id                      commandQueueId,
 			dcl::object_id                      commandId,
@@ -65,8 +92,12 @@ public:
 			dcl::object_id                      dstId,
 			dcl::object_id                      kernelId,
 			const std::vector<size_t>&          offset,
-			const std::vector<size_t>&          lobal,
+			const std::vector<size_t>&          global,
 			const std::vector<size_t>&          local,
+			dcl::object_id                      contextId,
+			dcl::object_id                      deviceId,
+			dcl::process_id                     parentId,
+			const std::vector<std::string>&     childUrls,
 			const std::vector<dcl::object_id> * eventIdWaitList = nullptr,
 			bool                                event = false);
 	EnqueueReduceBuffer(
@@ -82,9 +113,34 @@ public:
 	const std::vector<size_t>& global() const;
 	const std::vector<size_t>& local() const;
 
+	dcl::object_id contextId() const;
+	dcl::object_id deviceId() const;
+	dcl::process_id parentId() const;
+	const std::vector<std::string>& childUrls() const;
+
     const std::vector<dcl::object_id>& eventIdWaitList() const;
 	bool event() const;
 
+    /*!
+     * \brief Sets a kernel argument which is applied before the kernel is enqueued.
+     *
+     * \see EnqueueNDRangeKernel::setArgBinary
+     */
+    void setArgBinary(
+            cl_uint     index,
+            size_t      size,
+            const void *value);
+    void setArgMemObject(
+            cl_uint         index,
+            dcl::object_id  memObjectId);
+    void setArgLocal(
+            cl_uint index,
+            size_t  size);
+
+    const std::map<cl_uint, dcl::Binary>& argBinaries() const;
+    const std::map<cl_uint, dcl::object_id>& argMemObjects() const;
+    const std::map<cl_uint, size_t>& argLocalSizes() const;
+
     static const class_type TYPE = 100 + ENQUEUE_REDUCE_BUFFER;
 
     class_type get_type() const {
@@ -94,13 +150,17 @@ public:
     void pack(dcl::ByteBuffer& buf) const {
         Request::pack(buf);
         buf << _commandQueueId << _commandId << _srcIds << _dstId << _kernelId
-                << _offset << _global << _local <<  _eventIdWaitList << _event;
+                << _offset << _global << _local << _contextId << _deviceId
+                << _parentId << _childUrls << _eventIdWaitList << _event
+                << _argBinaries << _argMemObjects << _argLocalSizes;
     }
 
     void unpack(dcl::ByteBuffer& buf) {
         Request::unpack(buf);
         buf >> _commandQueueId >> _commandId >> _srcIds >>  _dstId >> _kernelId
-                >> _offset >> _global >> _local >>  _eventIdWaitList >> _event;
+                >> _offset >> _global >> _local >> _contextId >> _deviceId
+                >> _parentId >> _childUrls >> _eventIdWaitList >> _event
+                >> _argBinaries >> _argMemObjects >> _argLocalSizes;
     }
 
 private:
@@ -112,8 +172,15 @@ private:
 	std::vector<size_t> _offset;
 	std::vector<size_t> _global;
 	std::vector<size_t> _local;
+	dcl::object_id _contextId;
+	dcl::object_id _deviceId;
+	dcl::process_id _parentId;
+	std::vector<std::string> _childUrls;
     std::vector<dcl::object_id> _eventIdWaitList;
 	bool _event;
+    std::map<cl_uint, dcl::Binary> _argBinaries; //!< binary kernel arguments
+    std::map<cl_uint, dcl::object_id> _argMemObjects; //!< memory objects as kernel arguments
+    std::map<cl_uint, size_t> _argLocalSizes; //!< sizes of kernel arguments without value
 };
 
 } /* namespace message */
@@ -0,0 +1,140 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file EnqueueWriteBuffers.h
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#ifndef ENQUEUEWRITEBUFFERS_H_
+#define ENQUEUEWRITEBUFFERS_H_
+
+#include "Request.h"
+
+#include <dcl/ByteBuffer.h>
+#include <dcl/DCLTypes.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace dclasio {
+namespace message {
+
+/*!
+ * \brief A request to enqueue a compute node's part of a multicast upload.
+ *
+ * The compute nodes participating in a multicast upload form a chain. The
+ * host memory is uploaded to the first compute node. Each compute node
+ * receives the data chunk by chunk from its predecessor and forwards every
+ * chunk to its successor as soon as it has been received.
+ */
+class EnqueueWriteBuffers : public Request {
+public:
+    EnqueueWriteBuffers();
+    /*!
+     * \param[in]  chunkSize       size of the chunks in which the data is
+     *             received and forwarded
+     * \param[in]  predecessorUrl  URL of the compute node from which the data
+     *             is received, or an empty string if the data is received
+     *             from the host
+     * \param[in]  successorId     process ID of the compute node to which the
+     *             data is forwarded, or 0 on the last compute node
+     */
+    EnqueueWriteBuffers(
+            const std::vector<dcl::object_id>&  commandQueueIds,
+            dcl::object_id                      commandId,
+            const std::vector<dcl::object_id>&  bufferIds,
+            const std::vector<size_t>&          offsets,
+            size_t                              cb,
+            size_t                              chunkSize,
+            const std::string&                  predecessorUrl,
+            dcl::process_id                     successorId,
+            const std::vector<dcl::object_id> * eventIdWaitList = nullptr,
+            bool                                event = false);
+    EnqueueWriteBuffers(
+            const EnqueueWriteBuffers& rhs);
+
+    const std::vector<dcl::object_id>& commandQueueIds() const;
+    dcl::object_id commandId() const;
+    const std::vector<dcl::object_id>& bufferIds() const;
+    const std::vector<size_t>& offsets() const;
+    size_t cb() const;
+    size_t chunkSize() const;
+    const std::string& predecessorUrl() const;
+    dcl::process_id successorId() const;
+    const std::vector<dcl::object_id>& eventIdWaitList() const;
+    bool event() const;
+
+    static const class_type TYPE = 100 + ENQUEUE_WRITE_BUFFERS;
+
+    class_type get_type() const {
+        return TYPE;
+    }
+
+    void pack(dcl::ByteBuffer& buf) const {
+        Request::pack(buf);
+        buf << _commandQueueIds << _commandId << _bufferIds << _offsets << _cb
+                << _chunkSize << _predecessorUrl << _successorId
+                << _eventIdWaitList << _event;
+    }
+
+    void unpack(dcl::ByteBuffer& buf) {
+        Request::unpack(buf);
+        buf >> _commandQueueIds >> _commandId >> _bufferIds >> _offsets >> _cb
+                >> _chunkSize >> _predecessorUrl >> _successorId
+                >> _eventIdWaitList >> _event;
+    }
+
+private:
+    std::vector<dcl::object_id> _commandQueueIds;
+    dcl::object_id _commandId;
+    std::vector<dcl::object_id> _bufferIds;
+    std::vector<size_t> _offsets;
+    size_t _cb;
+    size_t _chunkSize;
+    std::string _predecessorUrl;
+    dcl::process_id _successorId;
+    std::vector<dcl::object_id> _eventIdWaitList;
+    bool _event;
+};
+
+} /* namespace message */
+} /* namespace dclasio */
+
+#endif /* ENQUEUEWRITEBUFFERS_H_ */
@@ -55,22 +55,23 @@
 #include <CL/cl.h>
 #endif
 
+#include <vector>
+
 namespace dclasio {
 namespace message {
 
 /*!
  * \brief A response message containing all event profiling information.
+ *
+ * The response contains the profiling info of all requested events in the
+ * order of the request. If the profiling info of an event is not available,
+ * its error code is set and its times are undefined.
  */
 class EventProfilingInfosReponse: public DefaultResponse {
 public:
     EventProfilingInfosReponse();
     EventProfilingInfosReponse(
-            const Request& request,
-            cl_ulong received,
-            cl_ulong queued,
-            cl_ulong submit,
-            cl_ulong start,
-            cl_ulong end);
+            const Request& request);
     EventProfilingInfosReponse(
             const EventProfilingInfosReponse& rhs);
     virtual ~EventProfilingInfosReponse();
@@ -83,19 +84,20 @@ public:
 
     void pack(dcl::ByteBuffer& buf) const {
         DefaultResponse::pack(buf);
-        buf << received << queued << submit << start << end;
+        buf << errcodes << received << queued << submit << start << end;
     }
 
     void unpack(dcl::ByteBuffer& buf) {
         DefaultResponse::unpack(buf);
-        buf >> received >> queued >> submit >> start >> end;
+        buf >> errcodes >> received >> queued >> submit >> start >> end;
     }
 
-    cl_ulong received;
-    cl_ulong queued;
-    cl_ulong submit;
-    cl_ulong start;
-    cl_ulong end;
+    std::vector<cl_int> errcodes;
+    std::vector<cl_ulong> received;
+    std::vector<cl_ulong> queued;
+    std::vector<cl_ulong> submit;
+    std::vector<cl_ulong> start;
+    std::vector<cl_ulong> end;
 };
 
 } /* namespace message */
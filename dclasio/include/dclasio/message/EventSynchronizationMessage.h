@@ -58,17 +58,27 @@ namespace message {
  *
  * This message is sent by compute nodes to synchronize with an event, i.e. to
  * update to the changes associated with the specified event.
+ * The host forwards this message to the compute node of the event. If the
+ * message specifies a destination, that compute node releases the changes
+ * directly to the destination compute node rather than to the host.
  */
 class EventSynchronizationMessage: public Message {
 public:
     EventSynchronizationMessage();
     EventSynchronizationMessage(
-            const dcl::object_id commandId);
+            const dcl::object_id commandId,
+            const dcl::process_id destinationId = 0);
     EventSynchronizationMessage(
             const EventSynchronizationMessage& rhs);
     virtual ~EventSynchronizationMessage();
 
     dcl::object_id commandId() const;
+    /**
+     * @brief Returns the ID of the compute node the changes are released to
+     *
+     * @return a process ID, or 0 if the changes are released to the sender of this message
+     */
+    dcl::process_id destinationId() const;
 
     static const class_type TYPE = 8802;
 
@@ -77,15 +87,16 @@ public:
     }
 
     void pack(dcl::ByteBuffer& buf) const {
-        buf << _commandId;
+        buf << _commandId << _destinationId;
     }
 
     void unpack(dcl::ByteBuffer& buf) {
-        buf >> _commandId;
+        buf >> _commandId >> _destinationId;
     }
 
 private:
     dcl::object_id _commandId;
+    dcl::process_id _destinationId;
 };
 
 } /* namespace message */
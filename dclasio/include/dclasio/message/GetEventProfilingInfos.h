@@ -49,22 +49,29 @@
 #include <dcl/ByteBuffer.h>
 #include <dcl/DCLTypes.h>
 
+#include <vector>
+
 namespace dclasio {
 namespace message {
 
 /*!
  * \brief A request message for obtaining event profiling info.
+ *
+ * The profiling info of several events can be requested at once, in order to
+ * save round trips when profiling many commands.
  */
 class GetEventProfilingInfos: public Request {
 public:
     GetEventProfilingInfos();
 	GetEventProfilingInfos(
 			dcl::object_id eventID);
+	GetEventProfilingInfos(
+			const std::vector<dcl::object_id>& eventIds);
 	GetEventProfilingInfos(
 	        const GetEventProfilingInfos& rhs);
 	virtual ~GetEventProfilingInfos();
 
-	dcl::object_id eventId() const;
+	const std::vector<dcl::object_id>& eventIds() const;
 
     static const class_type TYPE = 100 + GET_EVENT_PROFILING_INFOS;
 
@@ -74,16 +81,16 @@ public:
 
     void pack(dcl::ByteBuffer& buf) const {
         Request::pack(buf);
-        buf << _eventId;
+        buf << _eventIds;
     }
 
     void unpack(dcl::ByteBuffer& buf) {
         Request::unpack(buf);
-        buf >> _eventId;
+        buf >> _eventIds;
     }
 
 private:
-	dcl::object_id _eventId;
+	std::vector<dcl::object_id> _eventIds;
 };
 
 } /* namespace message */
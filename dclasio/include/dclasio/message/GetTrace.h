@@ -0,0 +1,136 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file GetTrace.h
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#ifndef GETTRACE_H_
+#define GETTRACE_H_
+
+#include "Request.h"
+#include "Response.h"
+
+#include <dcl/ByteBuffer.h>
+
+#include <dcl/util/Trace.h>
+
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#include <string>
+#include <vector>
+
+namespace dclasio {
+namespace message {
+
+/*!
+ * \brief A request message for obtaining the spans recorded by a compute node.
+ */
+class GetTrace: public Request {
+public:
+    GetTrace();
+    GetTrace(
+            const GetTrace& rhs);
+    virtual ~GetTrace();
+
+    static const class_type TYPE = 100 + GET_TRACE;
+
+    class_type get_type() const {
+        return TYPE;
+    }
+};
+
+/* ****************************************************************************/
+
+/*!
+ * \brief A response message containing the spans recorded by a compute node.
+ *
+ * The time stamps of the spans are provided by the compute node's clock.
+ */
+class TraceResponse: public DefaultResponse {
+public:
+    TraceResponse();
+    TraceResponse(
+            const Request& request,
+            const std::vector<dcl::util::TraceRecord>& records);
+    TraceResponse(
+            const TraceResponse& rhs);
+    virtual ~TraceResponse();
+
+    /*!
+     * \brief Returns the spans of this response
+     *
+     * \param[out] records  the spans
+     */
+    void records(
+            std::vector<dcl::util::TraceRecord>& records) const;
+
+    static const class_type TYPE = 200 + Request::GET_TRACE;
+
+    class_type get_type() const {
+        return TYPE;
+    }
+
+    void pack(dcl::ByteBuffer& buf) const {
+        DefaultResponse::pack(buf);
+        buf << _names << _categories << _threads << _start << _end << _args;
+    }
+
+    void unpack(dcl::ByteBuffer& buf) {
+        DefaultResponse::unpack(buf);
+        buf >> _names >> _categories >> _threads >> _start >> _end >> _args;
+    }
+
+private:
+    std::vector<std::string> _names;
+    std::vector<std::string> _categories;
+    std::vector<cl_uint> _threads;
+    std::vector<cl_ulong> _start;
+    std::vector<cl_ulong> _end;
+    std::vector<cl_ulong> _args;
+};
+
+} /* namespace message */
+} /* namespace dclasio */
+
+#endif /* GETTRACE_H_ */
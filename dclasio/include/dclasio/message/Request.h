@@ -61,6 +61,8 @@ public:
 
 	    GET_DEVICE_IDS              = 1,
 	    GET_DEVICE_INFO             = 2,
+	    SYNCHRONIZE_CLOCK           = 3,
+	    GET_TRACE                   = 4,
 
 	    CREATE_CONTEXT              = 11,
 	    RELEASE_CONTEXT             = 12,
@@ -90,6 +92,7 @@ public:
 	    CREATE_EVENT                = 61,
 	    RELEASE_EVENT               = 62,
 	    GET_EVENT_PROFILING_INFOS   = 63,
+	    SUBSCRIBE_EVENT             = 64,
 
 	    FLUSH                       = 71,
 	    FINISH                      = 72,
@@ -105,7 +108,8 @@ public:
 	    ENQUEUE_UNMAP_BUFFER        = 89,
 
 	    ENQUEUE_BROADCAST_BUFFER    = 91,
-	    ENQUEUE_REDUCE_BUFFER       = 92
+	    ENQUEUE_REDUCE_BUFFER       = 92,
+	    ENQUEUE_WRITE_BUFFERS       = 93
 	};
 
 	Request();
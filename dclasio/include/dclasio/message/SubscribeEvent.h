@@ -0,0 +1,119 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+
+/*!
+ * \file SubscribeEvent.h
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#ifndef SUBSCRIBEEVENT_H_
+#define SUBSCRIBEEVENT_H_
+
+#include "Request.h"
+
+#include <dcl/ByteBuffer.h>
+#include <dcl/DCLTypes.h>
+
+namespace dclasio {
+
+namespace message {
+
+/*!
+ * \brief A request message for subscribing a compute node to the execution status of an event.
+ *
+ * This request is sent by the host to the compute node of an event, after a
+ * substitute event has been created on the subscriber. The compute node of
+ * the event then sends the final execution status of the event directly to
+ * the subscriber, rather than to the host which would forward it.
+ * The subscriber has connected to the compute node of the event when creating
+ * the substitute event.
+ *
+ * The request is executed in order with the requests of the event's command
+ * queue, such that the event has been created by the command before. The host
+ * forwards the final execution status itself, until the subscription has been
+ * acknowledged.
+ */
+class SubscribeEvent: public Request {
+public:
+    SubscribeEvent();
+    SubscribeEvent(
+            dcl::object_id  eventId,
+            dcl::object_id  commandQueueId,
+            dcl::process_id subscriberId);
+    SubscribeEvent(
+            const SubscribeEvent& rhs);
+    virtual ~SubscribeEvent();
+
+    dcl::object_id eventId() const;
+    /*!
+     * \brief Returns the ID of the command queue which created the event
+     */
+    dcl::object_id commandQueueId() const;
+    /*!
+     * \brief Returns the ID of the compute node which holds the substitute event
+     */
+    dcl::process_id subscriberId() const;
+
+    static const class_type TYPE = 100 + SUBSCRIBE_EVENT;
+
+    class_type get_type() const {
+        return TYPE;
+    }
+
+    void pack(dcl::ByteBuffer& buf) const {
+        Request::pack(buf);
+        buf << _eventId << _commandQueueId << _subscriberId;
+    }
+
+    void unpack(dcl::ByteBuffer& buf) {
+        Request::unpack(buf);
+        buf >> _eventId >> _commandQueueId >> _subscriberId;
+    }
+
+private:
+    dcl::object_id _eventId;
+    dcl::object_id _commandQueueId;
+    dcl::process_id _subscriberId;
+};
+
+} /* namespace message */
+
+} /* namespace dclasio */
+
+#endif /* SUBSCRIBEEVENT_H_ */
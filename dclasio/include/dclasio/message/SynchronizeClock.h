@@ -0,0 +1,125 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file SynchronizeClock.h
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#ifndef SYNCHRONIZECLOCK_H_
+#define SYNCHRONIZECLOCK_H_
+
+#include "Request.h"
+#include "Response.h"
+
+#include <dcl/ByteBuffer.h>
+
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+namespace dclasio {
+namespace message {
+
+/*!
+ * \brief A request message for obtaining a compute node's clock.
+ *
+ * The compute node responds immediately, i.e., without awaiting preceding
+ * requests, such that the round-trip delay of this request is minimal.
+ */
+class SynchronizeClock: public Request {
+public:
+    SynchronizeClock();
+    SynchronizeClock(
+            const SynchronizeClock& rhs);
+    virtual ~SynchronizeClock();
+
+    static const class_type TYPE = 100 + SYNCHRONIZE_CLOCK;
+
+    class_type get_type() const {
+        return TYPE;
+    }
+};
+
+/* ****************************************************************************/
+
+/*!
+ * \brief A response message containing a compute node's clock.
+ */
+class ClockResponse: public DefaultResponse {
+public:
+    ClockResponse();
+    /*!
+     * \param[in]  request  the answered request
+     * \param[in]  received time of receiving the request (compute node clock)
+     * \param[in]  sent     time of sending this response (compute node clock)
+     */
+    ClockResponse(
+            const Request& request,
+            cl_ulong received,
+            cl_ulong sent);
+    ClockResponse(
+            const ClockResponse& rhs);
+    virtual ~ClockResponse();
+
+    static const class_type TYPE = 200 + Request::SYNCHRONIZE_CLOCK;
+
+    class_type get_type() const {
+        return TYPE;
+    }
+
+    void pack(dcl::ByteBuffer& buf) const {
+        DefaultResponse::pack(buf);
+        buf << received << sent;
+    }
+
+    void unpack(dcl::ByteBuffer& buf) {
+        DefaultResponse::unpack(buf);
+        buf >> received >> sent;
+    }
+
+    cl_ulong received;
+    cl_ulong sent;
+};
+
+} /* namespace message */
+} /* namespace dclasio */
+
+#endif /* SYNCHRONIZECLOCK_H_ */
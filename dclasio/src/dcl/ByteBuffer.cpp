@@ -45,35 +45,217 @@
 #include <dcl/ByteBuffer.h>
 
 #include <algorithm>
+#include <cassert>
 #if USE_CSTRING
 #include <cstring>
 #endif
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
+
+namespace {
+
+/*!
+ * \brief A pool of recycled memory blocks
+ *
+ * Blocks are pooled in size classes of powers of two. Only a limited number
+ * of blocks is kept per size class, and large blocks are not pooled at all.
+ * Each thread has its own pool, such that no synchronization is required.
+ */
+class BlockPool {
+public:
+    static const size_t MIN_BLOCK_SIZE = dcl::ByteBuffer::DEFAULT_SIZE;
+    static const size_t NUM_SIZE_CLASSES = 12; //!< block sizes from 512 bytes to 1 MiB
+    static const size_t MAX_BLOCK_SIZE = MIN_BLOCK_SIZE << (NUM_SIZE_CLASSES - 1);
+    static const size_t MAX_BLOCKS_PER_SIZE_CLASS = 8;
+
+    BlockPool() {
+        for (auto& blocks : _blocks) {
+            blocks.reserve(MAX_BLOCKS_PER_SIZE_CLASS);
+        }
+    }
+
+    ~BlockPool() {
+        for (auto& blocks : _blocks) {
+            for (auto block : blocks) {
+                delete[] block;
+            }
+        }
+        destroyed = true;
+    }
+
+    /*!
+     * \brief Returns the size of the pooled block which can hold the specified number of bytes
+     * \param[in]  size the number of bytes
+     * \return the block size, or 0 if blocks of this size are not pooled
+     */
+    static size_t block_size(
+            size_t size) {
+        if (size > MAX_BLOCK_SIZE) return 0;
+        size_t block_size = MIN_BLOCK_SIZE;
+        while (block_size < size) {
+            block_size *= 2;
+        }
+        return block_size;
+    }
+
+    char * allocate(
+            size_t block_size) {
+        auto& blocks = _blocks[size_class(block_size)];
+        if (blocks.empty()) {
+            return new char[block_size];
+        }
+
+        char *block = blocks.back();
+        blocks.pop_back();
+        return block;
+    }
+
+    void release(
+            char *block,
+            size_t block_size) {
+        auto& blocks = _blocks[size_class(block_size)];
+        if (blocks.size() < MAX_BLOCKS_PER_SIZE_CLASS) {
+            blocks.push_back(block);
+        } else {
+            delete[] block;
+        }
+    }
+
+    /* Blocks must not be returned to a pool which has been destroyed at thread
+     * exit. As a trivial type, this flag outlives the pool. */
+    static thread_local bool destroyed;
+
+private:
+    static size_t size_class(
+            size_t block_size) {
+        size_t i = 0;
+        while ((MIN_BLOCK_SIZE << i) < block_size) {
+            ++i;
+        }
+        return i;
+    }
+
+    std::vector<char *> _blocks[NUM_SIZE_CLASSES];
+};
+
+thread_local bool BlockPool::destroyed = false;
+
+BlockPool& block_pool() {
+    static thread_local BlockPool pool;
+    return pool;
+}
+
+} /* unnamed namespace */
+
+/* ****************************************************************************/
 
 namespace dcl {
 
+void ByteBuffer::block_deleter::operator()(value_type *block) const {
+    if (capacity > 0 && !BlockPool::destroyed) {
+        block_pool().release(block, capacity);
+    } else {
+        delete[] block;
+    }
+}
+
+ByteBuffer::block_type ByteBuffer::allocate_block(size_type size) {
+    if (size == 0) return block_type();
+
+    auto block_size = BlockPool::block_size(size);
+    if (block_size == 0 || BlockPool::destroyed) {
+        // block is too large to be pooled
+        return block_type(new value_type[size]);
+    }
+
+    return block_type(block_pool().allocate(block_size), block_deleter(block_size));
+}
+
 ByteBuffer::ByteBuffer() :
-    _pos(0), _len(0), _max_size(DEFAULT_MAX_SIZE), _size(DEFAULT_SIZE), _bytes(new value_type[_size]) { }
+    _pos(0), _len(0), _max_size(std::numeric_limits<size_type>::max()),
+    _bytes(allocate_block(DEFAULT_SIZE)), _data(_bytes.get()),
+    _gather_threshold(std::numeric_limits<size_type>::max()), _referenced_size(0) {
+    _size = _bytes.get_deleter().capacity;
+}
 ByteBuffer::ByteBuffer(size_type initial_size) :
-    _pos(0), _len(0), _max_size(DEFAULT_MAX_SIZE), _size(initial_size), _bytes(new value_type[_size]) { }
+    _pos(0), _len(0), _max_size(std::numeric_limits<size_type>::max()),
+    _bytes(allocate_block(initial_size)), _data(_bytes.get()),
+    _gather_threshold(std::numeric_limits<size_type>::max()), _referenced_size(0) {
+    // a pooled block may be larger than requested
+    _size = (_bytes.get_deleter().capacity > 0) ? _bytes.get_deleter().capacity : initial_size;
+}
 ByteBuffer::ByteBuffer(size_type size, value_type bytes[]) :
-    _pos(0), _len(size), _max_size(DEFAULT_MAX_SIZE), _size(size), _bytes(bytes) { }
+    _pos(0), _len(size), _max_size(std::numeric_limits<size_type>::max()), _size(size),
+    _bytes(bytes), _data(_bytes.get()),
+    _gather_threshold(std::numeric_limits<size_type>::max()), _referenced_size(0) { }
 ByteBuffer::ByteBuffer(ByteBuffer&& other) :
-    _pos(other._pos), _len(other._len), _max_size(DEFAULT_MAX_SIZE), _size(other._size), _bytes(std::move(other._bytes)) { }
+    _pos(other._pos), _len(other._len), _max_size(other._max_size), _size(other._size),
+    _bytes(std::move(other._bytes)), _data(other._data),
+    _gather_threshold(other._gather_threshold), _references(std::move(other._references)),
+    _referenced_size(other._referenced_size) {
+    other._pos = other._len = other._size = other._referenced_size = 0;
+    other._data = nullptr;
+}
 ByteBuffer::~ByteBuffer() { }
 
+ByteBuffer ByteBuffer::view(size_type size, const value_type *bytes) {
+    ByteBuffer buf(0);
+    /* The buffer view is read-only, such that the const qualifier can
+     * safely be removed */
+    buf._data = const_cast<pointer>(bytes);
+    buf._len = buf._size = size;
+    buf._max_size = size; // prevent writing to the buffer view
+    return buf;
+}
+
+void ByteBuffer::reserve(size_type size) {
+    if (size > _max_size) throw std::out_of_range("Internal buffer overflow");
+    if (size <= _size) return; // no operation
+
+    auto bytes = allocate_block(size);
+    std::copy(_data, _data + _len, bytes.get());
+    _bytes = std::move(bytes); // returns previous block to pool
+    _data = _bytes.get();
+    _size = (_bytes.get_deleter().capacity > 0) ? _bytes.get_deleter().capacity : size;
+}
+
 void ByteBuffer::set_max_size(size_type max_size) {
     // max_size must not be reduced below current buffer size
     if (max_size < _size) throw std::out_of_range("Buffer limit must be greater than buffer size");
     _max_size = max_size;
 }
 
+void ByteBuffer::set_gather_threshold(size_type threshold) {
+    _gather_threshold = threshold;
+}
+
+void ByteBuffer::write(const void *data, size_type size) {
+    if (size >= _gather_threshold) {
+        // reference value rather than copying it
+        reference_type reference = { _len, static_cast<const_pointer>(data), size };
+        _references.push_back(reference);
+        _referenced_size += size;
+    } else {
+        ensure_free(size);
+        auto begin = static_cast<const_pointer>(data);
+        std::copy(begin, begin + size, _data + _len);
+        _len += size;
+    }
+}
+
+void ByteBuffer::read(void *data, size_type size) {
+    ensure_bytes(size);
+    std::copy(_data + _pos, _data + _pos + size, static_cast<pointer>(data));
+    _pos += size;
+}
+
 ByteBuffer& ByteBuffer::operator<<(const bool flag) {
     ensure_free(1);
-    _bytes[_len] = (flag ? 1 : 0);
+    _data[_len] = (flag ? 1 : 0);
     ++_len;
     return *this;
 }
@@ -81,9 +263,7 @@ ByteBuffer& ByteBuffer::operator<<(const bool flag) {
 #if USE_CSTRING
 ByteBuffer& ByteBuffer::operator<<(const char *str) {
     size_t size = strlen(str) + 1; // size of C string including terminating null character
-    ensure_free(size);
-    std::copy(str, str + size, end());
-    _len += size;
+    write(str, size);
     return *this;
 }
 #endif
@@ -91,32 +271,27 @@ ByteBuffer& ByteBuffer::operator<<(const char *str) {
 ByteBuffer& ByteBuffer::operator<<(const std::string& str) {
     auto size = str.size();
     operator<<(size); // write number of characters
-    ensure_free(size);
-    std::copy(std::begin(str), std::end(str), end());
-    _len += size;
+    write(str.data(), size);
     return *this;
 }
 
 ByteBuffer& ByteBuffer::operator<<(const Binary& data) {
     auto size = data.size();
     operator<<(size); // write number of bytes
-    ensure_free(size);
-    auto begin = static_cast<const value_type *>(data.value());
-    std::copy(begin, begin + size, end());
-    _len += size;
+    write(data.value(), size);
     return *this;
 }
 
 ByteBuffer& ByteBuffer::operator>>(bool& flag) {
     ensure_bytes(1);
-    flag = (_bytes[_pos] != 0);
+    flag = (_data[_pos] != 0);
     ++_pos;
     return *this;
 }
 
 #if USE_CSTRING
 ByteBuffer& ByteBuffer::operator>>(char *str) {
-    size_t size = strlen(reinterpret_cast<char *>(_bytes.get() + _pos)) + 1;
+    size_t size = strlen(reinterpret_cast<char *>(_data + _pos)) + 1;
     ensure_bytes(size); // fails if C string is not terminated (within this buffer)
     std::copy(cbegin(), cbegin() + size, str);
     _pos += size;
@@ -146,34 +321,57 @@ void ByteBuffer::resize(size_type size_) {
     reserve(size_); // no operation, if internal buffer size is greater or equal
     _pos = 0;
     _len = size_;
+    _references.clear();
+    _referenced_size = 0;
 }
 
 ByteBuffer::size_type ByteBuffer::size() const {
-    return _len - _pos;
+    return _len - _pos + _referenced_size;
+}
+
+void ByteBuffer::segments(std::vector<segment_type>& segments) const {
+    size_type pos = _pos;
+
+    segments.clear();
+    for (const auto& reference : _references) {
+        // own bytes preceding referenced value
+        if (reference.offset > pos) {
+            segments.push_back(segment_type(_data + pos, reference.offset - pos));
+            pos = reference.offset;
+        }
+        if (reference.size > 0) {
+            segments.push_back(segment_type(reference.data, reference.size));
+        }
+    }
+    if (_len > pos) {
+        segments.push_back(segment_type(_data + pos, _len - pos));
+    }
 }
 
 ByteBuffer::iterator ByteBuffer::begin() {
-    return _bytes.get() + _pos;
+    assert(_references.empty() && "Buffer references values");
+    return _data + _pos;
 }
 
 ByteBuffer::const_iterator ByteBuffer::begin() const {
-    return _bytes.get() + _pos;
+    assert(_references.empty() && "Buffer references values");
+    return _data + _pos;
 }
 
 ByteBuffer::const_iterator ByteBuffer::cbegin() const {
-    return _bytes.get() + _pos;
+    return _data + _pos;
 }
 
 ByteBuffer::iterator ByteBuffer::end() {
-    return _bytes.get() + _len;
+    return _data + _len;
 }
 
 ByteBuffer::const_iterator ByteBuffer::end() const {
-    return _bytes.get() + _len;
+    return _data + _len;
 }
 
 ByteBuffer::const_iterator ByteBuffer::cend() const {
-    return _bytes.get() + _len;
+    return _data + _len;
 }
 
 } // namespace dcl
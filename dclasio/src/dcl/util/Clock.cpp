@@ -49,7 +49,43 @@
 #include <CL/cl.h>
 #endif
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+
+namespace {
+
+/*!
+ * \brief Maximum number of samples considered by a clock offset estimator
+ */
+const std::size_t MAX_SAMPLES = 64;
+
+/*!
+ * \brief Tolerance for the round-trip delay of samples
+ *
+ * Samples whose round-trip delay exceeds the minimum delay by more than this
+ * factor and DELAY_SLACK are not considered, as their offsets are distorted by
+ * queuing delays.
+ */
+const double DELAY_TOLERANCE = 1.5;
+const double DELAY_SLACK = 10000.0; //!< 10 microseconds
+
+/*!
+ * \brief Minimum period of time spanned by samples to estimate a drift
+ */
+const double MIN_DRIFT_PERIOD = 1e9; //!< 1 second
+
+/*!
+ * \brief Returns the signed difference of two time stamps as floating point number
+ */
+double difference(cl_ulong lhs, cl_ulong rhs) {
+    return static_cast<double>(static_cast<cl_long>(lhs - rhs));
+}
+
+} /* unnamed namespace */
 
 namespace dcl {
 
@@ -59,8 +95,7 @@ Clock clock;
 
 /******************************************************************************/
 
-Clock::Clock() : _start(std::chrono::high_resolution_clock::now()) {
-    sync();
+Clock::Clock() : _start(std::chrono::steady_clock::now()) {
 }
 
 Clock::~Clock() {
@@ -68,16 +103,97 @@ Clock::~Clock() {
 
 cl_ulong Clock::getTime() {
     /* get local elapsed time in nanoseconds */
-    cl_ulong local_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
-            std::chrono::high_resolution_clock::now() - _start).count();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - _start).count();
+}
+
+/******************************************************************************/
+
+ClockOffset::ClockOffset() :
+    _time(0), _offset(0.0), _drift(0.0), _error(0.0) {
+}
 
-    /* return local time adjusted to global clock */
-    return local_time + _clockSkew;
+void ClockOffset::addSample(cl_ulong t0, cl_ulong t1, cl_ulong t2, cl_ulong t3) {
+    Sample sample;
+    sample.time = t0 + (t3 - t0) / 2;
+    sample.offset = (difference(t1, t0) + difference(t2, t3)) / 2.0;
+    sample.delay = std::max(difference(t3, t0) - difference(t2, t1), 0.0);
+
+    _samples.push_back(sample);
+    if (_samples.size() > MAX_SAMPLES) _samples.pop_front();
+
+    estimate();
 }
 
-void Clock::sync() {
-    /* TODO Synchronize system clock with a global clock (e.g., using NTP) */
-    _clockSkew = 0;
+bool ClockOffset::isValid() const {
+    return !_samples.empty();
+}
+
+double ClockOffset::offset(cl_ulong localTime) const {
+    return _offset + _drift * difference(localTime, _time);
+}
+
+double ClockOffset::drift() const {
+    return _drift;
+}
+
+double ClockOffset::error() const {
+    return _error;
+}
+
+cl_ulong ClockOffset::toLocalTime(cl_ulong remoteTime) const {
+    /* The offset is a function of local time, which is approximated using the
+     * offset at the reference time */
+    cl_ulong localTime = remoteTime - static_cast<cl_long>(std::llround(_offset));
+    return remoteTime - static_cast<cl_long>(std::llround(offset(localTime)));
+}
+
+void ClockOffset::estimate() {
+    if (_samples.empty()) return;
+
+    /* Select samples with a small round-trip delay */
+    auto best = std::min_element(std::begin(_samples), std::end(_samples),
+            [](const Sample& lhs, const Sample& rhs) { return lhs.delay < rhs.delay; });
+    const double maxDelay = std::max(best->delay * DELAY_TOLERANCE, best->delay + DELAY_SLACK);
+    std::deque<Sample> samples;
+    for (const auto& sample : _samples) {
+        if (sample.delay <= maxDelay) samples.push_back(sample);
+    }
+
+    /* Use the most recent sample as reference */
+    _time = samples.back().time;
+    _offset = best->offset;
+    _drift = 0.0;
+
+    double period = difference(samples.back().time, samples.front().time);
+    if (samples.size() > 1 && period >= MIN_DRIFT_PERIOD) {
+        /* Least squares fit of the offsets */
+        double meanTime = 0.0, meanOffset = 0.0;
+        for (const auto& sample : samples) {
+            meanTime += difference(sample.time, _time);
+            meanOffset += sample.offset;
+        }
+        meanTime /= samples.size();
+        meanOffset /= samples.size();
+
+        double covariance = 0.0, variance = 0.0;
+        for (const auto& sample : samples) {
+            double x = difference(sample.time, _time) - meanTime;
+            covariance += x * (sample.offset - meanOffset);
+            variance += x * x;
+        }
+        _drift = covariance / variance;
+        _offset = meanOffset - _drift * meanTime;
+    }
+
+    /* The error bound comprises the uncertainty of the best sample and the
+     * deviation of the other samples from the estimate */
+    double deviation = 0.0;
+    for (const auto& sample : samples) {
+        deviation = std::max(deviation,
+                std::abs(sample.offset - offset(sample.time)));
+    }
+    _error = best->delay / 2.0 + deviation;
 }
 
 } /* namespace util */
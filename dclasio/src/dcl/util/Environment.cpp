@@ -0,0 +1,81 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file Environment.cpp
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include <dcl/util/Environment.h>
+
+#include <dcl/util/Logger.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ostream>
+
+namespace dcl {
+
+namespace util {
+
+size_t getEnvSize(
+        const char *name,
+        size_t defaultValue,
+        size_t minValue,
+        bool warn) {
+    const char *value = getenv(name);
+
+    if (value) {
+        char *end;
+        unsigned long long size = strtoull(value, &end, 10);
+        if (*value != '\0' && *end == '\0' && size >= minValue) {
+            return static_cast<size_t>(size);
+        }
+        if (warn) {
+            Logger << Warning
+                    << "Ignoring invalid value of " << name << ": " << value
+                    << std::endl;
+        }
+    }
+
+    return defaultValue;
+}
+
+} /* namespace util */
+
+} /* namespace dcl */
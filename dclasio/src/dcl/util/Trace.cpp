@@ -0,0 +1,249 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file Trace.cpp
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include <dcl/util/Trace.h>
+
+#include <dcl/util/Clock.h>
+#include <dcl/util/Environment.h>
+
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/*!
+ * \brief Default number of spans per thread
+ */
+const size_t DEFAULT_CAPACITY = 65536;
+
+/*!
+ * \brief Trace buffer of the current thread
+ */
+thread_local dcl::util::TraceBuffer *threadBuffer = nullptr;
+
+} /* unnamed namespace */
+
+namespace dcl {
+
+namespace util {
+
+Tracer tracer;
+
+/******************************************************************************/
+
+TraceBuffer::TraceBuffer(size_t capacity, cl_uint thread) :
+    _spans(capacity), _count(0), _thread(thread) {
+}
+
+void TraceBuffer::record(const char *name, const char *category,
+        cl_ulong start, cl_ulong end, cl_ulong arg) {
+    size_t count = _count.load(std::memory_order_relaxed);
+    Span& span = _spans[count % _spans.size()];
+    span.name = name;
+    span.category = category;
+    span.start = start;
+    span.end = end;
+    span.arg = arg;
+    /* publish span */
+    _count.store(count + 1, std::memory_order_release);
+}
+
+void TraceBuffer::copy(std::vector<TraceRecord>& records) const {
+    size_t count = _count.load(std::memory_order_acquire);
+    size_t first = count - std::min(count, _spans.size());
+    std::vector<Span> spans;
+    spans.reserve(count - first);
+    for (size_t i = first; i < count; ++i) {
+        spans.push_back(_spans[i % _spans.size()]);
+    }
+
+    /* Drop spans which may have been overwritten while copying. The slot of a
+     * span is reused by the span which is recorded 'capacity' spans later. */
+    std::atomic_thread_fence(std::memory_order_acquire);
+    size_t current = _count.load(std::memory_order_relaxed) + 1;
+    size_t valid = current > _spans.size() ? current - _spans.size() : 0;
+    size_t i = first;
+    for (const auto& span : spans) {
+        if (i++ < valid) continue;
+        TraceRecord record;
+        record.name = span.name;
+        record.category = span.category;
+        record.thread = _thread;
+        record.start = span.start;
+        record.end = span.end;
+        record.arg = span.arg;
+        records.push_back(record);
+    }
+}
+
+/******************************************************************************/
+
+Tracer::Tracer() : _enabled(false), _capacity(DEFAULT_CAPACITY) {
+    const char *fileName = getenv("DCL_TRACE");
+    if (fileName && *fileName != '\0') {
+        _enabled = true;
+        _fileName = fileName;
+    }
+
+    /* Invalid values are not logged, as the logger may not have been
+     * initialized yet */
+    _capacity = getEnvSize("DCL_TRACE_BUFFER_SIZE", DEFAULT_CAPACITY, 1, false);
+}
+
+Tracer::~Tracer() {
+}
+
+const std::string& Tracer::fileName() const {
+    return _fileName;
+}
+
+void Tracer::record(const char *name, const char *category,
+        cl_ulong start, cl_ulong end, cl_ulong arg) {
+    if (!_enabled) return;
+
+    if (!threadBuffer) {
+        /* Buffers are owned by the tracer, such that the spans of
+         * terminated threads are retained */
+        std::lock_guard<std::mutex> lock(_buffersMutex);
+        _buffers.emplace_back(new TraceBuffer(_capacity, _buffers.size() + 1));
+        threadBuffer = _buffers.back().get();
+    }
+    threadBuffer->record(name, category, start, end, arg);
+}
+
+void Tracer::collect(std::vector<TraceRecord>& records) const {
+    std::lock_guard<std::mutex> lock(_buffersMutex);
+    records.clear();
+    for (const auto& buffer : _buffers) {
+        buffer->copy(records);
+    }
+}
+
+/******************************************************************************/
+
+TraceSpan::TraceSpan(const char *name, const char *category, cl_ulong arg) :
+    _name(name), _category(category), _start(0), _arg(arg) {
+    if (tracer.isEnabled()) _start = clock.getTime();
+}
+
+TraceSpan::~TraceSpan() {
+    if (tracer.isEnabled()) {
+        tracer.record(_name, _category, _start, clock.getTime(), _arg);
+    }
+}
+
+void TraceSpan::setArg(cl_ulong arg) {
+    _arg = arg;
+}
+
+/******************************************************************************/
+
+TraceWriter::TraceWriter(std::ostream& out) :
+    _out(out), _empty(true) {
+    _out << "{\"traceEvents\":[";
+}
+
+TraceWriter::~TraceWriter() {
+    _out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    _out.flush();
+}
+
+void TraceWriter::write(cl_uint pid, const std::string& name,
+        const std::vector<TraceRecord>& records) {
+    char timestamp[32];
+
+    /* name the process */
+    _out << (_empty ? "\n" : ",\n")
+            << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+            << ",\"args\":{\"name\":";
+    writeString(name);
+    _out << "}}";
+    _empty = false;
+
+    for (const auto& record : records) {
+        _out << ",\n{\"name\":";
+        writeString(record.name);
+        _out << ",\"cat\":";
+        writeString(record.category);
+        /* time stamps are written in microseconds */
+        snprintf(timestamp, sizeof(timestamp), "%.3f", record.start / 1000.0);
+        _out << ",\"ph\":\"X\",\"ts\":" << timestamp;
+        snprintf(timestamp, sizeof(timestamp), "%.3f",
+                (record.end - std::min(record.start, record.end)) / 1000.0);
+        _out << ",\"dur\":" << timestamp
+                << ",\"pid\":" << pid << ",\"tid\":" << record.thread
+                << ",\"args\":{\"arg\":" << record.arg << "}}";
+    }
+}
+
+void TraceWriter::writeString(const std::string& str) {
+    _out << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            _out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            _out << ' ';
+        } else {
+            _out << c;
+        }
+    }
+    _out << '"';
+}
+
+} /* namespace util */
+
+} /* namespace dcl */
@@ -102,7 +102,7 @@ HostCommunicationManager * HostCommunicationManager::create() {
 /* ****************************************************************************/
 
 ComputeNodeCommunicationManager * ComputeNodeCommunicationManager::create(
-        const std::string& url) {
+        const std::string& url, unsigned int numThreads) {
     std::string host;
     dclasio::port_type port = dclasio::CommunicationManagerImpl::DEFAULT_PORT;
     dclasio::CommunicationManagerImpl::resolve_url(url, host, port);
@@ -126,7 +126,7 @@ ComputeNodeCommunicationManager * ComputeNodeCommunicationManager::create(
     dcl::util::Logger.setLoggingLevel(getSeverity());
     dcl::util::Logger.setDefaultSeverity(dcl::util::Severity::Info);
 
-    return new dclasio::ComputeNodeCommunicationManagerImpl(host, port);
+    return new dclasio::ComputeNodeCommunicationManagerImpl(host, port, numThreads);
 }
 
 } /* namespace dcl */
@@ -307,12 +307,12 @@ void CommunicationManagerImpl::data_stream_connected(
 
 void CommunicationManagerImpl::message_received(
         comm::message_queue& msgq,
-        const message::Message& message) {
+        const std::shared_ptr<message::Message>& message) {
     // TODO Determine sender's process ID
     dcl::process_id pid = msgq.get_process_id();
 
     assert(_clEventProcessor && "No event processor");
-    if (_clEventProcessor->dispatch(message, pid))
+    if (_clEventProcessor->dispatch(*message, pid))
         return;
 
     // unknown message
@@ -194,7 +194,7 @@ public:
      */
     void message_received(
             comm::message_queue& msgq,
-            const message::Message& message);
+            const std::shared_ptr<message::Message>& message);
 
 protected:
     /* Connection managers must be non-copyable */
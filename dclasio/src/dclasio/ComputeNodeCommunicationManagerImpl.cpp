@@ -53,17 +53,48 @@
 #include "comm/CLRequestProcessor.h"
 #include "comm/MessageDispatcher.h"
 #include "comm/MessageQueue.h"
+#include "comm/RequestExecutor.h"
+
+#include <dclasio/message/DeleteCommandQueue.h>
+#include <dclasio/message/DeleteContext.h>
+#include <dclasio/message/DeleteEvent.h>
+#include <dclasio/message/DeleteKernel.h>
+#include <dclasio/message/DeleteMemory.h>
+#include <dclasio/message/DeleteProgram.h>
+#include <dclasio/message/EnqueueBarrier.h>
+#include <dclasio/message/EnqueueBroadcastBuffer.h>
+#include <dclasio/message/EnqueueCopyBuffer.h>
+#include <dclasio/message/EnqueueMapBuffer.h>
+#include <dclasio/message/EnqueueMarker.h>
+#include <dclasio/message/EnqueueNDRangeKernel.h>
+#include <dclasio/message/EnqueueReadBuffer.h>
+#include <dclasio/message/EnqueueReduceBuffer.h>
+#include <dclasio/message/EnqueueUnmapBuffer.h>
+#include <dclasio/message/EnqueueWaitForEvents.h>
+#include <dclasio/message/EnqueueWriteBuffer.h>
+#include <dclasio/message/EnqueueWriteBuffers.h>
+#include <dclasio/message/FinishRequest.h>
+#include <dclasio/message/FlushRequest.h>
+#include <dclasio/message/Message.h>
+#include <dclasio/message/Request.h>
+#include <dclasio/message/SubscribeEvent.h>
+#include <dclasio/message/SynchronizeClock.h>
 
 #include <dcl/ComputeNode.h>
 #include <dcl/ConnectionListener.h>
 #include <dcl/Daemon.h>
 #include <dcl/DCLException.h>
 #include <dcl/DCLTypes.h>
+#include <dcl/Event.h>
 
 #include <dcl/util/Logger.h>
 
+#include <boost/system/system_error.hpp>
+
+#include <algorithm>
 #include <cassert>
 #include <condition_variable>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -74,6 +105,99 @@
 #include <utility>
 #include <vector>
 
+namespace {
+
+using dclasio::comm::RequestExecutor;
+
+/*!
+ * \brief Checks if an event wait list contains events which have not been created yet.
+ *
+ * Events are created by enqueue requests, which may still be pending on the
+ * strand of another command queue.
+ */
+bool hasPendingEvents(
+        const dclasio::SmartCLObjectRegistry& registry,
+        const std::vector<dcl::object_id>& eventIds) {
+    return std::any_of(std::begin(eventIds), std::end(eventIds),
+            [&registry](dcl::object_id eventId) {
+                return !registry.lookup<std::shared_ptr<dcl::Event>>(eventId); });
+}
+
+/*!
+ * \brief Submits a command queue's request to the strands of the command queues.
+ *
+ * The request is executed after the pending requests of the host's strand,
+ * which create the objects it refers to. If it waits for events which have
+ * not been created yet, it is executed after all pending requests of the
+ * host.
+ */
+void executeOnQueues(
+        RequestExecutor& executor,
+        const dclasio::SmartCLObjectRegistry& registry,
+        dcl::process_id pid,
+        const std::vector<dcl::object_id>& commandQueueIds,
+        const std::vector<dcl::object_id>& eventIds,
+        const RequestExecutor::task_type& task) {
+    std::vector<RequestExecutor::strand_id> strands;
+    strands.reserve(commandQueueIds.size());
+    for (auto commandQueueId : commandQueueIds) {
+        strands.push_back(RequestExecutor::strand_id(pid, commandQueueId));
+    }
+    if (strands.empty()) {
+        strands.push_back(RequestExecutor::strand_id(pid, 0));
+    }
+
+    if (hasPendingEvents(registry, eventIds)) {
+        executor.executeBarrier(strands, task);
+    } else {
+        executor.executeAfter(strands,
+                std::vector<RequestExecutor::strand_id>(1, RequestExecutor::strand_id(pid, 0)),
+                task);
+    }
+}
+
+template<typename EnqueueRequest>
+void executeEnqueue(
+        RequestExecutor& executor,
+        const dclasio::SmartCLObjectRegistry& registry,
+        dcl::process_id pid,
+        const dclasio::message::Request& request,
+        const RequestExecutor::task_type& task) {
+    auto& enqueue = static_cast<const EnqueueRequest&>(request);
+    executeOnQueues(executor, registry, pid,
+            std::vector<dcl::object_id>(1, enqueue.commandQueueId()),
+            enqueue.eventIdWaitList(), task);
+}
+
+template<typename MulticastRequest>
+void executeMulticast(
+        RequestExecutor& executor,
+        const dclasio::SmartCLObjectRegistry& registry,
+        dcl::process_id pid,
+        const dclasio::message::Request& request,
+        const RequestExecutor::task_type& task) {
+    auto& multicast = static_cast<const MulticastRequest&>(request);
+    executeOnQueues(executor, registry, pid,
+            multicast.commandQueueIds(), multicast.eventIdWaitList(), task);
+}
+
+template<typename QueueRequest>
+void executeOnQueue(
+        RequestExecutor& executor,
+        const dclasio::SmartCLObjectRegistry& registry,
+        dcl::process_id pid,
+        const dclasio::message::Request& request,
+        const RequestExecutor::task_type& task) {
+    auto& queueRequest = static_cast<const QueueRequest&>(request);
+    executeOnQueues(executor, registry, pid,
+            std::vector<dcl::object_id>(1, queueRequest.commandQueueId()),
+            std::vector<dcl::object_id>(), task);
+}
+
+} /* unnamed namespace */
+
+/* ****************************************************************************/
+
 namespace dclasio {
 
 /* ****************************************************************************
@@ -81,10 +205,11 @@ namespace dclasio {
  ******************************************************************************/
 
 ComputeNodeCommunicationManagerImpl::ComputeNodeCommunicationManagerImpl(
-        const std::string& host, port_type port) :
+        const std::string& host, port_type port, unsigned int numThreads) :
 		CommunicationManagerImpl(host, port), _daemon(nullptr) {
 	_clEventProcessor.reset(new comm::CLHostEventProcessor(*this));
 	_clRequestProcessor.reset(new comm::CLRequestProcessor(*this));
+	_requestExecutor.reset(new comm::RequestExecutor(numThreads));
 }
 
 ComputeNodeCommunicationManagerImpl::~ComputeNodeCommunicationManagerImpl() {
@@ -201,6 +326,59 @@ HostImpl * ComputeNodeCommunicationManagerImpl::get_host(
     return (i != std::end(_hosts)) ? i->second.get() : nullptr;
 }
 
+ComputeNodeImpl * ComputeNodeCommunicationManagerImpl::connect_compute_node(
+        const std::string& url) {
+    std::unique_lock<std::mutex> lock(_connectedComputeNodesMutex);
+
+    /* wait for other threads connecting to the same compute node */
+    _computeNodeConnected.wait(lock, [this, &url] {
+        return (_connectingComputeNodes.find(url) == std::end(_connectingComputeNodes)); });
+
+    auto i = _connectedComputeNodes.find(url);
+    if (i != std::end(_connectedComputeNodes) && i->second->isConnected()) {
+        return i->second.get();
+    }
+
+    _connectingComputeNodes.insert(url);
+    lock.unlock();
+
+    /* allows other threads to retry if connecting fails */
+    auto abandon = [this, &url, &lock] {
+        lock.lock();
+        _connectingComputeNodes.erase(url);
+        _computeNodeConnected.notify_all();
+    };
+
+    std::vector<ComputeNodeImpl *> computeNodes;
+    std::unique_ptr<ComputeNodeImpl> computeNode;
+    try {
+        createComputeNodes({ url }, computeNodes);
+        if (computeNodes.empty()) {
+            throw dcl::ConnectionException("Invalid compute node URL '" + url + '\'');
+        }
+        computeNode.reset(computeNodes.front());
+
+        computeNode->connect(ProcessImpl::Type::COMPUTE_NODE, _pid);
+    } catch (const boost::system::system_error& err) {
+        abandon();
+        throw dcl::ConnectionException(err.what());
+    } catch (...) {
+        abandon();
+        throw;
+    }
+    dcl::util::Logger << dcl::util::Info
+            << "Connected to compute node '" << computeNode->url()
+            << "' (pid=" << computeNode->get_id() << ')'
+            << std::endl;
+
+    lock.lock();
+    auto& connectedComputeNode = _connectedComputeNodes[url];
+    connectedComputeNode = std::move(computeNode);
+    _connectingComputeNodes.erase(url);
+    _computeNodeConnected.notify_all();
+    return connectedComputeNode.get();
+}
+
 void ComputeNodeCommunicationManagerImpl::host_connected(
         comm::message_queue& msgq,
         dcl::process_id pid) {
@@ -308,6 +486,19 @@ void ComputeNodeCommunicationManagerImpl::message_queue_disconnected(
     // TODO Determine sender's process ID
     dcl::process_id pid = msgq.get_process_id();
     
+    if (get_host(pid)) {
+        /* Discard pending requests of host. Its session must not be destroyed
+         * before its running requests have finished. Waiting for them here
+         * would block the I/O thread, which running requests may depend on. */
+        _requestExecutor->cancel(pid,
+                std::bind(&ComputeNodeCommunicationManagerImpl::process_disconnected, this, pid));
+    } else {
+        process_disconnected(pid);
+    }
+}
+
+void ComputeNodeCommunicationManagerImpl::process_disconnected(
+        dcl::process_id pid) {
     auto host = get_host(pid);
     auto compute_node = get_compute_node(pid);
 
@@ -343,22 +534,129 @@ void ComputeNodeCommunicationManagerImpl::message_queue_disconnected(
 
 void ComputeNodeCommunicationManagerImpl::message_received(
         comm::message_queue& msgq,
-        const message::Message& message) {
+        const std::shared_ptr<message::Message>& message) {
     // TODO Determine sender's process ID
     dcl::process_id pid = msgq.get_process_id();
 
+    /* Events are processed immediately, such that event notifications are not
+     * delayed by pending requests */
     assert(_clEventProcessor && "No event processor");
-    if (_clEventProcessor->dispatch(message, pid))
+    if (_clEventProcessor->dispatch(*message, pid))
         return;
 
-    assert(_clRequestProcessor && "No request processor");
-    auto request = dynamic_cast<const message::Request *>(&message);
-    if (request && _clRequestProcessor->dispatch(*request, pid))
+    auto request = std::dynamic_pointer_cast<message::Request>(message);
+    if (request) {
+        execute_request(request, pid);
         return;
+    }
 
     // unknown message
     dcl::util::Logger << dcl::util::Error
             << "Received unknown message" << std::endl;
 }
 
+void ComputeNodeCommunicationManagerImpl::execute_request(
+        const std::shared_ptr<message::Request>& request,
+        dcl::process_id pid) {
+    assert(_clRequestProcessor && "No request processor");
+    comm::RequestExecutor::task_type task = [this, request, pid] {
+        if (!_clRequestProcessor->dispatch(*request, pid)) {
+            // unknown request
+            dcl::util::Logger << dcl::util::Error
+                    << "Received unknown request" << std::endl;
+        }
+    };
+
+    HostImpl *host = get_host(pid);
+    if (!host) {
+        /* the request processor discards requests from unknown processes */
+        _requestExecutor->execute(comm::RequestExecutor::strand_id(pid, 0), task);
+        return;
+    }
+    auto& executor = *_requestExecutor;
+    const SmartCLObjectRegistry& registry = host->objectRegistry();
+
+    switch (request->get_type()) {
+    case message::SynchronizeClock::TYPE:
+        /* Clock synchronization requests are executed immediately, as their
+         * response must not be delayed by preceding requests */
+        task();
+        break;
+
+    /* Requests of a command queue are executed on the command queue's strand,
+     * such that they do not stall the requests of other command queues */
+    case message::EnqueueBarrier::TYPE:
+        executeEnqueue<message::EnqueueBarrier>(executor, registry, pid, *request, task);
+        break;
+    case message::EnqueueCopyBuffer::TYPE:
+        executeEnqueue<message::EnqueueCopyBuffer>(executor, registry, pid, *request, task);
+        break;
+    case message::EnqueueMapBuffer::TYPE:
+        executeEnqueue<message::EnqueueMapBuffer>(executor, registry, pid, *request, task);
+        break;
+    case message::EnqueueMarker::TYPE:
+        executeEnqueue<message::EnqueueMarker>(executor, registry, pid, *request, task);
+        break;
+    case message::EnqueueNDRangeKernel::TYPE:
+        executeEnqueue<message::EnqueueNDRangeKernel>(executor, registry, pid, *request, task);
+        break;
+    case message::EnqueueReadBuffer::TYPE:
+        executeEnqueue<message::EnqueueReadBuffer>(executor, registry, pid, *request, task);
+        break;
+    case message::EnqueueReduceBuffer::TYPE:
+        /* the command queue ID is 0 on non-root nodes, i.e., the request is
+         * executed on the host's strand */
+        executeEnqueue<message::EnqueueReduceBuffer>(executor, registry, pid, *request, task);
+        break;
+    case message::EnqueueUnmapBuffer::TYPE:
+        executeEnqueue<message::EnqueueUnmapBuffer>(executor, registry, pid, *request, task);
+        break;
+    case message::EnqueueWriteBuffer::TYPE:
+        executeEnqueue<message::EnqueueWriteBuffer>(executor, registry, pid, *request, task);
+        break;
+    case message::EnqueueWaitForEvents::TYPE:
+    {
+        auto& waitForEvents = static_cast<const message::EnqueueWaitForEvents&>(*request);
+        executeOnQueues(executor, registry, pid,
+                std::vector<dcl::object_id>(1, waitForEvents.commandQueueId()),
+                waitForEvents.eventIdList(), task);
+        break;
+    }
+    case message::EnqueueBroadcastBuffer::TYPE:
+        executeMulticast<message::EnqueueBroadcastBuffer>(executor, registry, pid, *request, task);
+        break;
+    case message::EnqueueWriteBuffers::TYPE:
+        executeMulticast<message::EnqueueWriteBuffers>(executor, registry, pid, *request, task);
+        break;
+    case message::FinishRequest::TYPE:
+        executeOnQueue<message::FinishRequest>(executor, registry, pid, *request, task);
+        break;
+    case message::FlushRequest::TYPE:
+        executeOnQueue<message::FlushRequest>(executor, registry, pid, *request, task);
+        break;
+    case message::SubscribeEvent::TYPE:
+        /* the event is created by a preceding request of its command queue */
+        executeOnQueue<message::SubscribeEvent>(executor, registry, pid, *request, task);
+        break;
+
+    /* Objects are released after all preceding requests of the host, which
+     * may still use them */
+    case message::DeleteCommandQueue::TYPE:
+    case message::DeleteContext::TYPE:
+    case message::DeleteEvent::TYPE:
+    case message::DeleteKernel::TYPE:
+    case message::DeleteMemory::TYPE:
+    case message::DeleteProgram::TYPE:
+        executor.executeBarrier(
+                std::vector<comm::RequestExecutor::strand_id>(1, comm::RequestExecutor::strand_id(pid, 0)),
+                task);
+        break;
+
+    default:
+        /* requests for contexts and other objects are executed on the host's
+         * strand in order of receipt */
+        executor.execute(comm::RequestExecutor::strand_id(pid, 0), task);
+    }
+}
+
 } /* namespace dclasio */
@@ -55,6 +55,7 @@
 #include <dcl/Daemon.h>
 #include <dcl/DCLTypes.h>
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -68,10 +69,18 @@ namespace dclasio {
 class ComputeNodeImpl;
 class HostImpl;
 
+namespace message {
+
+class Message;
+class Request;
+
+} /* namespace message */
+
 namespace comm {
 
 class CLRequestProcessor;
 class message_queue;
+class RequestExecutor;
 
 } /* namespace comm */
 
@@ -81,8 +90,17 @@ class ComputeNodeCommunicationManagerImpl:
         public CommunicationManagerImpl,              // extend CommunicationManagerImpl
         public dcl::ComputeNodeCommunicationManager { // implement ComputeNodeCommunicationManager
 public:
+    /*!
+     * \brief Creates a communication manager.
+     *
+     * \param[in]  host        host name or IP address of this compute node
+     * \param[in]  port        port of this compute node
+     * \param[in]  numThreads  the number of threads used to execute requests;
+     *             if 0, one thread per hardware thread is used
+     */
     ComputeNodeCommunicationManagerImpl(
-            const std::string& host, port_type port);
+            const std::string& host, port_type port,
+            unsigned int numThreads = 0);
     virtual ~ComputeNodeCommunicationManagerImpl();
 
     /*!
@@ -116,6 +134,22 @@ public:
     HostImpl * get_host(
             dcl::process_id pid) const;
 
+    /*!
+     * \brief Returns a compute node this compute node has connected to.
+     *
+     * A connection to the compute node is established on first use. Such
+     * connections are used to receive data from other compute nodes directly,
+     * i.e., without passing it through the host. Data is sent to this compute
+     * node by the other compute node over the same connection, which is an
+     * incoming connection on that side (see get_compute_node).
+     *
+     * \param[in]  url the compute node's URL
+     * \return a connected compute node
+     * \throw dcl::ConnectionException if the compute node could not be connected
+     */
+    ComputeNodeImpl * connect_compute_node(
+            const std::string& url);
+
     /*
      * Connection listener API
      */
@@ -136,7 +170,7 @@ public:
      */
     void message_received(
             comm::message_queue& msgq,
-            const message::Message& message);
+            const std::shared_ptr<message::Message>& message);
 
 private:
     void host_connected(
@@ -145,6 +179,35 @@ private:
     void compute_node_connected(
             comm::message_queue& msgq,
             dcl::process_id process_id);
+    /*!
+     * \brief Notifies connection listeners about a disconnected process and
+     *        removes the process.
+     *
+     * For hosts, this method is called when all running requests of the host
+     * have finished.
+     *
+     * \param[in]  pid ID of the disconnected process
+     */
+    void process_disconnected(
+            dcl::process_id pid);
+
+    /*!
+     * \brief Submits a request to the request executor.
+     *
+     * Requests of a command queue (enqueue, flush, finish, and event
+     * subscription requests) are executed in order of receipt on a strand for
+     * that command queue, after the pending requests of the host's strand.
+     * Context and object lifetime requests are executed in order of receipt
+     * on the host's strand. Requests which release objects or wait for events
+     * that have not been created yet are executed after all preceding
+     * requests of the host.
+     *
+     * \param[in]  request the request
+     * \param[in]  pid     ID of the process which sent the request
+     */
+    void execute_request(
+            const std::shared_ptr<message::Request>& request,
+            dcl::process_id pid);
 
     SmartCLObjectRegistry _objectRegistry; //!< Registry for application objects
 
@@ -155,6 +218,25 @@ private:
     std::mutex _connectionListenersMutex;
 
     std::unordered_map<dcl::process_id, std::unique_ptr<HostImpl>> _hosts;
+
+    /*!
+     * \brief Compute nodes this compute node has connected to
+     *
+     * These compute nodes are not added to the list of (incoming) compute
+     * nodes, as the remote compute node may also connect to this compute
+     * node using the same process ID.
+     */
+    std::unordered_map<std::string, std::unique_ptr<ComputeNodeImpl>> _connectedComputeNodes;
+    /* Connecting to a compute node may take a while and must not block
+     * incoming connections or connections to other compute nodes. Hence, a
+     * separate mutex is used, which is not held while connecting. */
+    std::mutex _connectedComputeNodesMutex;
+    std::set<std::string> _connectingComputeNodes; //!< URLs of compute nodes which are being connected
+    std::condition_variable _computeNodeConnected;
+
+    /* The request executor must be destroyed first, as it may still execute
+     * requests that refer to hosts */
+    std::unique_ptr<comm::RequestExecutor> _requestExecutor; //!< Worker threads for request execution
 };
 
 } /* namespace dclasio */
@@ -61,6 +61,7 @@
 #include <dclasio/message/InfoResponse.h>
 #include <dclasio/message/Request.h>
 #include <dclasio/message/Response.h>
+#include <dclasio/message/SynchronizeClock.h>
 
 #include <dcl/Binary.h>
 #include <dcl/CLError.h>
@@ -69,6 +70,7 @@
 #include <dcl/DCLTypes.h>
 #include <dcl/Device.h>
 
+#include <dcl/util/Clock.h>
 #include <dcl/util/Logger.h>
 
 #ifdef __APPLE__
@@ -85,10 +87,12 @@
 #include <cassert>
 #include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <utility>
 #include <vector>
 
 namespace dclasio {
@@ -267,6 +271,41 @@ void ComputeNodeImpl::getInfo(
             << '\'' << std::endl;
 }
 
+dcl::util::ClockOffset ComputeNodeImpl::clockOffset() const {
+    std::lock_guard<std::mutex> lock(_clockOffsetMutex);
+    return _clockOffset;
+}
+
+void ComputeNodeImpl::synchronizeClock(unsigned int samples) {
+    dcl::util::ClockOffset clockOffset = this->clockOffset();
+
+    /* Requests are sent one after another, such that they do not delay each
+     * other */
+    for (unsigned int i = 0; i < samples; ++i) {
+        message::SynchronizeClock request;
+
+        cl_ulong sent = dcl::util::clock.getTime();
+        std::unique_ptr<message::ClockResponse> response(
+                static_cast<message::ClockResponse *>(
+                        executeCommand(request, message::ClockResponse::TYPE).release()));
+        cl_ulong received = dcl::util::clock.getTime();
+
+        clockOffset.addSample(sent, response->received, response->sent, received);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_clockOffsetMutex);
+        _clockOffset = clockOffset;
+    }
+
+    dcl::util::Logger << dcl::util::Info
+            << "Synchronized clock with compute node '" << url()
+            << "' (offset=" << clockOffset.offset(dcl::util::clock.getTime())
+            << "ns, drift=" << clockOffset.drift()
+            << ", error=" << clockOffset.error() << "ns)"
+            << std::endl;
+}
+
 void ComputeNodeImpl::sendRequest(message::Request& request) const {
     /* Do not use sendMessage which should be used for dOpenCL messages only
      * Thus, sending messages and sending requests can be properly
@@ -279,6 +318,27 @@ void ComputeNodeImpl::sendRequest(message::Request& request) const {
     _messageQueue.send_message(request);
 }
 
+void ComputeNodeImpl::sendRequest(
+        message::Request& request,
+        const std::function<void (cl_int)>& notify) {
+    /* Register callback before sending the request, as the response may
+     * arrive before sendRequest returns */
+    {
+        std::lock_guard<std::mutex> lock(_responseCallbacksMutex);
+        _responseCallbacks[request.id] = notify;
+    }
+
+    try {
+        /* The response is not awaited, such that the request can be batched
+         * with subsequent messages */
+        _messageQueue.post_message(request);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(_responseCallbacksMutex);
+        _responseCallbacks.erase(request.id);
+        throw;
+    }
+}
+
 std::unique_ptr<message::Response> ComputeNodeImpl::awaitResponse(
 		const message::Request& request, message::Response::class_type responseType) {
     std::unique_ptr<message::Response> response;
@@ -348,6 +408,28 @@ comm::ResponseBuffer& ComputeNodeImpl::responseBuffer() {
 	return _responseBuffer;
 }
 
+void ComputeNodeImpl::receiveResponse(
+        std::unique_ptr<message::Response>&& response) {
+    std::function<void (cl_int)> notify;
+
+    {
+        std::lock_guard<std::mutex> lock(_responseCallbacksMutex);
+        auto i = _responseCallbacks.find(response->get_request_id());
+        if (i != std::end(_responseCallbacks)) {
+            notify = std::move(i->second);
+            _responseCallbacks.erase(i);
+        }
+    }
+
+    if (notify) {
+        /* Callback is called without holding the lock, such that it may send
+         * another request */
+        notify(response->get_errcode());
+    } else {
+        _responseBuffer.put(std::move(response));
+    }
+}
+
 /* ****************************************************************************/
 
 void sendMessage(
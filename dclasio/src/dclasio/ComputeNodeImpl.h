@@ -62,6 +62,7 @@
 #include <dcl/DCLTypes.h>
 #include <dcl/Device.h>
 
+#include <dcl/util/Clock.h>
 #include <dcl/util/Logger.h>
 
 #ifdef __APPLE__
@@ -71,6 +72,8 @@
 #endif
 
 #include <chrono>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -178,8 +181,24 @@ public:
             cl_compute_node_info_WWU    param_name,
             dcl::Binary&                param) const;
 
+    dcl::util::ClockOffset clockOffset() const;
+
+    /*!
+     * \brief Synchronizes the local clock with the compute node's clock.
+     *
+     * A number of clock requests are sent to the compute node one after
+     * another, in order to update the estimated offset of its clock.
+     *
+     * \param[in]  samples  the number of clock requests
+     */
+    void synchronizeClock(
+            unsigned int samples);
+
     void sendRequest(
             message::Request& request) const;
+    void sendRequest(
+            message::Request&                   request,
+            const std::function<void (cl_int)>& notify);
 
     std::unique_ptr<message::Response> awaitResponse(
             const message::Request&         request,
@@ -195,6 +214,18 @@ public:
 
     comm::ResponseBuffer& responseBuffer();
 
+    /*!
+     * \brief Processes a response received from this compute node.
+     *
+     * If a callback has been registered for the response's request, the
+     * callback is called. Otherwise, the response is stored in this compute
+     * node's response buffer.
+     *
+     * \param[in]  response the received response
+     */
+    void receiveResponse(
+            std::unique_ptr<message::Response>&& response);
+
 private:
     /*!
      * \brief Connects to the compute node's message queue.
@@ -266,6 +297,14 @@ private:
 
 
     comm::ResponseBuffer _responseBuffer; //!< Response buffer
+    /*!
+     * \brief Callbacks for requests whose responses are not awaited
+     *
+     * Responses to these requests are passed to the associated callback rather
+     * than to the response buffer.
+     */
+    std::map<message::Request::id_type, std::function<void (cl_int)>> _responseCallbacks;
+    std::mutex _responseCallbacksMutex; //!< Mutex for response callbacks
 
     std::unique_ptr<std::vector<std::unique_ptr<DeviceImpl>>> _devices; //!< Device list
     /*!
@@ -275,6 +314,9 @@ private:
      * lock it again when the device IDs have to be queried in updateDevices.
      */
     std::recursive_mutex _devicesMutex;
+
+    dcl::util::ClockOffset _clockOffset; //!< Offset of the compute node's clock
+    mutable std::mutex _clockOffsetMutex; //!< Mutex for clock offset
 };
 
 /* ****************************************************************************/
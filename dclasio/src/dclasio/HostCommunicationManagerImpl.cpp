@@ -49,6 +49,7 @@
 #include "comm/CLEventProcessor.h"
 #include "comm/CLResponseProcessor.h"
 
+#include <dclasio/message/GetTrace.h>
 #include <dclasio/message/Message.h>
 
 #include <dcl/CLObjectRegistry.h>
@@ -57,30 +58,68 @@
 #include <dcl/DCLException.h>
 #include <dcl/DCLTypes.h>
 
+#include <dcl/util/Clock.h>
+#include <dcl/util/Environment.h>
 #include <dcl/util/Logger.h>
+#include <dcl/util/Trace.h>
 
 #include <cassert>
+#include <chrono>
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+namespace {
+
+/*!
+ * \brief Number of clock requests sent to a compute node per synchronization
+ */
+const unsigned int CLOCK_SYNC_SAMPLES = 8;
+
+/*!
+ * \brief Returns the clock synchronization interval
+ *
+ * The interval is set in seconds by DCL_CLOCK_SYNC_INTERVAL; 0 disables
+ * periodic synchronization.
+ */
+std::chrono::seconds clockSyncInterval() {
+    return std::chrono::seconds(dcl::util::getEnvSize("DCL_CLOCK_SYNC_INTERVAL", 60));
+}
+
+} /* unnamed namespace */
+
+/* ****************************************************************************/
+
 namespace dclasio {
 
 /* ****************************************************************************
  * Host communication manager implementation
  ******************************************************************************/
 
-HostCommunicationManagerImpl::HostCommunicationManagerImpl() {
+HostCommunicationManagerImpl::HostCommunicationManagerImpl() :
+    _clockSyncInterval(clockSyncInterval()), _clockSyncStopped(false) {
     _clEventProcessor.reset(new comm::CLComputeNodeEventProcessor(
             *this, _objectRegistry));
     _clResponseProcessor.reset(new comm::CLResponseProcessor(*this));
+
+    if (_clockSyncInterval.count() > 0) {
+        _clockSyncThread = std::thread(&HostCommunicationManagerImpl::runClockSynchronization, this);
+    }
 }
 
 HostCommunicationManagerImpl::~HostCommunicationManagerImpl() {
+    {
+        std::lock_guard<std::mutex> lock(_clockSyncMutex);
+        _clockSyncStopped = true;
+        _clockSyncStop.notify_all();
+    }
+    if (_clockSyncThread.joinable()) _clockSyncThread.join();
 }
 
 dcl::CLObjectRegistry& HostCommunicationManagerImpl::objectRegistry() {
@@ -133,29 +172,124 @@ void HostCommunicationManagerImpl::createComputeNodes(
     ComputeNodeImpl::updateDevices(createdComputeNodes);
     /* TODO Handle connection error
      * Devices of compute nodes whose connections failed should become unavailable. */
+
+    /* Synchronize clocks initially, such that time stamps of the compute nodes
+     * can be converted to the local clock */
+    std::vector<ComputeNodeImpl *> connectedComputeNodes;
+    for (auto computeNode : computeNodes) {
+        if (computeNode) {
+            connectedComputeNodes.push_back(static_cast<ComputeNodeImpl *>(computeNode));
+        }
+    }
+    std::lock_guard<std::mutex> clockSyncLock(_clockSyncMutex);
+    synchronizeClocks(connectedComputeNodes);
 }
 
 void HostCommunicationManagerImpl::destroyComputeNode(
         dcl::ComputeNode *computeNode) {
+    /* Do not destroy a compute node while its clock is synchronized */
+    std::lock_guard<std::mutex> lock(_clockSyncMutex);
     destroyComputeNode(dynamic_cast<ComputeNodeImpl *>(computeNode));
 }
 
+void HostCommunicationManagerImpl::writeTrace(
+        std::ostream& out) {
+    std::vector<dcl::util::TraceRecord> records;
+    dcl::util::TraceWriter writer(out);
+
+    dcl::util::tracer.collect(records);
+    writer.write(0, "host", records);
+
+    /* Compute nodes are not destroyed while the lock is held */
+    std::lock_guard<std::mutex> clockSyncLock(_clockSyncMutex);
+    std::vector<ComputeNodeImpl *> computeNodes;
+    {
+        std::lock_guard<std::recursive_mutex> connectionsLock(_connectionsMutex);
+        for (const auto& computeNode : _computeNodes) {
+            if (computeNode.second->isConnected()) {
+                computeNodes.push_back(computeNode.second.get());
+            }
+        }
+    }
+
+    cl_uint pid = 0;
+    for (auto computeNode : computeNodes) {
+        ++pid;
+        try {
+            message::GetTrace request;
+            std::unique_ptr<message::TraceResponse> response(
+                    static_cast<message::TraceResponse *>(
+                            computeNode->executeCommand(
+                                    request, message::TraceResponse::TYPE).release()));
+            response->records(records);
+
+            /* Convert compute node time to host time */
+            dcl::util::ClockOffset clockOffset(computeNode->clockOffset());
+            if (clockOffset.isValid()) {
+                for (auto& record : records) {
+                    record.start = clockOffset.toLocalTime(record.start);
+                    record.end = clockOffset.toLocalTime(record.end);
+                }
+            }
+
+            writer.write(pid, computeNode->url(), records);
+        } catch (const dcl::DCLException& err) {
+            dcl::util::Logger << dcl::util::Warning
+                    << "Obtaining trace from compute node '" << computeNode->url()
+                    << "' failed: " << err.what() << std::endl;
+        }
+    }
+}
+
+void HostCommunicationManagerImpl::synchronizeClocks(
+        const std::vector<ComputeNodeImpl *>& computeNodes) {
+    for (auto computeNode : computeNodes) {
+        try {
+            computeNode->synchronizeClock(CLOCK_SYNC_SAMPLES);
+        } catch (const dcl::DCLException& err) {
+            dcl::util::Logger << dcl::util::Warning
+                    << "Clock synchronization with compute node '" << computeNode->url()
+                    << "' failed: " << err.what() << std::endl;
+        }
+    }
+}
+
+void HostCommunicationManagerImpl::runClockSynchronization() {
+    std::unique_lock<std::mutex> lock(_clockSyncMutex);
+
+    while (!_clockSyncStop.wait_for(lock, _clockSyncInterval,
+            [this] { return _clockSyncStopped; })) {
+        std::vector<ComputeNodeImpl *> computeNodes;
+        {
+            std::lock_guard<std::recursive_mutex> connectionsLock(_connectionsMutex);
+            for (const auto& computeNode : _computeNodes) {
+                if (computeNode.second->isConnected()) {
+                    computeNodes.push_back(computeNode.second.get());
+                }
+            }
+        }
+
+        /* Compute nodes are not destroyed while the lock is held */
+        synchronizeClocks(computeNodes);
+    }
+}
+
 /*
  * Message listener API
  */
 
 void HostCommunicationManagerImpl::message_received(
         comm::message_queue& msgq,
-        const message::Message& message) {
+        const std::shared_ptr<message::Message>& message) {
     // TODO Determine sender's process ID
     dcl::process_id pid = msgq.get_process_id();
 
     assert(_clEventProcessor && "No event processor");
-    if (_clEventProcessor->dispatch(message, pid))
+    if (_clEventProcessor->dispatch(*message, pid))
         return;
 
     assert(_clResponseProcessor && "No response processor");
-    auto response = dynamic_cast<const message::Response *>(&message);
+    auto response = dynamic_cast<const message::Response *>(message.get());
     if (response && _clResponseProcessor->dispatch(*response, pid))
         return;
 
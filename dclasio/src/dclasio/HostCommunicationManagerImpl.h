@@ -50,8 +50,13 @@
 #include <dcl/CommunicationManager.h>
 #include <dcl/ComputeNode.h>
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <ostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace dclasio {
@@ -96,17 +101,49 @@ public:
             std::vector<dcl::ComputeNode *>&    computeNodes);
     void destroyComputeNode(
             dcl::ComputeNode *computeNode);
+    void writeTrace(
+            std::ostream& out);
 
     /*
      * Message listener API
      */
     void message_received(
             comm::message_queue& msgq,
-            const message::Message& message);
+            const std::shared_ptr<message::Message>& message);
 
 private:
+    /*!
+     * \brief Synchronizes the local clock with the clocks of compute nodes
+     *
+     * \param[in]  computeNodes the compute nodes to synchronize with
+     */
+    void synchronizeClocks(
+            const std::vector<ComputeNodeImpl *>& computeNodes);
+
+    /*!
+     * \brief Periodically synchronizes the local clock with all compute nodes
+     *
+     * This method is executed by the clock synchronization thread.
+     */
+    void runClockSynchronization();
+
     dcl::CLObjectRegistry _objectRegistry; //!< Registry for application objects
 
+    /*!
+     * \brief Interval of clock synchronization, or 0 if clocks are only synchronized when connecting
+     */
+    std::chrono::seconds _clockSyncInterval;
+    bool _clockSyncStopped; //!< \c true, if the clock synchronization thread should terminate
+    /*!
+     * \brief Mutex for clock synchronization
+     *
+     * This mutex is locked while clocks are synchronized, such that compute
+     * nodes are not destroyed meanwhile.
+     */
+    std::mutex _clockSyncMutex;
+    std::condition_variable _clockSyncStop; //!< Condition: clock synchronization stopped
+    std::thread _clockSyncThread; //!< Clock synchronization thread
+
     std::unique_ptr<comm::CLResponseProcessor> _clResponseProcessor; //!< Processor for command responses
 };
 
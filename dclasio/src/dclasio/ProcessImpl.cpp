@@ -84,6 +84,7 @@ ProcessImpl::ProcessImpl(
         _dataDispatcher(dataDispatcher), _dataStream(nullptr),
         _connectionStatus(ConnectionStatus::MESSAGE_QUEUE_CONNECTED) {
     assert(_pid != 0 && "Invalid process ID");
+    setUrl(_messageQueue.get_remote_endpoint());
 }
 
 ProcessImpl::ProcessImpl(
@@ -97,6 +98,7 @@ ProcessImpl::ProcessImpl(
         _connectionStatus(ConnectionStatus::DISCONNECTED) {
     endpoint_type data_endpoint(endpoint.address(), endpoint.port() + 100);
     _dataStream = _dataDispatcher.create_data_stream(data_endpoint);
+    setUrl(endpoint);
 }
 
 ProcessImpl::~ProcessImpl() {
@@ -131,22 +133,19 @@ bool ProcessImpl::isConnected() {
 }
 
 const std::string& ProcessImpl::url() const {
-    if (_url.empty()) {
-        std::stringstream ss;
-
-        // TODO Generate process URL from message queue's remote endpoint
-        /*
-        // create URL string once
-        if (!(ss << _messageQueue.getHostname() << ':' << _messageQueue.getPort()) ||
-                !(ss >> _url) ||
-                !((ss >> std::ws).eof())) // skip whitespace and check if EOF flag has been set
-            _url.clear();
-         */
-    }
-
     return _url;
 }
 
+void ProcessImpl::setUrl(const endpoint_type& endpoint) {
+    /* The URL is generated from the message queue's remote endpoint. For
+     * outgoing connections, this is the endpoint the remote process accepts
+     * connections on, such that other processes can connect to it using
+     * this URL. */
+    std::stringstream ss;
+    ss << endpoint.address().to_string() << ':' << endpoint.port();
+    _url = ss.str();
+}
+
 void ProcessImpl::sendMessage(const message::Message& message) const {
     /* TODO Check message queue before sending message
     if (!_messageQueue.isConnected()) {
@@ -157,13 +156,13 @@ void ProcessImpl::sendMessage(const message::Message& message) const {
 }
 
 std::shared_ptr<dcl::DataTransfer> ProcessImpl::sendData(size_t size,
-        const void *ptr) {
-    return getDataStream().write(size, ptr);
+        const void *ptr, dcl::DataTransfer::Priority priority) {
+    return getDataStream().write(size, ptr, priority);
 }
 
 std::shared_ptr<dcl::DataTransfer> ProcessImpl::receiveData(size_t size,
-        void *ptr) {
-    return getDataStream().read(size, ptr);
+        void *ptr, dcl::DataTransfer::Priority priority) {
+    return getDataStream().read(size, ptr, priority);
 }
 
 comm::DataStream& ProcessImpl::getDataStream() {
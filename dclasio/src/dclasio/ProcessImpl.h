@@ -153,10 +153,12 @@ public:
 
     std::shared_ptr<dcl::DataTransfer> sendData(
             size_t      size,
-            const void *ptr);
+            const void *ptr,
+            dcl::DataTransfer::Priority priority = dcl::DataTransfer::Priority::NORMAL);
     std::shared_ptr<dcl::DataTransfer> receiveData(
             size_t  size,
-            void *  ptr);
+            void *  ptr,
+            dcl::DataTransfer::Priority priority = dcl::DataTransfer::Priority::NORMAL);
 
     /*!
      * \brief (Un)sets the processes data stream
@@ -238,7 +240,10 @@ private:
     ProcessImpl& operator=(
             const ProcessImpl&) = delete;
 
-    mutable std::string _url; //!< Process URL
+    void setUrl(
+            const endpoint_type& endpoint);
+
+    std::string _url; //!< Process URL
 };
 
 } /* namespace dclasio */
@@ -62,6 +62,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -95,22 +96,26 @@ public:
     void bind(
             dcl::object_id id,
             T& objectPtr) {
+        std::lock_guard<std::mutex> lock(_mutex);
         _objects.insert(std::make_pair(id, RegistryValue<T>::put(objectPtr)));
     }
 
     void unbind(
             dcl::object_id id) {
+        std::lock_guard<std::mutex> lock(_mutex);
         _objects.erase(id);
     }
 
     T lookup(
             dcl::object_id id) const {
+        std::lock_guard<std::mutex> lock(_mutex);
         auto i = _objects.find(id);
         return (i == std::end(_objects)) ? T() : RegistryValue<T>::get(i->second);
     }
 
     void getIDs(
             std::vector<dcl::object_id>& ids) const {
+        std::lock_guard<std::mutex> lock(_mutex);
         ids.clear();
         for (auto entry : _objects) {
             ids.push_back(entry.first);
@@ -119,6 +124,8 @@ public:
 
 private:
     std::map<dcl::object_id, typename RegistryValue<T>::Type> _objects;
+    /* Requests of different hosts and events are processed concurrently */
+    mutable std::mutex _mutex;
 };
 
 } /* namespace detail */
@@ -134,6 +134,15 @@ void CLComputeNodeEventProcessor::executionStatusChanged(
         const message::CommandExecutionStatusChangedMessage& notification) {
     auto commandListener = _objectRegistry.lookup<dcl::CommandListener>(notification.commandId());
     if (commandListener) {
+        const auto& profilingInfo = notification.profilingInfo();
+        if (profilingInfo.size() == 5) {
+            /* Profiling info is passed before the execution status, such
+             * that it is available when the command is complete */
+            _taskList.push(
+                    std::bind(&dcl::CommandListener::onProfilingInfo,
+                            commandListener, profilingInfo[0], profilingInfo[1],
+                            profilingInfo[2], profilingInfo[3], profilingInfo[4]));
+        }
         // pass function call to worker thread
         _taskList.push(
                 std::bind(&dcl::CommandListener::onExecutionStatusChanged,
@@ -255,7 +264,21 @@ void CLHostEventProcessor::synchronizeEvent(
         HostImpl& host) const {
     auto event = getObjectRegistry(host).lookup<std::shared_ptr<dcl::Event>>(notification.commandId());
     if (event) {
-        event->onSynchronize(host);
+        if (notification.destinationId()) {
+            /* Release changes directly to the requesting compute node.
+             * The compute node has connected to this compute node before
+             * sending its request to the host. */
+            auto computeNode = _communicationManager.get_compute_node(notification.destinationId());
+            if (computeNode) {
+                event->onSynchronize(*computeNode);
+            } else {
+                dcl::util::Logger << dcl::util::Error
+                        << "Compute node not found (pid=" << notification.destinationId()
+                        << ')' << std::endl;
+            }
+        } else {
+            event->onSynchronize(host);
+        }
     } else {
         dcl::util::Logger << dcl::util::Error
                 << "Event not found (command ID=" << notification.commandId()
@@ -266,6 +289,27 @@ void CLHostEventProcessor::synchronizeEvent(
 bool CLHostEventProcessor::dispatch(
         const message::Message& message,
         dcl::process_id pid) {
+    if (message.get_type() == message::CommandExecutionStatusChangedMessage::TYPE) {
+        auto& notification = static_cast<const message::CommandExecutionStatusChangedMessage&>(message);
+
+        if (notification.hostId()) {
+            /* The compute node of the event sends the execution status on
+             * behalf of the event's host, as IDs are only unique per host */
+            dcl::util::Logger << dcl::util::Debug
+                    << "Received command execution status changed message from compute node" << std::endl;
+
+            HostImpl *host = _communicationManager.get_host(notification.hostId());
+            if (host) {
+                executionStatusChanged(notification, *host);
+            } else {
+                dcl::util::Logger << dcl::util::Error
+                        << "Host not found (pid=" << notification.hostId()
+                        << ')' << std::endl;
+            }
+            return true;
+        }
+    }
+
     HostImpl *host = _communicationManager.get_host(pid);
     assert(host && "No host for event");
     if (!host)
@@ -84,29 +84,38 @@
 #include <dclasio/message/EnqueueWaitForEvents.h>
 #endif // #if defined(CL_USE_DEPRECATED_OPENCL_1_1_APIS)
 #include <dclasio/message/EnqueueWriteBuffer.h>
+#include <dclasio/message/EnqueueWriteBuffers.h>
 #include <dclasio/message/ErrorResponse.h>
 #include <dclasio/message/EventProfilingInfosResponse.h>
 #include <dclasio/message/FinishRequest.h>
 #include <dclasio/message/FlushRequest.h>
 #include <dclasio/message/GetEventProfilingInfos.h>
 #include <dclasio/message/GetKernelInfo.h>
+#include <dclasio/message/GetTrace.h>
 #include <dclasio/message/InfoResponse.h>
 #include <dclasio/message/Request.h>
 #include <dclasio/message/Response.h>
 #include <dclasio/message/SetKernelArg.h>
+#include <dclasio/message/SubscribeEvent.h>
+#include <dclasio/message/SynchronizeClock.h>
 
 #include <dcl/CommandQueue.h>
+#include <dcl/ComputeNode.h>
 #include <dcl/Context.h>
 #include <dcl/ContextListener.h>
+#include <dcl/DCLException.h>
 #include <dcl/DCLTypes.h>
 #include <dcl/Device.h>
 #include <dcl/Event.h>
 #include <dcl/Kernel.h>
 #include <dcl/Memory.h>
+#include <dcl/Process.h>
 #include <dcl/Program.h>
 #include <dcl/Session.h>
 
+#include <dcl/util/Clock.h>
 #include <dcl/util/Logger.h>
+#include <dcl/util/Trace.h>
 
 #define __CL_ENABLE_EXCEPTIONS
 #include <CL/cl.hpp>
@@ -118,6 +127,7 @@
 #include <iterator>
 #include <memory>
 #include <ostream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -652,6 +662,7 @@ std::unique_ptr<message::Response> CLRequestProcessor::execute(
         HostImpl& host) {
     SmartCLObjectRegistry& registry = getObjectRegistry(host);
     std::vector<std::shared_ptr<dcl::Memory>> memoryObjects;
+    dcl::ComputeNode *computeNode = nullptr;
 
     try {
         /* Resolve memory object IDs */
@@ -660,10 +671,27 @@ std::unique_ptr<message::Response> CLRequestProcessor::execute(
             memoryObjects.push_back(registry.lookupMemory(memObjectId));
         }
 
+        if (!request.computeNodeUrl().empty()) {
+            /* Changes associated with the event are acquired directly from
+             * the event's compute node, which also sends the event's execution
+             * status directly if the host subscribes this compute node */
+            try {
+                computeNode = _communicationManager.connect_compute_node(
+                        request.computeNodeUrl());
+            } catch (const dcl::ConnectionException& err) {
+                /* The event is synchronized through the host instead. The
+                 * host keeps forwarding the event's execution status, as the
+                 * subscription of this compute node fails. */
+                dcl::util::Logger << dcl::util::Warning
+                        << "Could not connect to compute node '" << request.computeNodeUrl()
+                        << "', using host instead: " << err.what() << std::endl;
+            }
+        }
+
         std::shared_ptr<dcl::Event> event = getSession(host).createEvent(
                 request.eventId(),
                 registry.lookup<std::shared_ptr<dcl::Context>>(request.contextId()),
-                memoryObjects);
+                memoryObjects, request.offset(), request.cb(), computeNode);
         registry.bind(request.eventId(), event);
 
         dcl::util::Logger << dcl::util::Info
@@ -699,30 +727,119 @@ std::unique_ptr<message::Response> CLRequestProcessor::execute(
 
 template<>
 std::unique_ptr<message::Response> CLRequestProcessor::execute(
-        const message::GetEventProfilingInfos& request,
+        const message::SubscribeEvent& request,
         HostImpl& host) {
     SmartCLObjectRegistry& registry = getObjectRegistry(host);
 
-    try {
-        cl_ulong received, queued, submit, start, end;
+    /* The event has been created by its command before, as this request is
+     * executed in order with the requests of the command's queue */
+    auto event = registry.lookup<std::shared_ptr<dcl::Event>>(request.eventId());
+    if (!event) {
+        dcl::util::Logger << dcl::util::Error
+                << "Event not found (ID=" << request.eventId() << ')'
+                << std::endl;
+        return make_unique<message::ErrorResponse>(request, CL_INVALID_EVENT);
+    }
 
-        auto event = registry.lookup<std::shared_ptr<dcl::Event>>(request.eventId());
+    /* The subscriber has connected to this compute node before the host
+     * sent the subscription */
+    auto computeNode = _communicationManager.get_compute_node(request.subscriberId());
+    if (!computeNode) {
+        dcl::util::Logger << dcl::util::Error
+                << "Compute node not found (pid=" << request.subscriberId()
+                << ')' << std::endl;
+        return make_unique<message::ErrorResponse>(request, CL_IO_ERROR_WWU);
+    }
 
-        event->getProfilingInfo(CL_PROFILING_COMMAND_RECEIVED_WWU, received);
-        event->getProfilingInfo(CL_PROFILING_COMMAND_QUEUED, queued);
-        event->getProfilingInfo(CL_PROFILING_COMMAND_SUBMIT, submit);
-        event->getProfilingInfo(CL_PROFILING_COMMAND_START, start);
-        event->getProfilingInfo(CL_PROFILING_COMMAND_END, end);
+    event->onSubscribe(*computeNode);
 
-        dcl::util::Logger << dcl::util::Info
-                << "Got event profiling info (ID=" << request.eventId() << ')'
-                << std::endl;
+    dcl::util::Logger << dcl::util::Info
+            << "Subscribed compute node '" << computeNode->url()
+            << "' to event (ID=" << request.eventId() << ')'
+            << std::endl;
 
-        return make_unique<message::EventProfilingInfosReponse>(
-                request, received, queued, submit, start, end);
-    } catch (const cl::Error& err) {
-        return make_unique<message::ErrorResponse>(request, err.err());
+    return make_unique<message::DefaultResponse>(request);
+}
+
+template<>
+std::unique_ptr<message::Response> CLRequestProcessor::execute(
+        const message::GetEventProfilingInfos& request,
+        HostImpl& host) {
+    SmartCLObjectRegistry& registry = getObjectRegistry(host);
+    auto response = make_unique<message::EventProfilingInfosReponse>(request);
+    const auto& eventIds = request.eventIds();
+
+    response->errcodes.reserve(eventIds.size());
+    response->received.reserve(eventIds.size());
+    response->queued.reserve(eventIds.size());
+    response->submit.reserve(eventIds.size());
+    response->start.reserve(eventIds.size());
+    response->end.reserve(eventIds.size());
+
+    /* Profiling info is obtained for each event separately, such that a
+     * single event without profiling info does not fail the entire request */
+    for (auto eventId : eventIds) {
+        cl_int errcode = CL_SUCCESS;
+        cl_ulong received = 0, queued = 0, submit = 0, start = 0, end = 0;
+
+        auto event = registry.lookup<std::shared_ptr<dcl::Event>>(eventId);
+        if (event) {
+            try {
+                event->getProfilingInfo(CL_PROFILING_COMMAND_RECEIVED_WWU, received);
+                event->getProfilingInfo(CL_PROFILING_COMMAND_QUEUED, queued);
+                event->getProfilingInfo(CL_PROFILING_COMMAND_SUBMIT, submit);
+                event->getProfilingInfo(CL_PROFILING_COMMAND_START, start);
+                event->getProfilingInfo(CL_PROFILING_COMMAND_END, end);
+            } catch (const cl::Error& err) {
+                errcode = err.err();
+            }
+        } else {
+            errcode = CL_INVALID_EVENT;
+        }
+
+        response->errcodes.push_back(errcode);
+        response->received.push_back(received);
+        response->queued.push_back(queued);
+        response->submit.push_back(submit);
+        response->start.push_back(start);
+        response->end.push_back(end);
+    }
+
+    dcl::util::Logger << dcl::util::Info
+            << "Got event profiling info (events=" << eventIds.size() << ')'
+            << std::endl;
+
+    /* A request for a single event fails, if its profiling info is not
+     * available */
+    if (eventIds.size() == 1 && response->errcodes.front() != CL_SUCCESS) {
+        return make_unique<message::ErrorResponse>(request, response->errcodes.front());
     }
+
+    return std::move(response);
+}
+
+template<>
+std::unique_ptr<message::Response> CLRequestProcessor::execute(
+        const message::GetTrace& request,
+        HostImpl& host) {
+    std::vector<dcl::util::TraceRecord> records;
+    dcl::util::tracer.collect(records);
+
+    dcl::util::Logger << dcl::util::Info
+            << "Got trace (spans=" << records.size() << ')'
+            << std::endl;
+
+    return make_unique<message::TraceResponse>(request, records);
+}
+
+template<>
+std::unique_ptr<message::Response> CLRequestProcessor::execute(
+        const message::SynchronizeClock& request,
+        HostImpl& host) {
+    cl_ulong received = dcl::util::clock.getTime();
+    /* No logging here, as it would delay the response */
+    return make_unique<message::ClockResponse>(
+            request, received, dcl::util::clock.getTime());
 }
 
 template<>
@@ -825,7 +942,7 @@ std::unique_ptr<message::Response> CLRequestProcessor::execute(
         registry.lookup<std::shared_ptr<dcl::CommandQueue>>(request.commandQueueId())->enqueueWriteBuffer(
                 registry.lookup<std::shared_ptr<dcl::Buffer>>(request.bufferId()),
                 request.blocking(), request.offset(),
-                request.cb(),
+                request.cb(), request.chunkSize(),
                 (eventWaitList.empty() ? nullptr : &eventWaitList),
                 request.commandId(),
                 (request.event() ? &writeBuffer : nullptr)
@@ -849,6 +966,79 @@ std::unique_ptr<message::Response> CLRequestProcessor::execute(
     }
 }
 
+template<>
+std::unique_ptr<message::Response> CLRequestProcessor::execute(
+        const message::EnqueueWriteBuffers& request,
+        HostImpl& host) {
+    SmartCLObjectRegistry& registry = getObjectRegistry(host);
+    std::vector<std::shared_ptr<dcl::CommandQueue>> commandQueues;
+    std::vector<std::shared_ptr<dcl::Buffer>> buffers;
+    dcl::Process *predecessor = nullptr;
+    dcl::Process *successor = nullptr;
+    std::vector<std::shared_ptr<dcl::Event>> eventWaitList;
+    std::shared_ptr<dcl::Event> writeBuffers;
+
+    try {
+        if (request.commandQueueIds().empty()) throw cl::Error(CL_INVALID_VALUE);
+
+        for (auto commandQueueId : request.commandQueueIds()) {
+            commandQueues.push_back(registry.lookup<std::shared_ptr<dcl::CommandQueue>>(commandQueueId));
+        }
+        for (auto bufferId : request.bufferIds()) {
+            buffers.push_back(registry.lookup<std::shared_ptr<dcl::Buffer>>(bufferId));
+        }
+
+        if (!request.predecessorUrl().empty()) {
+            /* The data is received over a connection to the predecessor,
+             * which is initiated by this compute node (see connect_compute_node) */
+            predecessor = _communicationManager.connect_compute_node(request.predecessorUrl());
+        }
+
+        if (request.successorId()) {
+            /* The successor has connected to this compute node before the
+             * host sent this request */
+            successor = _communicationManager.get_compute_node(request.successorId());
+            if (!successor) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Compute node not found (pid=" << request.successorId() << ')'
+                        << std::endl;
+                return make_unique<message::ErrorResponse>(request, CL_IO_ERROR_WWU);
+            }
+        }
+
+        getEventWaitList(registry, request.eventIdWaitList(), eventWaitList);
+
+        commandQueues.front()->enqueueWriteBuffers(
+                commandQueues, buffers, request.offsets(), request.cb(),
+                request.chunkSize(), predecessor, successor,
+                (eventWaitList.empty() ? nullptr : &eventWaitList),
+                request.commandId(),
+                (request.event() ? &writeBuffers : nullptr)
+        );
+
+        if (writeBuffers) { // an event should be associated with this command
+            /* FIXME Add event to session automatically */
+            getSession(host).addEvent(writeBuffers);
+            registry.bind(request.commandId(), writeBuffers);
+        }
+
+        dcl::util::Logger << dcl::util::Info
+                << "Enqueued multicast upload to buffers (buffers=" << buffers.size()
+                << ", command ID=" << request.commandId()
+                << ", successor=" << (successor ? "yes" : "no")
+                << ')' << std::endl;
+
+        return make_unique<message::DefaultResponse>(request);
+    } catch (const cl::Error& err) {
+        return make_unique<message::ErrorResponse>(request, err.err());
+    } catch (const dcl::ConnectionException& err) {
+        dcl::util::Logger << dcl::util::Error
+                << "Could not connect to compute node '" << request.predecessorUrl()
+                << "': " << err.what() << std::endl;
+        return make_unique<message::ErrorResponse>(request, CL_IO_ERROR_WWU);
+    }
+}
+
 template<>
 std::unique_ptr<message::Response> CLRequestProcessor::execute(
         const message::EnqueueReadBuffer& request,
@@ -863,7 +1053,7 @@ std::unique_ptr<message::Response> CLRequestProcessor::execute(
         registry.lookup<std::shared_ptr<dcl::CommandQueue>>(request.commandQueueId())->enqueueReadBuffer(
                 registry.lookup<std::shared_ptr<dcl::Buffer>>(request.bufferId()),
                 request.blocking(), request.offset(),
-                request.cb(),
+                request.cb(), request.chunkSize(),
                 (eventWaitList.empty() ? nullptr : &eventWaitList),
                 request.commandId(),
                 (request.event() ? &readBuffer : nullptr)
@@ -891,13 +1081,78 @@ template<>
 std::unique_ptr<message::Response> CLRequestProcessor::execute(
         const message::EnqueueBroadcastBuffer& request,
         HostImpl& host) {
+    SmartCLObjectRegistry& registry = getObjectRegistry(host);
+    std::vector<std::shared_ptr<dcl::CommandQueue>> commandQueues;
+    std::vector<std::shared_ptr<dcl::Buffer>> dsts;
+    std::shared_ptr<dcl::Buffer> src;
+    dcl::Process *parent = nullptr;
+    std::vector<dcl::Process *> children;
+    std::vector<std::shared_ptr<dcl::Event>> eventWaitList;
+    std::shared_ptr<dcl::Event> broadcastBuffer;
+
     try {
-        /* TODO Implement and call dcl::CommandQueue::enqueueBroadcastBuffer */
-        assert(!"dcl::CommandQueue::enqueueBroadcastBuffer not implemented");
+        if (request.commandQueueIds().empty()) throw cl::Error(CL_INVALID_VALUE);
+
+        for (auto commandQueueId : request.commandQueueIds()) {
+            commandQueues.push_back(registry.lookup<std::shared_ptr<dcl::CommandQueue>>(commandQueueId));
+        }
+        for (auto dstBufferId : request.dstBufferIds()) {
+            dsts.push_back(registry.lookup<std::shared_ptr<dcl::Buffer>>(dstBufferId));
+        }
+
+        if (request.parentUrl().empty()) {
+            /* This compute node is the root of the broadcast */
+            src = registry.lookup<std::shared_ptr<dcl::Buffer>>(request.srcBufferId());
+        } else {
+            /* The data is received over a connection to the parent, which is
+             * initiated by this compute node (see connect_compute_node) */
+            parent = _communicationManager.connect_compute_node(request.parentUrl());
+        }
+
+        /* Children have connected to this compute node before the host sent
+         * this request */
+        for (auto childId : request.childIds()) {
+            auto child = _communicationManager.get_compute_node(childId);
+            if (!child) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Compute node not found (pid=" << childId << ')'
+                        << std::endl;
+                return make_unique<message::ErrorResponse>(request, CL_IO_ERROR_WWU);
+            }
+            children.push_back(child);
+        }
+
+        getEventWaitList(registry, request.eventIdWaitList(), eventWaitList);
+
+        commandQueues.front()->enqueueBroadcastBuffer(
+                src, commandQueues, dsts,
+                request.srcOffset(), request.dstOffsets(), request.cb(),
+                parent, children,
+                (eventWaitList.empty() ? nullptr : &eventWaitList),
+                request.commandId(),
+                (request.event() ? &broadcastBuffer : nullptr)
+        );
+
+        if (broadcastBuffer) { // an event should be associated with this command
+            /* FIXME Add event to session automatically */
+            getSession(host).addEvent(broadcastBuffer);
+            registry.bind(request.commandId(), broadcastBuffer);
+        }
+
+        dcl::util::Logger << dcl::util::Info
+                << "Enqueued broadcast buffer (src buffer ID=" << request.srcBufferId()
+                << ", command ID=" << request.commandId()
+                << ", children=" << children.size()
+                << ')' << std::endl;
 
         return make_unique<message::DefaultResponse>(request);
     } catch (const cl::Error& err) {
         return make_unique<message::ErrorResponse>(request, err.err());
+    } catch (const dcl::ConnectionException& err) {
+        dcl::util::Logger << dcl::util::Error
+                << "Could not connect to compute node '" << request.parentUrl()
+                << "': " << err.what() << std::endl;
+        return make_unique<message::ErrorResponse>(request, CL_IO_ERROR_WWU);
     }
 }
 
@@ -905,13 +1160,105 @@ template<>
 std::unique_ptr<message::Response> CLRequestProcessor::execute(
         const message::EnqueueReduceBuffer& request,
         HostImpl& host) {
+    SmartCLObjectRegistry& registry = getObjectRegistry(host);
+    std::shared_ptr<dcl::CommandQueue> commandQueue;
+    std::vector<std::shared_ptr<dcl::Buffer>> srcs;
+    dcl::Process *parent = nullptr;
+    std::vector<dcl::Process *> children;
+    std::vector<std::shared_ptr<dcl::Event>> eventWaitList;
+    std::shared_ptr<dcl::Event> reduceBuffer;
+    std::string url;
+
     try {
-        /* TODO Implement and call dcl::CommandQueue::enqueueReduceBuffer */
-        assert(!"dcl::CommandQueue::enqueueReduceBuffer not implemented");
+        auto kernel = registry.lookup<std::shared_ptr<dcl::Kernel>>(request.kernelId());
+
+        for (auto srcId : request.srcIds()) {
+            srcs.push_back(registry.lookup<std::shared_ptr<dcl::Buffer>>(srcId));
+        }
+
+        if (request.parentId()) {
+            /* The parent has connected to this compute node before the host
+             * sent this request */
+            auto computeNode = _communicationManager.get_compute_node(request.parentId());
+            if (!computeNode) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Compute node not found (pid=" << request.parentId() << ')'
+                        << std::endl;
+                return make_unique<message::ErrorResponse>(request, CL_IO_ERROR_WWU);
+            }
+            parent = computeNode;
+        }
+
+        /* Partial results are received over connections to the children,
+         * which are initiated by this compute node (see connect_compute_node) */
+        for (const auto& childUrl : request.childUrls()) {
+            url = childUrl;
+            children.push_back(_communicationManager.connect_compute_node(childUrl));
+        }
+
+        getEventWaitList(registry, request.eventIdWaitList(), eventWaitList);
+
+        /* Apply kernel arguments that have been changed since the kernel's
+         * last launch on this compute node */
+        for (const auto& arg : request.argLocalSizes()) {
+            kernel->setArg(arg.first, arg.second);
+        }
+        for (const auto& arg : request.argMemObjects()) {
+            kernel->setArg(arg.first, registry.lookupMemory(arg.second));
+        }
+        for (const auto& arg : request.argBinaries()) {
+            kernel->setArg(arg.first, arg.second.size(), arg.second.value());
+        }
+
+        if (request.commandQueueId()) {
+            commandQueue = registry.lookup<std::shared_ptr<dcl::CommandQueue>>(request.commandQueueId());
+        } else {
+            /* The application did not specify a command queue for this
+             * compute node; use a temporary one. Its native command queue
+             * is released when the enqueued commands are complete. */
+            commandQueue = getSession(host).createCommandQueue(
+                    registry.lookup<std::shared_ptr<dcl::Context>>(request.contextId()),
+                    _communicationManager.objectRegistry().lookup<dcl::Device *>(request.deviceId()),
+                    0);
+        }
+
+        commandQueue->enqueueReduceBuffer(
+                srcs,
+                registry.lookup<std::shared_ptr<dcl::Buffer>>(request.dstId()),
+                kernel, request.offset(), request.global(), request.local(),
+                parent, children,
+                (eventWaitList.empty() ? nullptr : &eventWaitList),
+                request.commandId(),
+                (request.event() ? &reduceBuffer : nullptr)
+        );
+
+        if (!request.commandQueueId()) {
+            getSession(host).releaseCommandQueue(commandQueue);
+        }
+
+        if (reduceBuffer) { // an event should be associated with this command
+            /* FIXME Add event to session automatically */
+            getSession(host).addEvent(reduceBuffer);
+            registry.bind(request.commandId(), reduceBuffer);
+        }
+
+        dcl::util::Logger << dcl::util::Info
+                << "Enqueued reduce buffer (dst buffer ID=" << request.dstId()
+                << ", command ID=" << request.commandId()
+                << ", children=" << children.size()
+                << ')' << std::endl;
 
         return make_unique<message::DefaultResponse>(request);
     } catch (const cl::Error& err) {
+        if (commandQueue && !request.commandQueueId()) {
+            getSession(host).releaseCommandQueue(commandQueue);
+        }
         return make_unique<message::ErrorResponse>(request, err.err());
+    } catch (const dcl::ConnectionException& err) {
+        dcl::util::Logger << dcl::util::Error
+                << "Could not connect to compute node '" << url
+                << "': " << err.what() << std::endl;
+        return make_unique<message::ErrorResponse>(request, CL_IO_ERROR_WWU);
     }
 }
 
@@ -924,10 +1271,25 @@ std::unique_ptr<message::Response> CLRequestProcessor::execute(
     std::shared_ptr<dcl::Event> ndRangeKernel;
 
     try {
+        auto kernel = registry.lookup<std::shared_ptr<dcl::Kernel>>(request.kernelId());
+
         getEventWaitList(registry, request.eventIdWaitList(), eventWaitList);
 
+        /* Apply kernel arguments that have been changed since the kernel's
+         * last launch. If an argument cannot be set, the kernel is not
+         * enqueued. */
+        for (const auto& arg : request.argLocalSizes()) {
+            kernel->setArg(arg.first, arg.second);
+        }
+        for (const auto& arg : request.argMemObjects()) {
+            kernel->setArg(arg.first, registry.lookupMemory(arg.second));
+        }
+        for (const auto& arg : request.argBinaries()) {
+            kernel->setArg(arg.first, arg.second.size(), arg.second.value());
+        }
+
         registry.lookup<std::shared_ptr<dcl::CommandQueue>>(request.commandQueueId())->enqueueNDRangeKernel(
-                registry.lookup<std::shared_ptr<dcl::Kernel>>(request.kernelId()),
+                kernel,
                 request.offset(), request.global(), request.local(),
                 (eventWaitList.empty() ? nullptr : &eventWaitList),
                 request.commandId(),
@@ -1223,6 +1585,9 @@ bool CLRequestProcessor::dispatch(
     if (!host)
         return false;
 
+    /* The span covers the execution of the request and sending the response */
+    dcl::util::TraceSpan span("Request", "request", request.get_type());
+
     /*
      * Dispatch request
      */
@@ -1291,6 +1656,10 @@ bool CLRequestProcessor::dispatch(
         response = execute<message::EnqueueWriteBuffer>(
                 static_cast<const message::EnqueueWriteBuffer&>(request), *host);
         break;
+    case message::EnqueueWriteBuffers::TYPE:
+        response = execute<message::EnqueueWriteBuffers>(
+                static_cast<const message::EnqueueWriteBuffers&>(request), *host);
+        break;
     case message::EnqueueReadBuffer::TYPE:
         response = execute<message::EnqueueReadBuffer>(
                 static_cast<const message::EnqueueReadBuffer&>(request), *host);
@@ -1357,10 +1726,22 @@ bool CLRequestProcessor::dispatch(
         response = execute<message::GetKernelWorkGroupInfo>(
                 static_cast<const message::GetKernelWorkGroupInfo&>(request), *host);
         break;
+    case message::SubscribeEvent::TYPE:
+        response = execute<message::SubscribeEvent>(
+                static_cast<const message::SubscribeEvent&>(request), *host);
+        break;
     case message::GetEventProfilingInfos::TYPE:
         response = execute<message::GetEventProfilingInfos>(
                 static_cast<const message::GetEventProfilingInfos&>(request), *host);
         break;
+    case message::SynchronizeClock::TYPE:
+        response = execute<message::SynchronizeClock>(
+                static_cast<const message::SynchronizeClock&>(request), *host);
+        break;
+    case message::GetTrace::TYPE:
+        response = execute<message::GetTrace>(
+                static_cast<const message::GetTrace&>(request), *host);
+        break;
     case message::SetKernelArgMemObject::TYPE:
         response = execute<message::SetKernelArgMemObject>(
                 static_cast<const message::SetKernelArgMemObject&>(request), *host);
@@ -51,8 +51,10 @@
 
 #include <dclasio/message/ErrorResponse.h>
 #include <dclasio/message/EventProfilingInfosResponse.h>
+#include <dclasio/message/GetTrace.h>
 #include <dclasio/message/InfoResponse.h>
 #include <dclasio/message/Response.h>
+#include <dclasio/message/SynchronizeClock.h>
 
 #include <dcl/DCLTypes.h>
 
@@ -102,6 +104,14 @@ bool CLResponseProcessor::dispatch(
         response.reset(new message::ErrorResponse(
                 static_cast<const message::ErrorResponse&>(message)));
         break;
+    case message::TraceResponse::TYPE:
+        response.reset(new message::TraceResponse(
+                static_cast<const message::TraceResponse&>(message)));
+        break;
+    case message::ClockResponse::TYPE:
+        response.reset(new message::ClockResponse(
+                static_cast<const message::ClockResponse&>(message)));
+        break;
     case message::EventProfilingInfosReponse::TYPE:
         response.reset(new message::EventProfilingInfosReponse(
                 static_cast<const message::EventProfilingInfosReponse&>(message)));
@@ -117,8 +127,9 @@ bool CLResponseProcessor::dispatch(
 
     assert(response && "No response");
     if (response) {
-        // move response into the response buffer associated with sender
-        computeNode->responseBuffer().put(std::move(response));
+        /* move response into the response buffer associated with sender, or
+         * pass it to the callback registered for its request */
+        computeNode->receiveResponse(std::move(response));
         dcl::util::Logger << dcl::util::Verbose
                 << "Received response from compute node" << std::endl;
     }
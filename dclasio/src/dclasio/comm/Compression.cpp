@@ -0,0 +1,248 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file Compression.cpp
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include "Compression.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+const size_t MIN_MATCH = 4; //!< minimum length of a match
+const size_t LAST_LITERALS = 5; //!< number of trailing bytes which are always literals
+const size_t MF_LIMIT = 12; //!< minimum distance of a match's start from the end of the input
+const size_t MAX_OFFSET = 65535; //!< maximum distance of a match
+const size_t RUN_MASK = 15; //!< maximum length encoded in a token nibble
+
+const unsigned int HASH_LOG = 12; //!< log2 of the number of hash table entries
+const unsigned int SKIP_TRIGGER = 6; //!< the search step increases every 2^SKIP_TRIGGER misses
+
+inline uint32_t read32(
+        const unsigned char *p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t hash(
+        uint32_t sequence) {
+    return (sequence * 2654435761U) >> (32 - HASH_LOG);
+}
+
+/*!
+ * \brief Returns the number of bytes required to encode a length
+ */
+inline size_t length_size(
+        size_t length) {
+    return (length < RUN_MASK) ? 0 : (length - RUN_MASK) / 255 + 1;
+}
+
+inline void put_length(
+        unsigned char *& op, size_t length) {
+    if (length < RUN_MASK) return;
+    for (length -= RUN_MASK; length >= 255; length -= 255) {
+        *op++ = 255;
+    }
+    *op++ = static_cast<unsigned char>(length);
+}
+
+inline bool get_length(
+        const unsigned char *src, size_t size, size_t& ip, size_t& length) {
+    unsigned char byte;
+    do {
+        if (ip == size) return false;
+        byte = src[ip++];
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+/*!
+ * \brief Appends a sequence of literals and a match to the output
+ * The last sequence comprises literals only, i.e., match_length is 0.
+ *
+ * \return \c true, if the sequence fits into the output, otherwise \c false
+ */
+bool put_sequence(
+        unsigned char *& op, const unsigned char *oend,
+        const unsigned char *literals, size_t literal_length,
+        size_t offset, size_t match_length) {
+    bool last = (match_length == 0);
+    if (!last) match_length -= MIN_MATCH;
+
+    size_t required = 1 + length_size(literal_length) + literal_length;
+    if (!last) required += 2 + length_size(match_length);
+    if (required > static_cast<size_t>(oend - op)) return false;
+
+    *op++ = static_cast<unsigned char>(
+            (std::min(literal_length, RUN_MASK) << 4) |
+            (last ? 0 : std::min(match_length, RUN_MASK)));
+    put_length(op, literal_length);
+    std::memcpy(op, literals, literal_length);
+    op += literal_length;
+    if (!last) {
+        *op++ = static_cast<unsigned char>(offset);
+        *op++ = static_cast<unsigned char>(offset >> 8);
+        put_length(op, match_length);
+    }
+    return true;
+}
+
+} /* unnamed namespace */
+
+/* ****************************************************************************/
+
+namespace dclasio {
+
+namespace comm {
+
+namespace compression {
+
+size_t compress(
+        const void *src, size_t size, void *dst, size_t capacity) {
+    const unsigned char *in = static_cast<const unsigned char *>(src);
+    unsigned char *op = static_cast<unsigned char *>(dst);
+    const unsigned char *oend = op + capacity;
+    size_t anchor = 0; // start of pending literals
+
+    if (size > MF_LIMIT) {
+        const size_t mflimit = size - MF_LIMIT;
+        const size_t matchlimit = size - LAST_LITERALS;
+        std::array<uint32_t, 1 << HASH_LOG> table; // positions of recent sequences
+        table.fill(0);
+        size_t misses = 0;
+
+        for (size_t ip = 0; ip < mflimit; ) {
+            uint32_t sequence = read32(in + ip);
+            uint32_t& entry = table[hash(sequence)];
+            size_t ref = entry;
+            entry = static_cast<uint32_t>(ip);
+            if (ref >= ip || ip - ref > MAX_OFFSET || read32(in + ref) != sequence) {
+                // skip faster over incompressible data
+                ip += 1 + (misses++ >> SKIP_TRIGGER);
+                continue;
+            }
+            misses = 0;
+
+            // extend match backwards into pending literals and forwards
+            while (ip > anchor && ref > 0 && in[ip - 1] == in[ref - 1]) {
+                --ip;
+                --ref;
+            }
+            size_t offset = ip - ref;
+            size_t match_end = ip + MIN_MATCH;
+            while (match_end < matchlimit && in[match_end] == in[match_end - offset]) {
+                ++match_end;
+            }
+
+            if (!put_sequence(op, oend, in + anchor, ip - anchor, offset, match_end - ip)) {
+                return 0;
+            }
+            ip = anchor = match_end;
+        }
+    }
+
+    // encode remaining input as literals
+    if (!put_sequence(op, oend, in + anchor, size - anchor, 0, 0)) {
+        return 0;
+    }
+    return op - static_cast<unsigned char *>(dst);
+}
+
+bool decompress(
+        const void *src, size_t size, void *dst, size_t capacity,
+        size_t& decompressed_size) {
+    const unsigned char *in = static_cast<const unsigned char *>(src);
+    unsigned char *out = static_cast<unsigned char *>(dst);
+    size_t ip = 0, op = 0;
+
+    while (ip < size) {
+        unsigned char token = in[ip++];
+
+        size_t literal_length = token >> 4;
+        if (literal_length == RUN_MASK && !get_length(in, size, ip, literal_length)) {
+            return false;
+        }
+        if (literal_length > size - ip || literal_length > capacity - op) {
+            return false;
+        }
+        std::memcpy(out + op, in + ip, literal_length);
+        ip += literal_length;
+        op += literal_length;
+        if (ip == size) break; // last sequence has no match
+
+        if (size - ip < 2) return false;
+        size_t offset = in[ip] | (static_cast<size_t>(in[ip + 1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) return false;
+
+        size_t match_length = token & RUN_MASK;
+        if (match_length == RUN_MASK && !get_length(in, size, ip, match_length)) {
+            return false;
+        }
+        match_length += MIN_MATCH;
+        if (match_length > capacity - op) return false;
+
+        if (offset >= match_length) {
+            std::memcpy(out + op, out + op - offset, match_length);
+            op += match_length;
+        } else {
+            // overlapping match repeats the last offset bytes
+            for (; match_length > 0; --match_length, ++op) {
+                out[op] = out[op - offset];
+            }
+        }
+    }
+
+    decompressed_size = op;
+    return true;
+}
+
+} // namespace compression
+
+} // namespace comm
+
+} // namespace dclasio
@@ -0,0 +1,108 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file Compression.h
+ *
+ * Lightweight compression of data stream chunks
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#ifndef COMPRESSION_H_
+#define COMPRESSION_H_
+
+#include <cstddef>
+
+namespace dclasio {
+
+namespace comm {
+
+/*!
+ * \brief Fast LZ77 compression of data stream chunks
+ *
+ * The compressed format is the LZ4 block format, i.e., a sequence of literal
+ * runs and back references into the last 64 KiB of output. Matches are found
+ * greedily using a single hash table lookup per position, and the search
+ * accelerates across incompressible input, such that compression throughput
+ * stays close to the network bandwidth.
+ */
+namespace compression {
+
+/*!
+ * \brief Compresses a buffer
+ * Compression fails, if the compressed data does not fit into the
+ * destination buffer. The capacity thus determines the minimum compression
+ * ratio for which compression pays off.
+ *
+ * \param[in]  src      source buffer
+ * \param[in]  size     size of source buffer in bytes
+ * \param[out] dst      destination buffer
+ * \param[in]  capacity size of destination buffer in bytes
+ * \return the size of the compressed data in bytes, or 0 if compression failed
+ */
+size_t compress(
+        const void *src,
+        size_t size,
+        void *dst,
+        size_t capacity);
+
+/*!
+ * \brief Decompresses a buffer
+ *
+ * \param[in]  src      source buffer containing compressed data
+ * \param[in]  size     size of compressed data in bytes
+ * \param[out] dst      destination buffer
+ * \param[in]  capacity size of destination buffer in bytes
+ * \param[out] decompressed_size    size of the decompressed data in bytes
+ * \return \c true, if the data has been decompressed, or \c false if it is
+ *         corrupted or does not fit into the destination buffer
+ */
+bool decompress(
+        const void *src,
+        size_t size,
+        void *dst,
+        size_t capacity,
+        size_t& decompressed_size);
+
+} // namespace compression
+
+} // namespace comm
+
+} // namespace dclasio
+
+#endif /* COMPRESSION_H_ */
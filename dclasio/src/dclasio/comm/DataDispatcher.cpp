@@ -53,6 +53,7 @@
 #include <dcl/DCLException.h>
 #include <dcl/DCLTypes.h>
 
+#include <dcl/util/Environment.h>
 #include <dcl/util/Logger.h>
 
 #include <boost/asio/buffer.hpp>
@@ -64,6 +65,10 @@
 
 #include <boost/system/error_code.hpp>
 
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <list>
 #include <memory>
@@ -71,6 +76,21 @@
 #include <ostream>
 #include <thread>
 #include <utility>
+#include <vector>
+
+namespace {
+
+/*!
+ * \brief Returns \c true, if DCL_DATA_COMPRESSION is set to a value other than 0
+ */
+bool compressionEnabled() {
+    const char *value = getenv("DCL_DATA_COMPRESSION");
+    return value && std::strcmp(value, "0") != 0;
+}
+
+} /* unnamed namespace */
+
+/* ****************************************************************************/
 
 namespace dclasio {
 
@@ -78,6 +98,10 @@ namespace comm {
 
 DataDispatcher::DataDispatcher(
         dcl::process_id pid) : _work(_io_service), _pid(pid) {
+    set_striping(
+            dcl::util::getEnvSize("DCL_DATA_STREAMS", 1, 1),
+            dcl::util::getEnvSize("DCL_DATA_CHUNK_SIZE", DataStream::DEFAULT_CHUNK_SIZE, 1));
+    set_compression(compressionEnabled());
 }
 
 DataDispatcher::~DataDispatcher() {
@@ -87,13 +111,23 @@ DataDispatcher::~DataDispatcher() {
 DataStream * DataDispatcher::create_data_stream(
         const endpoint_type& endpoint) {
     // create socket
-    auto socket(std::make_shared<boost::asio::ip::tcp::socket>(_io_service));
-    return add_data_stream(new DataStream(socket, endpoint));
+    // create one socket per stripe
+    std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> sockets;
+    for (size_t i = 0; i < _stripes; ++i) {
+        sockets.push_back(std::make_shared<boost::asio::ip::tcp::socket>(_io_service));
+    }
+    return add_data_stream(new DataStream(sockets, endpoint, _chunk_size, _compression));
 }
 
 void DataDispatcher::destroy_data_stream(
         DataStream *data_stream) {
     std::lock_guard<std::mutex> lock(_mutex);
+    for (auto i = std::begin(_striped_data_streams); i != std::end(_striped_data_streams); ++i) {
+        if (i->second == data_stream) {
+            _striped_data_streams.erase(i);
+            break;
+        }
+    }
     // remove data stream from list; implicitly calls destructor
     _data_streams.remove_if([data_stream](const std::unique_ptr<DataStream>& entry){
             return entry.get() == data_stream; });
@@ -120,6 +154,19 @@ void DataDispatcher::bind(
     _acceptor->bind(endpoint);
 }
 
+void DataDispatcher::set_striping(
+        size_t stripes, size_t chunk_size) {
+    assert(stripes > 0 && stripes <= UINT16_MAX && "Invalid number of stripes");
+    assert(chunk_size > 0 && chunk_size <= UINT32_MAX && "Invalid chunk size");
+    _stripes = stripes;
+    _chunk_size = chunk_size;
+}
+
+void DataDispatcher::set_compression(
+        bool compression) {
+    _compression = compression;
+}
+
 void DataDispatcher::start() {
     if (_acceptor) {
         try {
@@ -135,14 +182,20 @@ void DataDispatcher::start() {
         }
     }
 
-    /* start worker thread
+    /* start worker threads; use one thread per stripe, such that stripes are
+     * processed in parallel
      * use lambda to resolve overloaded boost::asio::io_service::run */
-    _worker = std::thread([this](){ _io_service.run(); });
+    while (_workers.size() < _stripes) {
+        _workers.emplace_back([this](){ _io_service.run(); });
+    }
 }
 
 void DataDispatcher::stop() {
     _io_service.stop();
-    if (_worker.joinable()) _worker.join();
+    for (auto& worker : _workers) {
+        if (worker.joinable()) worker.join();
+    }
+    _workers.clear();
 }
 
 void DataDispatcher::start_accept() {
@@ -164,7 +217,7 @@ void DataDispatcher::handle_accept(
     }
 
     auto buf(std::make_shared<dcl::ByteBuffer>());
-    buf->resize(sizeof(dcl::process_id) + 2);
+    buf->resize(sizeof(dcl::process_id) + 2 + 2 * sizeof(uint16_t) + sizeof(uint32_t));
 
     // await authentication request from incoming data stream
     boost::asio::async_read(
@@ -190,13 +243,28 @@ void DataDispatcher::handle_approval(
 
     dcl::process_id pid;
     uint8_t proc_type; // process type
-    uint8_t proto; // protocol (must be data stream)
-    *buf >> pid >> proc_type >> proto;
+    uint8_t proto; // protocol options (see DataStream)
+    uint16_t stripe, stripes; // stripe index and number of stripes
+    uint32_t chunk_size;
+    *buf >> pid >> proc_type >> proto >> stripe >> stripes >> chunk_size;
     // TODO Ensure pid != 0
     /* TODO Ensure process type
     ProcessImpl::Type process_type = static_cast<ProcessImpl::Type>(proc_type);
      */
-    // TODO Ensure data stream protocol
+    bool compression = (proto & DataStream::OPTION_COMPRESSION) != 0;
+
+    if (stripe >= stripes || chunk_size == 0) {
+        dcl::util::Logger << dcl::util::Error
+                << "Rejected invalid data stream from process (pid=" << pid << ')'
+                << std::endl;
+        return;
+    }
+
+    if (stripe > 0) {
+        // data stream has already been identified by its first stripe
+        attach_stripe(pid, stripe, socket);
+        return;
+    }
 
     // request connection approval
     std::unique_lock<std::mutex> lock(_mutex);
@@ -213,7 +281,20 @@ void DataDispatcher::handle_approval(
 
     if (approved) {
         // data stream has been approved - keep it
-        auto dataStream = add_data_stream(new DataStream(socket));
+        auto dataStream = add_data_stream(new DataStream(socket, stripes, chunk_size, compression));
+        if (stripes > 1) {
+            // attach stripes which arrived before their data stream has been approved
+            lock.lock();
+            _striped_data_streams[pid] = dataStream;
+            auto pending = _pending_stripes.find(pid);
+            if (pending != std::end(_pending_stripes)) {
+                for (const auto& entry : pending->second) {
+                    dataStream->attach_stripe(entry.first, entry.second);
+                }
+                _pending_stripes.erase(pending);
+            }
+            lock.unlock();
+        }
 
 #if USE_DATA_STREAM_RESPONSE
         *buf << _pid; // signal approval: return own process ID
@@ -235,7 +316,28 @@ void DataDispatcher::handle_approval(
         dcl::util::Logger << dcl::util::Error
                 << "Rejected data stream from process (pid=" << pid << ')'
                 << std::endl;
+
+        // discard stripes of rejected data stream
+        lock.lock();
+        _pending_stripes.erase(pid);
+    }
+}
+
+void DataDispatcher::attach_stripe(
+        dcl::process_id pid,
+        size_t stripe,
+        std::shared_ptr<boost::asio::ip::tcp::socket> socket) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto dataStream = _striped_data_streams.find(pid);
+    if (dataStream != std::end(_striped_data_streams)) {
+        dataStream->second->attach_stripe(stripe, socket);
+    } else {
+        _pending_stripes[pid].emplace_back(stripe, socket);
     }
+
+    dcl::util::Logger << dcl::util::Verbose
+            << "Accepted stripe " << stripe << " of data stream from process (pid=" << pid << ')'
+            << std::endl;
 }
 
 } // namespace comm
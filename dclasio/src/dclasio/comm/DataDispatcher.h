@@ -59,8 +59,10 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace dclasio {
 
@@ -73,6 +75,12 @@ class DataStream;
 
 /*!
  * Manages the threads for process pending data transfers of all data streams
+ *
+ * Outgoing data streams are striped across DCL_DATA_STREAMS sockets with a
+ * chunk size of DCL_DATA_CHUNK_SIZE bytes, if these environment variables are
+ * set. Their chunks are compressed if DCL_DATA_COMPRESSION is set to 1.
+ * Incoming data streams adopt the striping and compression of the remote
+ * process.
  */
 class DataDispatcher {
 public:
@@ -106,6 +114,24 @@ public:
     void bind(
             const endpoint_type& endpoint);
 
+    /*!
+     * \brief Sets the striping of data streams created by this data dispatcher
+     *
+     * \param[in]  stripes      number of sockets per data stream
+     * \param[in]  chunk_size   maximum size of a chunk in bytes
+     */
+    void set_striping(
+            size_t stripes,
+            size_t chunk_size);
+
+    /*!
+     * \brief Enables or disables compression of data streams created by this data dispatcher
+     *
+     * \param[in]  compression  \c true, if chunks should be compressed
+     */
+    void set_compression(
+            bool compression);
+
     void start();
     void stop();
 
@@ -141,6 +167,20 @@ private:
             const boost::system::error_code& ec,
             size_t bytes_transferred);
 
+    /*!
+     * \brief Attaches an incoming stripe to its data stream
+     * If the data stream has not been approved yet, the stripe is attached
+     * after approval.
+     *
+     * \param[in]  pid      ID of the remote process
+     * \param[in]  stripe   index of the stripe
+     * \param[in]  socket   socket of the stripe
+     */
+    void attach_stripe(
+            dcl::process_id pid,
+            size_t stripe,
+            std::shared_ptr<boost::asio::ip::tcp::socket> socket);
+
     /*!
      * \brief Adds a data stream to this data dispatcher
      *
@@ -160,10 +200,17 @@ private:
     std::unique_ptr<boost::asio::ip::tcp::acceptor> _acceptor; //!< server socket
 
     dcl::process_id _pid;
-    std::thread _worker;
+    std::vector<std::thread> _workers;
+
+    size_t _stripes; //!< number of stripes of outgoing data streams
+    size_t _chunk_size; //!< chunk size of outgoing data streams
+    bool _compression; //!< \c true, if outgoing data streams are compressed
 
     std::list<std::unique_ptr<DataStream>> _data_streams; //!< data stream managed by this data dispatcher
     std::unordered_set<connection_listener *> _connection_listeners; //!< connection listeners
+    std::unordered_map<dcl::process_id, DataStream *> _striped_data_streams; //!< incoming striped data streams
+    std::unordered_map<dcl::process_id, std::vector<std::pair<size_t,
+            std::shared_ptr<boost::asio::ip::tcp::socket>>>> _pending_stripes; //!< stripes that arrived before their data stream
     std::mutex _mutex; //!< protects data stream and connection listener containers
 };
 
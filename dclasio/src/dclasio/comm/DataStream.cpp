@@ -43,6 +43,7 @@
 
 #include "DataStream.h"
 
+#include "Compression.h"
 #include "DataTransferImpl.h"
 
 #include <dcl/ByteBuffer.h>
@@ -56,188 +57,571 @@
 
 #include <boost/asio/ip/tcp.hpp>
 
+#include <boost/system/error_code.hpp>
+
+// TODO Replace htonl, ntohl by own, portable implementation
+#include <netinet/in.h>
+
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <utility>
+#include <vector>
+
+namespace {
+
+/*!
+ * \brief Returns the time elapsed since start in nanoseconds
+ */
+uint64_t elapsed(
+        std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+}
+
+/*!
+ * \brief Returns a throughput in MB/s
+ */
+double throughput(
+        uint64_t bytes, uint64_t nanoseconds) {
+    return nanoseconds ? (1000.0 * bytes / nanoseconds) : 0.0;
+}
+
+} /* unnamed namespace */
+
+/* ****************************************************************************/
 
 namespace dclasio {
 
 namespace comm {
 
 DataStream::DataStream(
-        const std::shared_ptr<boost::asio::ip::tcp::socket>& socket) :
-        _socket(socket), _receiving(false), _sending(false) {
+        const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
+        size_t stripes, size_t chunk_size, bool compression) :
+        _chunk_size(chunk_size), _compression(compression) {
+    assert(stripes > 0 && "Invalid number of stripes");
+    assert(chunk_size > 0 && chunk_size <= UINT32_MAX && "Invalid chunk size");
+    _next_read_stripe.fill(0);
+    _next_write_stripe.fill(0);
     // TODO Ensure that socket is connected
-    _remote_endpoint = _socket->remote_endpoint();
+    _remote_endpoint = socket->remote_endpoint();
+
+    _stripes.reserve(stripes);
+    _stripes.emplace_back(new stripe(socket));
+    while (_stripes.size() < stripes) {
+        // sockets of remaining stripes are attached later
+        _stripes.emplace_back(new stripe(nullptr));
+    }
 }
 
 DataStream::DataStream(
-        const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
-        boost::asio::ip::tcp::endpoint remote_endpoint) :
-        _socket(socket), _remote_endpoint(remote_endpoint), _receiving(false), _sending(false) {
-    assert(!socket->is_open()); // socket must not be connect
+        const std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>>& sockets,
+        boost::asio::ip::tcp::endpoint remote_endpoint,
+        size_t chunk_size, bool compression) :
+        _remote_endpoint(remote_endpoint), _chunk_size(chunk_size),
+        _compression(compression) {
+    assert(!sockets.empty() && "No sockets");
+    assert(chunk_size > 0 && chunk_size <= UINT32_MAX && "Invalid chunk size");
+    _next_read_stripe.fill(0);
+    _next_write_stripe.fill(0);
+
+    _stripes.reserve(sockets.size());
+    for (const auto& socket : sockets) {
+        assert(!socket->is_open()); // socket must not be connect
+        _stripes.emplace_back(new stripe(socket));
+    }
 }
 
 DataStream::~DataStream() {
+    if (_compression) {
+        auto s = stats();
+        dcl::util::Logger << dcl::util::Info
+                << "Data stream compression (remote=" << _remote_endpoint << "): sent "
+                << s.bytes_sent << " bytes as " << s.wire_bytes_sent << " bytes ("
+                << s.chunks_compressed << " chunks compressed, "
+                << s.chunks_incompressible << " incompressible, "
+                << throughput(s.bytes_sent, s.compression_time) << " MB/s), received "
+                << s.bytes_received << " bytes as " << s.wire_bytes_received << " bytes ("
+                << throughput(s.bytes_received, s.decompression_time) << " MB/s)"
+                << std::endl;
+    }
 }
 
 dcl::process_id DataStream::connect(
         dcl::process_id pid) {
-    _socket->connect(_remote_endpoint); // connect socket to remote endpoint
-
-    // send process ID to remote process via data stream
-    // TODO Encode local process type and data stream protocol
-    dcl::ByteBuffer buf;
-    buf << pid << uint8_t(0) << uint8_t(0);
-    boost::asio::write(*_socket, boost::asio::buffer(buf.begin(), buf.size()));
-    dcl::util::Logger << dcl::util::Verbose
-            << "Sent process identification message for data stream (pid=" << pid << ')'
-            << std::endl;
-
+    dcl::process_id remote_pid = 0;
+
+    for (size_t i = 0; i < _stripes.size(); ++i) {
+        auto& socket = *_stripes[i]->socket;
+        socket.connect(_remote_endpoint); // connect socket to remote endpoint
+
+        /* send process ID to remote process via data stream
+         * The protocol options, stripe index, number of stripes, and chunk
+         * size are sent along, such that the remote process can assemble the
+         * stripes. */
+        // TODO Encode local process type
+        dcl::ByteBuffer buf;
+        buf << pid << uint8_t(0) << uint8_t(_compression ? OPTION_COMPRESSION : 0)
+                << static_cast<uint16_t>(i) << static_cast<uint16_t>(_stripes.size())
+                << static_cast<uint32_t>(_chunk_size);
+        boost::asio::write(socket, boost::asio::buffer(buf.begin(), buf.size()));
+        dcl::util::Logger << dcl::util::Verbose
+                << "Sent process identification message for data stream (pid=" << pid
+                << ", stripe=" << i << '/' << _stripes.size() << ')'
+                << std::endl;
+
+        if (i == 0) {
 #if USE_DATA_STREAM_RESPONSE
-    // receive response
-    buf.resize(sizeof(dcl::process_id));
-    boost::asio::read(*_socket, boost::asio::buffer(buf.begin(), buf.size()));
-    buf >> pid;
-    dcl::util::Logger << dcl::util::Verbose
-            << "Received identification message response (pid=" << pid << ')'
-            << std::endl;
+            // receive response
+            buf.resize(sizeof(dcl::process_id));
+            boost::asio::read(socket, boost::asio::buffer(buf.begin(), buf.size()));
+            buf >> remote_pid;
+            dcl::util::Logger << dcl::util::Verbose
+                    << "Received identification message response (pid=" << remote_pid << ')'
+                    << std::endl;
+            if (remote_pid == 0) break; // connection has been rejected
+#else
+            remote_pid = pid;
 #endif
+        }
+    }
 
-    return pid;
+    return remote_pid;
 }
 
 void DataStream::disconnect() {
-    _socket->shutdown(boost::asio::ip::tcp::socket::shutdown_both);
-    _socket->close();
+    for (auto& s : _stripes) {
+        std::lock(s->readq_mtx, s->writeq_mtx);
+        std::lock_guard<std::mutex> read_lock(s->readq_mtx, std::adopt_lock);
+        std::lock_guard<std::mutex> write_lock(s->writeq_mtx, std::adopt_lock);
+        if (s->socket && s->socket->is_open()) {
+            boost::system::error_code ec; // ignore errors of unconnected stripes
+            s->socket->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+            s->socket->close(ec);
+        }
+    }
 }
 
-std::shared_ptr<DataReceipt> DataStream::read(
-        size_t size, void *ptr) {
-    auto read(std::make_shared<DataReceipt>(size, ptr));
+void DataStream::attach_stripe(
+        size_t index,
+        const std::shared_ptr<boost::asio::ip::tcp::socket>& socket) {
+    assert(index < _stripes.size() && "Invalid stripe index");
+    auto& s = *_stripes[index];
+
+    std::unique_lock<std::mutex> read_lock(s.readq_mtx, std::defer_lock);
+    std::unique_lock<std::mutex> write_lock(s.writeq_mtx, std::defer_lock);
+    std::lock(read_lock, write_lock);
+    assert(!s.socket && "Stripe already attached");
+    s.socket = socket;
+
+    // start processing chunks that have been submitted before the stripe has been attached
+    bool start_receiving = false;
+    for (const auto& readq : s.readq) {
+        if (!readq.empty()) start_receiving = true;
+    }
+    bool start_sending = false;
+    for (const auto& writeq : s.writeq) {
+        if (!writeq.empty()) start_sending = true;
+    }
+    s.receiving = start_receiving;
+    s.sending = start_sending;
+    read_lock.unlock();
+    write_lock.unlock();
 
-    std::unique_lock<std::mutex> lock(_readq_mtx);
-    if ((_receiving)) {
-        _readq.push(read);
-    } else {
-        // start read loop
-        _receiving = true;
-        lock.unlock();
+    if (start_receiving) start_read(s);
+    if (start_sending) start_write(s);
+}
 
-        start_read(new readq_type({ read }));
+DataStream::statistics DataStream::stats() const {
+    statistics s;
+    s.bytes_sent = _stats.bytes_sent;
+    s.wire_bytes_sent = _stats.wire_bytes_sent;
+    s.bytes_received = _stats.bytes_received;
+    s.wire_bytes_received = _stats.wire_bytes_received;
+    s.chunks_compressed = _stats.chunks_compressed;
+    s.chunks_incompressible = _stats.chunks_incompressible;
+    s.compression_time = _stats.compression_time;
+    s.decompression_time = _stats.decompression_time;
+    return s;
+}
+
+size_t DataStream::chunk_count(
+        size_t size) const {
+    if (size <= _chunk_size) return 1;
+    return (size + _chunk_size - 1) / _chunk_size;
+}
+
+std::shared_ptr<DataReceipt> DataStream::read(
+        size_t size, void *ptr, dcl::DataTransfer::Priority priority) {
+    size_t chunks = chunk_count(size);
+    size_t p = static_cast<size_t>(priority);
+    assert(p < PRIORITIES && "Invalid priority");
+    auto read(std::make_shared<DataReceipt>(size, ptr, chunks));
+
+    /* Chunks must be assigned to stripes in the order of submission, as the
+     * remote process assigns its data sendings of the same priority in the
+     * same order */
+    std::lock_guard<std::mutex> lock(_read_mtx);
+    for (size_t offset = 0; chunks > 0; --chunks, offset += _chunk_size) {
+        auto& s = *_stripes[_next_read_stripe[p]];
+        _next_read_stripe[p] = (_next_read_stripe[p] + 1) % _stripes.size();
+        submit_read(s, p, chunk<DataReceipt>{ read, offset,
+                (chunks > 1 ? _chunk_size : size - offset) });
     }
 
     return read;
 }
 
 std::shared_ptr<DataSending> DataStream::write(
-        size_t size, const void *ptr) {
-    auto write(std::make_shared<DataSending>(size, ptr));
+        size_t size, const void *ptr, dcl::DataTransfer::Priority priority) {
+    size_t chunks = chunk_count(size);
+    size_t p = static_cast<size_t>(priority);
+    assert(p < PRIORITIES && "Invalid priority");
+    auto write(std::make_shared<DataSending>(size, ptr, chunks));
+
+    std::lock_guard<std::mutex> lock(_write_mtx);
+    for (size_t offset = 0; chunks > 0; --chunks, offset += _chunk_size) {
+        auto& s = *_stripes[_next_write_stripe[p]];
+        _next_write_stripe[p] = (_next_write_stripe[p] + 1) % _stripes.size();
+        submit_write(s, p, chunk<DataSending>{ write, offset,
+                (chunks > 1 ? _chunk_size : size - offset) });
+    }
 
-    std::unique_lock<std::mutex> lock(_writeq_mtx);
-    if (_sending) {
-        _writeq.push(write);
-    } else {
+    return write;
+}
+
+void DataStream::submit_read(
+        stripe& s, size_t priority, chunk<DataReceipt>&& read) {
+    std::unique_lock<std::mutex> lock(s.readq_mtx);
+    auto& stagingq = s.stagingq[priority];
+    if (!stagingq.empty()) {
+        // chunk has already been received
+        auto staging(std::move(stagingq.front()));
+        stagingq.pop();
+        lock.unlock();
+
+        finish_staged_read(read, staging);
+        return;
+    }
+
+    s.readq[priority].push(std::move(read));
+    if (!s.receiving && s.socket) {
+        // start (or resume) read loop
+        s.receiving = true;
+        lock.unlock();
+
+        start_read(s);
+    }
+}
+
+void DataStream::submit_write(
+        stripe& s, size_t priority, chunk<DataSending>&& write) {
+    std::unique_lock<std::mutex> lock(s.writeq_mtx);
+    s.writeq[priority].push(std::move(write));
+    if (!s.sending && s.socket) {
         // start write loop
-        _sending = true;
+        s.sending = true;
         lock.unlock();
 
-        start_write(new writeq_type({ write }));
+        start_write(s);
     }
+}
 
-    return write;
+size_t DataStream::decompress(
+        const std::vector<char>& src, char *dst, size_t capacity) {
+    auto start = std::chrono::steady_clock::now();
+    size_t size = 0;
+    bool valid = compression::decompress(src.data(), src.size(), dst, capacity, size);
+    _stats.decompression_time += elapsed(start);
+    if (!valid) {
+        dcl::util::Logger << dcl::util::Error
+                << "Data stream protocol error: received corrupted compressed chunk"
+                << std::endl;
+        return 0;
+    }
+    return size;
+}
+
+void DataStream::finish_staged_read(
+        const chunk<DataReceipt>& read,
+        const std::vector<char>& staging) {
+    read.transfer->onStart();
+    if (read.size != staging.size()) {
+        dcl::util::Logger << dcl::util::Error
+                << "Data stream protocol error: expected chunk of " << read.size
+                << " bytes, but received " << staging.size() << " bytes"
+                << std::endl;
+        read.transfer->onFinish(
+                boost::system::errc::make_error_code(boost::system::errc::protocol_error), 0);
+        return;
+    }
+    std::copy(std::begin(staging), std::end(staging),
+            static_cast<char *>(read.transfer->ptr()) + read.offset);
+    read.transfer->onFinish(boost::system::error_code(), staging.size());
 }
 
 void DataStream::start_read(
-        readq_type *readq) {
-    /* TODO Pass readq by rvalue reference rather than by pointer
-     * This is currently not supported by lambdas (see comment in start_write) */
-    assert(readq); // ouch!
-    if (readq->empty()) {
-        // pick new reads from the data stream's read queue
-        std::lock_guard<std::mutex> lock(_readq_mtx);
-        if (_readq.empty()) {
-            _receiving = false;
-            delete readq;
+        stripe& s) {
+    std::unique_lock<std::mutex> lock(s.readq_mtx);
+    if (!s.header_received) {
+        bool pending = false;
+        for (const auto& readq : s.readq) {
+            if (!readq.empty()) pending = true;
+        }
+        if (!pending) {
+            s.receiving = false;
             return; // no more reads - exit read loop
         }
-        _readq.swap(*readq);
+        lock.unlock();
+
+        // receive frame header of next chunk
+        boost::asio::async_read(
+                *s.socket, boost::asio::buffer(&s.read_header, sizeof(s.read_header)),
+                [this, &s](const boost::system::error_code& ec, size_t bytes_transferred){
+                        handle_read_header(s, ec, bytes_transferred); });
+        return;
+    }
+
+    // pick read for received frame header
+    auto& readq = s.readq[s.read_header.priority];
+    if (readq.empty()) {
+        // no read of the chunk's priority has been submitted yet - stage chunk
+        size_t priority = s.read_header.priority;
+        bool compressed = s.read_compressed;
+        auto& buffer = compressed ? s.read_buffer : s.staging;
+        buffer.resize(s.read_header.size);
+        s.header_received = false;
+        lock.unlock();
+
+        boost::asio::async_read(
+                *s.socket, boost::asio::buffer(buffer),
+                [this, &s, priority, compressed](const boost::system::error_code& ec, size_t bytes_transferred){
+                        handle_read_staging(s, priority, compressed, ec, bytes_transferred); });
+        return;
+    }
+    s.read = std::move(readq.front());
+    readq.pop();
+    s.header_received = false;
+    bool compressed = s.read_compressed;
+    lock.unlock();
+
+    auto& read = s.read;
+    read.transfer->onStart();
+    if (compressed) {
+        // receive compressed chunk body and decompress it afterwards
+        s.read_buffer.resize(s.read_header.size);
+        boost::asio::async_read(
+                *s.socket, boost::asio::buffer(s.read_buffer),
+                [this, &s](const boost::system::error_code& ec, size_t bytes_transferred){
+                        handle_read_compressed(s, ec, bytes_transferred); });
+        return;
+    }
+    if (read.size != s.read_header.size) {
+        dcl::util::Logger << dcl::util::Error
+                << "Data stream protocol error: expected chunk of " << read.size
+                << " bytes, but received " << s.read_header.size << " bytes"
+                << std::endl;
+        // TODO Handle protocol errors (the data stream is corrupted at this point)
+        handle_read(s, boost::system::errc::make_error_code(boost::system::errc::protocol_error), 0);
+        return;
     }
-    // readq is non-empty now
 
-    auto& read = readq->front();
-    read->onStart();
     boost::asio::async_read(
-            *_socket, boost::asio::buffer(read->ptr(), read->size()),
-            [this, readq](const boost::system::error_code& ec, size_t bytes_transferred){
-                    handle_read(readq, ec, bytes_transferred); });
+            *s.socket, boost::asio::buffer(
+                    static_cast<char *>(read.transfer->ptr()) + read.offset, read.size),
+            [this, &s](const boost::system::error_code& ec, size_t bytes_transferred){
+                    handle_read(s, ec, bytes_transferred); });
+}
+
+void DataStream::handle_read_header(
+        stripe& s,
+        const boost::system::error_code& ec,
+        size_t bytes_transferred) {
+    std::unique_lock<std::mutex> lock(s.readq_mtx);
+    if (ec) {
+        dcl::util::Logger << dcl::util::Error
+                << "Receiving chunk header failed: " << ec.message()
+                << std::endl;
+        // fail all pending reads of this stripe
+        std::array<readq_type, PRIORITIES> readqs;
+        readqs.swap(s.readq);
+        s.receiving = false;
+        lock.unlock();
+        for (auto& readq : readqs) {
+            for (; !readq.empty(); readq.pop()) {
+                readq.front().transfer->onFinish(ec, 0);
+            }
+        }
+        return;
+    }
+
+    s.read_header.priority = ntohl(s.read_header.priority);
+    s.read_header.size = ntohl(s.read_header.size);
+    s.read_compressed = (s.read_header.priority & COMPRESSED) != 0;
+    s.read_header.priority &= ~COMPRESSED;
+    _stats.wire_bytes_received += s.read_header.size;
+    if (s.read_header.priority >= PRIORITIES) {
+        dcl::util::Logger << dcl::util::Error
+                << "Data stream protocol error: invalid chunk priority "
+                << s.read_header.priority << std::endl;
+        // TODO Handle protocol errors
+        s.read_header.priority = PRIORITIES - 1;
+    }
+    s.header_received = true;
+    lock.unlock();
+
+    start_read(s); // receive chunk body
 }
 
 void DataStream::handle_read(
-        readq_type *readq,
+        stripe& s,
         const boost::system::error_code& ec,
         size_t bytes_transferred) {
-    // current read is first element in readq, so readq must be non-empty
-    assert(readq /* ouch! */ && !readq->empty());
-    readq->front()->onFinish(ec, bytes_transferred);
-    readq->pop();
+    if (!ec) _stats.bytes_received += bytes_transferred;
+    s.read.transfer->onFinish(ec, bytes_transferred);
+    s.read.transfer.reset();
 
     if (ec) {
         // TODO Handle errors
     }
 
-    start_read(readq); // process remaining reads
+    start_read(s); // process remaining reads
+}
+
+void DataStream::handle_read_compressed(
+        stripe& s,
+        const boost::system::error_code& ec,
+        size_t bytes_transferred) {
+    if (ec) {
+        handle_read(s, ec, 0);
+        return;
+    }
+
+    auto& read = s.read;
+    size_t size = decompress(s.read_buffer,
+            static_cast<char *>(read.transfer->ptr()) + read.offset, read.size);
+    if (size != read.size) {
+        dcl::util::Logger << dcl::util::Error
+                << "Data stream protocol error: expected chunk of " << read.size
+                << " bytes, but received " << size << " bytes"
+                << std::endl;
+        handle_read(s, boost::system::errc::make_error_code(boost::system::errc::protocol_error), 0);
+        return;
+    }
+
+    handle_read(s, ec, size);
+}
+
+void DataStream::handle_read_staging(
+        stripe& s,
+        size_t priority,
+        bool compressed,
+        const boost::system::error_code& ec,
+        size_t bytes_transferred) {
+    if (ec) {
+        // errors are signaled to the pending reads by the next header receipt
+        start_read(s);
+        return;
+    }
+
+    if (compressed) {
+        /* a chunk is never larger than the chunk size; a corrupted chunk is
+         * staged empty and thus fails its data receipt */
+        s.staging.resize(_chunk_size);
+        s.staging.resize(decompress(s.read_buffer, s.staging.data(), s.staging.size()));
+    }
+    _stats.bytes_received += s.staging.size();
+
+    std::unique_lock<std::mutex> lock(s.readq_mtx);
+    auto& readq = s.readq[priority];
+    if (readq.empty()) {
+        s.stagingq[priority].push(std::move(s.staging));
+        lock.unlock();
+    } else {
+        // a matching read has been submitted while receiving the chunk
+        auto read(std::move(readq.front()));
+        readq.pop();
+        lock.unlock();
+
+        finish_staged_read(read, s.staging);
+    }
+    s.staging.clear();
+
+    start_read(s); // process remaining reads
 }
 
 void DataStream::start_write(
-        writeq_type *writeq) {
-    /* TODO Pass writeq by rvalue reference rather than by pointer
-     * is currently not supported by lambdas (see comment below) */
-    assert(writeq); // ouch!
-    if (writeq->empty()) {
-        // pick new writes from the data stream's write queue
-        std::lock_guard<std::mutex> lock(_writeq_mtx);
-        if (_writeq.empty()) {
-            _sending = false;
-            delete writeq;
-            return; // no more writes - exit write loop
+        stripe& s) {
+    std::unique_lock<std::mutex> lock(s.writeq_mtx);
+    // pick next write from non-empty write queue of highest priority
+    auto writeq = std::find_if(std::begin(s.writeq), std::end(s.writeq),
+            [](const writeq_type& writeq){ return !writeq.empty(); });
+    if (writeq == std::end(s.writeq)) {
+        s.sending = false;
+        return; // no more writes - exit write loop
+    }
+    s.write = std::move(writeq->front());
+    writeq->pop();
+    auto priority = static_cast<uint32_t>(writeq - std::begin(s.writeq));
+    lock.unlock();
+
+    auto& write = s.write;
+    write.transfer->onStart();
+    boost::asio::const_buffer body(
+            static_cast<const char *>(write.transfer->ptr()) + write.offset, write.size);
+    if (_compression) {
+        auto start = std::chrono::steady_clock::now();
+        // compression fails if it does not save at least an eighth of the chunk
+        s.write_buffer.resize(write.size - write.size / 8);
+        size_t size = compression::compress(
+                boost::asio::buffer_cast<const char *>(body), write.size,
+                s.write_buffer.data(), s.write_buffer.size());
+        _stats.compression_time += elapsed(start);
+        if (size > 0) {
+            body = boost::asio::const_buffer(s.write_buffer.data(), size);
+            priority |= COMPRESSED;
+            ++_stats.chunks_compressed;
+        } else {
+            // chunk is incompressible - send it raw
+            ++_stats.chunks_incompressible;
         }
-        _writeq.swap(*writeq);
     }
-    // writeq is non-empty now
-
-    auto& write = writeq->front();
-    write->onStart();
-    /* TODO *Move* writeq through (i.e., into and out of) lambda capture
-     * In C++14 this should be possible by generalized lambda captures as follows:
-    boost::asio::async_write(
-            *_socket, boost::asio::buffer(write->ptr(), write->size()),
-            [this, writeq{std::move(writeq)}](const boost::system::error_code& ec, size_t bytes_transferred){
-                    handle_write(std::move(writeq), ec, bytes_transferred); });
-     */
-    boost::asio::async_write(
-            *_socket, boost::asio::buffer(write->ptr(), write->size()),
-            [this, writeq](const boost::system::error_code& ec, size_t bytes_transferred){
-                    handle_write(writeq, ec, bytes_transferred); });
+    s.write_header.priority = htonl(priority);
+    s.write_header.size = htonl(static_cast<uint32_t>(boost::asio::buffer_size(body)));
+
+    // send frame header and chunk body at once
+    std::array<boost::asio::const_buffer, 2> buffers = {{
+            boost::asio::buffer(&s.write_header, sizeof(s.write_header)),
+            body }};
+    boost::asio::async_write(*s.socket, buffers,
+            [this, &s](const boost::system::error_code& ec, size_t bytes_transferred){
+                    handle_write(s, ec, bytes_transferred); });
 }
 
 void DataStream::handle_write(
-        writeq_type *writeq,
+        stripe& s,
         const boost::system::error_code& ec,
         size_t bytes_transferred) {
-    // current write is first element in writeq, so writeq must be non-empty
-    assert(writeq /* ouch! */ && !writeq->empty());
-    writeq->front()->onFinish(ec, bytes_transferred);
-    writeq->pop();
+    if (!ec) {
+        // do not account for frame header
+        _stats.bytes_sent += s.write.size;
+        _stats.wire_bytes_sent += bytes_transferred - sizeof(header_type);
+    }
+    // report the size of the chunk rather than its size on the wire
+    s.write.transfer->onFinish(ec, ec ? 0 : s.write.size);
+    s.write.transfer.reset();
 
     if (ec) {
         // TODO Handle errors
     }
 
-    start_write(writeq); // process remaining writes
+    start_write(s); // process remaining writes
 }
 
 } // namespace comm
@@ -46,16 +46,21 @@
 
 #include "DataTransferImpl.h"
 
+#include <dcl/DataTransfer.h>
 #include <dcl/DCLTypes.h>
 
 #include <boost/asio/ip/tcp.hpp>
 
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <vector>
 
 namespace dclasio {
 
@@ -64,36 +69,92 @@ namespace comm {
 // TODO Split DataStream into InputDataStream and OutputDataStream to model simplex connections and reduce code redundancy
 /*!
  * \brief A data stream maintains a set of incoming and outgoing data transfers from/to a single remote process
+ *
+ * Data transfers are split into chunks, each of which is sent with a frame
+ * header comprising the chunk's priority and size. Pending chunks of normal
+ * priority are always sent before chunks of background priority, such that
+ * small application data transfers are interleaved with large background
+ * data transfers rather than being blocked by them.
+ *
+ * A data stream may be striped across multiple sockets to the same remote
+ * process. The chunks of a data transfer are then sent or received in
+ * parallel on consecutive stripes. Chunks of each priority are assigned to
+ * stripes round-robin in the order in which data transfers of that priority
+ * are submitted, such that both ends of the data stream agree on the stripe
+ * of each chunk.
+ *
+ * If compression has been negotiated for a data stream, each outgoing chunk
+ * is compressed separately and flagged as compressed in its frame header.
+ * Chunks which do not compress well are sent raw.
  */
 class DataStream {
 public:
-    typedef std::queue<std::shared_ptr<DataReceipt>, std::list<std::shared_ptr<DataReceipt>>> readq_type;
-    typedef std::queue<std::shared_ptr<DataSending>, std::list<std::shared_ptr<DataSending>>> writeq_type;
+    /*!
+     * \brief A contiguous part of a data transfer that is processed by a single stripe
+     */
+    template<typename Transfer>
+    struct chunk {
+        std::shared_ptr<Transfer> transfer;
+        size_t offset; //!< offset of chunk within transfer
+        size_t size; //!< size of chunk in bytes
+    };
+
+    typedef std::queue<chunk<DataReceipt>, std::list<chunk<DataReceipt>>> readq_type;
+    typedef std::queue<chunk<DataSending>, std::list<chunk<DataSending>>> writeq_type;
+    typedef std::queue<std::vector<char>, std::list<std::vector<char>>> stagingq_type;
+
+    /*!
+     * \brief Transfer statistics of a data stream
+     * The compression ratio is bytes_sent / wire_bytes_sent, the compression
+     * throughput is bytes_sent / compression_time.
+     */
+    struct statistics {
+        uint64_t bytes_sent; //!< size of sent chunks before compression
+        uint64_t wire_bytes_sent; //!< size of sent chunks on the wire
+        uint64_t bytes_received; //!< size of received chunks after decompression
+        uint64_t wire_bytes_received; //!< size of received chunks on the wire
+        uint64_t chunks_compressed; //!< number of chunks sent compressed
+        uint64_t chunks_incompressible; //!< number of chunks sent raw, as compression did not pay off
+        uint64_t compression_time; //!< time spent compressing chunks in nanoseconds
+        uint64_t decompression_time; //!< time spent decompressing chunks in nanoseconds
+    };
 
     // TODO Accept rvalue reference rather than pointer to socket (requires Boost 1.47)
     /*!
      * \brief Creates a data stream from a connected socket
      * The data stream becomes owner of the socket.
+     * The sockets of the remaining stripes are attached by attach_stripe.
      *
-     * \param[in]  socket   the socket to use for the data stream
+     * \param[in]  socket       the socket to use for the first stripe of the data stream
+     * \param[in]  stripes      number of stripes of the data stream
+     * \param[in]  chunk_size   maximum size of a chunk in bytes
+     * \param[in]  compression  \c true, if outgoing chunks should be compressed
      */
     DataStream(
-            const std::shared_ptr<boost::asio::ip::tcp::socket>& socket);
+            const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
+            size_t stripes = 1,
+            size_t chunk_size = DEFAULT_CHUNK_SIZE,
+            bool compression = false);
     /*!
      * \brief Creates a data stream to the specified remote endpoint
      *
-     * \param socket            a socket associated with a local endpoint
+     * \param sockets           sockets associated with a local endpoint; one socket per stripe
      * \param remote_endpoint   the remote process
+     * \param chunk_size        maximum size of a chunk in bytes
+     * \param compression       \c true, if chunks should be compressed in both directions
      */
     DataStream(
-            const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
-            boost::asio::ip::tcp::endpoint remote_endpoint);
+            const std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>>& sockets,
+            boost::asio::ip::tcp::endpoint remote_endpoint,
+            size_t chunk_size = DEFAULT_CHUNK_SIZE,
+            bool compression = false);
     virtual ~DataStream();
 
     /*!
      * \brief Connects this data stream to its remote process
      * The ID of the local process associated with this data stream is send to
-     * the remote process.
+     * the remote process on every stripe. The remote process adopts the
+     * striping and compression of this data stream.
      *
      * \param[in]  pid  ID of the local process
      * \return the ID of the remote process, or 0 if the connection has been rejected
@@ -103,29 +164,94 @@ public:
 
     void disconnect();
 
+    /*!
+     * \brief Attaches an accepted socket to a stripe of this data stream
+     * Chunks which have already been submitted for this stripe are processed
+     * once the socket is attached.
+     *
+     * \param[in]  stripe   index of the stripe
+     * \param[in]  socket   connected socket of the stripe
+     */
+    void attach_stripe(
+            size_t stripe,
+            const std::shared_ptr<boost::asio::ip::tcp::socket>& socket);
+
     /*!
      * \brief Submits a data receipt for this data stream
+     * The priority must match the priority of the corresponding data sending.
      *
-     * \param[in]  size  number of bytes to receipt
-     * \param[in]  ptr   destination buffer for received bytes
+     * \param[in]  size      number of bytes to receipt
+     * \param[in]  ptr       destination buffer for received bytes
+     * \param[in]  priority  priority of the data receipt
      * \return a handle for the data receipt
      */
     std::shared_ptr<DataReceipt> read(
             size_t size,
-            void *ptr);
+            void *ptr,
+            dcl::DataTransfer::Priority priority = dcl::DataTransfer::Priority::NORMAL);
 
     /*!
      * \brief Submits a data sending for this data stream
      *
-     * \param[in]  size  number of bytes to send
-     * \param[in]  ptr   source buffer for sent bytes
+     * \param[in]  size      number of bytes to send
+     * \param[in]  ptr       source buffer for sent bytes
+     * \param[in]  priority  priority of the data sending
      * \return a handle for the data sending
      */
     std::shared_ptr<DataSending> write(
             size_t size,
-            const void *ptr);
+            const void *ptr,
+            dcl::DataTransfer::Priority priority = dcl::DataTransfer::Priority::NORMAL);
+
+    /*!
+     * \brief Returns the transfer statistics of this data stream
+     */
+    statistics stats() const;
+
+    static const size_t DEFAULT_CHUNK_SIZE = 1024 * 1024; //!< default chunk size: 1 MiB
+
+    static const uint8_t OPTION_COMPRESSION = 0x01; //!< protocol option: compress chunks
 
 private:
+    static const size_t PRIORITIES = 2; //!< number of priority classes
+    static const uint32_t COMPRESSED = 0x80000000; //!< flag for compressed chunks in the priority field of a frame header
+
+    typedef struct {
+        uint32_t priority;
+        uint32_t size;
+    } header_type; //!< frame header of a chunk
+
+    /*!
+     * \brief A single socket of a data stream with its own read and write queues
+     */
+    struct stripe {
+        stripe(
+                const std::shared_ptr<boost::asio::ip::tcp::socket>& socket) :
+                socket(socket), receiving(false), header_received(false),
+                read_compressed(false), sending(false) { }
+
+        // TODO Store socket instance rather than smart pointer
+        std::shared_ptr<boost::asio::ip::tcp::socket> socket; //!< I/O object for remote process; \c nullptr if not yet attached
+
+        bool receiving; //!< \c true, if currently receiving data, otherwise \c false
+        bool header_received; //!< \c true, if the header of the next incoming chunk has been received
+        header_type read_header; //!< header of the next incoming chunk
+        bool read_compressed; //!< \c true, if the next incoming chunk is compressed
+        chunk<DataReceipt> read; //!< chunk that is currently received
+        std::vector<char> read_buffer; //!< buffer for the compressed body of an incoming chunk
+        std::vector<char> staging; //!< buffer for an incoming chunk that has not been matched by a data receipt
+        std::array<readq_type, PRIORITIES> readq; //!< pending data receipts per priority
+        std::array<stagingq_type, PRIORITIES> stagingq; //!< received chunks awaiting a data receipt per priority
+        std::mutex readq_mtx; //!< protects socket, read queues and flags
+
+        bool sending; //!< \c true, if currently sending data, otherwise \c false
+        header_type write_header; //!< header of the chunk that is currently sent
+        chunk<DataSending> write; //!< chunk that is currently sent
+        std::vector<char> write_buffer; //!< buffer for the compressed body of the chunk that is currently sent
+        std::array<writeq_type, PRIORITIES> writeq; //!< pending data sendings per priority
+        std::mutex writeq_mtx; //!< protects socket, write queues and flag
+    };
+
     /* Data streams must be non-copyable */
     DataStream(
             const DataStream&) = delete;
@@ -133,43 +259,113 @@ private:
             const DataStream&) = delete;
 
     /*!
-     * \brief Processes the next data transfer from the read queue.
+     * \brief Returns the number of chunks a data transfer is split into
+     */
+    size_t chunk_count(
+            size_t size) const;
+
+    void submit_read(
+            stripe& s,
+            size_t priority,
+            chunk<DataReceipt>&& read);
+
+    void submit_write(
+            stripe& s,
+            size_t priority,
+            chunk<DataSending>&& write);
+
+    /*!
+     * \brief Decompresses a chunk body
+     *
+     * \param[in]  src      compressed chunk body
+     * \param[out] dst      destination of the decompressed chunk
+     * \param[in]  capacity maximum size of the decompressed chunk
+     * \return the size of the decompressed chunk, or 0 if decompression failed
+     */
+    size_t decompress(
+            const std::vector<char>& src,
+            char *dst,
+            size_t capacity);
+
+    /*!
+     * \brief Completes a data receipt from a staged chunk
+     */
+    static void finish_staged_read(
+            const chunk<DataReceipt>& read,
+            const std::vector<char>& staging);
+
+    /*!
+     * \brief Processes the next chunk from the stripe's read queues.
+     * The frame header of the next incoming chunk is received first in order to
+     * select the read queue. If no data receipt of the chunk's priority has
+     * been submitted yet, the chunk is received into a staging buffer, such
+     * that chunks of other priorities are not blocked by it. Compressed chunks
+     * are received into the stripe's read buffer and decompressed afterwards.
      *
-     * \param[in]  readq    list of incoming data transfers to process
-     *             If \c readq is empty, it is filled with data transfers from the stream's internal read queue
+     * \param[in]  s    the stripe to process
      */
     void start_read(
-            readq_type *readq = new readq_type());
+            stripe& s);
+
+    void handle_read_header(
+            stripe& s,
+            const boost::system::error_code& ec,
+            size_t bytes_transferred);
 
     void handle_read(
-            readq_type *readq,
+            stripe& s,
+            const boost::system::error_code& ec,
+            size_t bytes_transferred);
+
+    void handle_read_compressed(
+            stripe& s,
+            const boost::system::error_code& ec,
+            size_t bytes_transferred);
+
+    void handle_read_staging(
+            stripe& s,
+            size_t priority,
+            bool compressed,
             const boost::system::error_code& ec,
             size_t bytes_transferred);
 
     /*!
-     * \brief Processes the next data transfer from the write queue.
+     * \brief Processes the next chunk from the stripe's write queues.
+     * The chunk is picked from the non-empty write queue of highest priority.
+     * If compression is enabled, the chunk is sent compressed, unless this
+     * saves less than an eighth of its size.
      *
-     * \param[in]  writeq   list of incoming data transfers to process
-     *             If \c writeq is empty, it is filled with data transfers from the stream's internal write queue
+     * \param[in]  s    the stripe to process
      */
     void start_write(
-            writeq_type *writeq = new writeq_type());
+            stripe& s);
 
     void handle_write(
-            writeq_type *writeq,
+            stripe& s,
             const boost::system::error_code& ec,
             size_t bytes_transferred);
 
-    // TODO Store socket instance rather than smart pointer
-    std::shared_ptr<boost::asio::ip::tcp::socket> _socket; //!< I/O object for remote process
     boost::asio::ip::tcp::endpoint _remote_endpoint; //!< remote endpoint of data stream
 
-    bool _receiving; //!< \c true, if currently receiving data, otherwise \c false
-    bool _sending; //!< \c true, if currently sending data, otherwise \c false
-    readq_type _readq; //!< pending data receipts
-    std::mutex _readq_mtx; //!< protects read queue and flag
-    writeq_type _writeq; //!< pending data sendings
-    std::mutex _writeq_mtx; //!< protects write queue and flag
+    std::vector<std::unique_ptr<stripe>> _stripes; //!< stripes of data stream
+    size_t _chunk_size; //!< maximum size of a chunk
+    bool _compression; //!< \c true, if outgoing chunks are compressed
+
+    std::array<size_t, PRIORITIES> _next_read_stripe; //!< stripe of next chunk to receive per priority
+    std::mutex _read_mtx; //!< serializes submission of data receipts
+    std::array<size_t, PRIORITIES> _next_write_stripe; //!< stripe of next chunk to send per priority
+    std::mutex _write_mtx; //!< serializes submission of data sendings
+
+    struct {
+        std::atomic<uint64_t> bytes_sent{0};
+        std::atomic<uint64_t> wire_bytes_sent{0};
+        std::atomic<uint64_t> bytes_received{0};
+        std::atomic<uint64_t> wire_bytes_received{0};
+        std::atomic<uint64_t> chunks_compressed{0};
+        std::atomic<uint64_t> chunks_incompressible{0};
+        std::atomic<uint64_t> compression_time{0};
+        std::atomic<uint64_t> decompression_time{0};
+    } _stats; //!< transfer statistics
 };
 
 } // namespace comm
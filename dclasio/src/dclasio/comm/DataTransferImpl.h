@@ -49,6 +49,7 @@
 
 #include <dcl/util/Clock.h>
 #include <dcl/util/Logger.h>
+#include <dcl/util/Trace.h>
 
 #ifdef __APPLE__
 #include <OpenCL/cl.h>
@@ -76,6 +77,10 @@ namespace comm {
 struct Receive {
     typedef void * pointer_type;
 
+    static const char * traceName() {
+        return "Receive data";
+    }
+
     static void logFinish(
             size_t size,
             double latency,
@@ -91,6 +96,10 @@ struct Receive {
 struct Send {
     typedef const void * pointer_type;
 
+    static const char * traceName() {
+        return "Send data";
+    }
+
     static void logFinish(
             size_t size,
             double latency,
@@ -119,11 +128,19 @@ private:
     }
 
 public:
+    /*!
+     * \brief Creates a data transfer
+     *
+     * \param[in]  size     number of bytes to transfer
+     * \param[in]  ptr      source or destination buffer
+     * \param[in]  chunks   number of chunks the data transfer is split into
+     */
     DataTransferImpl(
-            size_t size, typename Operation::pointer_type ptr) :
+            size_t size, typename Operation::pointer_type ptr,
+            size_t chunks = 1) :
             _size(size), _ptr(ptr),
             _submit(dcl::util::clock.getTime()), _start(0L), _end(0L),
-            _status(CL_SUBMITTED) { }
+            _status(CL_SUBMITTED), _chunks(chunks), _failed(false) { }
 
     void setCallback(
             const std::function<void (cl_int)>& notify) {
@@ -191,25 +208,36 @@ public:
         return _ptr;
     }
 
+    /*!
+     * \brief Signals the start of a chunk of this data transfer
+     * The data transfer is started by its first chunk.
+     */
     void onStart() {
         std::lock_guard<std::mutex> lock(_mutex);
+        if (_status != CL_SUBMITTED) return; // data transfer is already running
         _start = dcl::util::clock.getTime(); // take time stamp
         _status = CL_RUNNING;
         // signal start
         _statusChanged.notify_all();
     }
 
+    /*!
+     * \brief Signals the completion of a chunk of this data transfer
+     * The data transfer is finished by its last chunk.
+     */
     void onFinish(
             const boost::system::error_code& ec,
             size_t bytes_transferred) {
         std::unique_lock<std::mutex> lock(_mutex);
+        if (ec) _failed = true;
+        if (--_chunks > 0) return; // await remaining chunks
         _end = dcl::util::clock.getTime(); // take time stamp
 
         double latency = static_cast<double>(_start - _submit) / 1000000.0;
         double durance = static_cast<double>(_end   - _start) / 1000000000.0;
 
         // TODO Use more specific error codes
-        _status = ec ? CL_IO_ERROR_WWU : CL_SUCCESS;
+        _status = _failed ? CL_IO_ERROR_WWU : CL_SUCCESS;
         // signal completion
         _statusChanged.notify_all();
         lock.unlock();
@@ -218,6 +246,7 @@ public:
 
         double bandwidth = (_size / static_cast<double>(1024 * 1024)) / durance;
         Operation::logFinish(_size, latency, bandwidth);
+        dcl::util::tracer.record(Operation::traceName(), "data", _start, _end, _size);
     }
 
 private:
@@ -229,6 +258,8 @@ private:
 	cl_ulong _end;
 
 	cl_int _status; //!< status of data transfer
+	size_t _chunks; //!< number of unfinished chunks
+	bool _failed; //!< \c true, if any chunk failed, otherwise \c false
 	std::vector<std::function<void (cl_int)>> _callbacks;
 
     mutable std::mutex _mutex;
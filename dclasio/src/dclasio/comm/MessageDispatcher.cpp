@@ -84,7 +84,7 @@ message_queue * MessageDispatcher::create_message_queue(
         const endpoint_type& endpoint) {
     // create socket
     auto socket(std::make_shared<boost::asio::ip::tcp::socket>(_io_service));
-    return add_message_queue(new message_queue(socket, endpoint));
+    return add_message_queue(new message_queue(_io_service, socket, endpoint));
 }
 
 void MessageDispatcher::destroy_message_queue(message_queue *msgq) {
@@ -217,7 +217,14 @@ void MessageDispatcher::handle_approval(
 
     if (approved) {
         // message queue has been approved - keep it
-        auto msgq = add_message_queue(new message_queue(socket, pid));
+        auto msgq = add_message_queue(new message_queue(_io_service, socket, pid));
+
+        /* Notify listeners before signaling approval, such that the process
+         * is known when the remote process starts using the connection, e.g.,
+         * by connecting its data stream. */
+        for (auto listener : listeners) {
+            listener->message_queue_connected(*msgq, process_type, pid);
+        }
 
         *buf << _pid; // signal approval: return own process ID
         boost::asio::write(*socket, boost::asio::buffer(buf->begin(), buf->size()));
@@ -225,10 +232,6 @@ void MessageDispatcher::handle_approval(
                 << "Accepted message queue from process (pid=" << pid << ')'
                 << std::endl;
 
-        for (auto listener : listeners) {
-            listener->message_queue_connected(*msgq, process_type, pid);
-        }
-
         // start reading messages from queue
         start_read_message(*msgq);
     } else {
@@ -244,8 +247,8 @@ void MessageDispatcher::handle_approval(
 void MessageDispatcher::start_read_message(
         message_queue& msgq) {
     msgq.recv_message(
-            [this, &msgq] (message::Message *message, const boost::system::error_code& ec) {
-                    handle_message(msgq, message, ec); });
+            [this, &msgq] (std::unique_ptr<message::Message>&& message, const boost::system::error_code& ec) {
+                    handle_message(msgq, std::move(message), ec); });
 }
 
 /*!
@@ -253,7 +256,7 @@ void MessageDispatcher::start_read_message(
  */
 void MessageDispatcher::handle_message(
         message_queue& msgq,
-        message::Message *message,
+        std::unique_ptr<message::Message> message,
         const boost::system::error_code& ec) {
     if (ec) {
         // TODO Handle errors
@@ -263,14 +266,16 @@ void MessageDispatcher::handle_message(
         }
     } else {
         assert(message && "No message");
+        /* listeners may keep the message for deferred processing */
+        std::shared_ptr<message::Message> shared_message(std::move(message));
         std::unique_lock<std::mutex> lock(_listener_mutex);
         for (auto listener : _message_listeners) {
-            listener->message_received(msgq, *message);
+            listener->message_received(msgq, shared_message);
         }
         lock.unlock();
 
-        // read next message
-        start_read_message(msgq);
+        /* Do not read next message: the message queue keeps on receiving
+         * messages until an error occurs */
     }
 }
 
@@ -139,7 +139,7 @@ private:
      */
     void handle_message(
             message_queue& msgq,
-            message::Message *message,
+            std::unique_ptr<message::Message> message,
             const boost::system::error_code& ec);
 
     /*!
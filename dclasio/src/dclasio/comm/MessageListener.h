@@ -46,6 +46,8 @@
 
 #include <dcl/DCLTypes.h>
 
+#include <memory>
+
 namespace dclasio {
 
 namespace message {
@@ -65,7 +67,7 @@ public:
     virtual ~message_listener() { };
     virtual void message_received(
             message_queue& msgq,
-            const message::Message& message) = 0;
+            const std::shared_ptr<message::Message>& message) = 0;
 };
 
 } /* namespace comm */
@@ -49,9 +49,12 @@
 #include <dcl/DCLTypes.h>
 
 #include <dcl/util/Logger.h>
+#include <dcl/util/Trace.h>
 
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/io_service.hpp>
 #include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/write.hpp>
 
 #include <boost/asio/ip/tcp.hpp>
@@ -59,9 +62,12 @@
 // TODO Replace htonl, ntohl by own, portable implementation
 #include <netinet/in.h>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -70,9 +76,14 @@
 namespace dclasio {
 namespace comm {
 
+const size_t message_queue::DEFAULT_BATCH_SIZE = 16384;
+const std::chrono::microseconds message_queue::DEFAULT_BATCH_DELAY = std::chrono::microseconds(500);
+
 message_queue::message_queue(
+        boost::asio::io_service& io_service,
         const std::shared_ptr<boost::asio::ip::tcp::socket>& socket, dcl::process_id pid) :
-        _socket(socket), _pid(pid) {
+        _socket(socket), _recv_buffer(DEFAULT_RECV_BUFFER_SIZE), _recv_begin(0), _recv_end(0),
+        _batch_timer(io_service), _batch_timer_pending(false), _pid(pid) {
     // TODO Ensure that socket is connected
     _remote_endpoint = _socket->remote_endpoint();
     /* Disable Nagle's algorithm on listening socket
@@ -85,15 +96,23 @@ message_queue::message_queue(
 }
 
 message_queue::message_queue(
+        boost::asio::io_service& io_service,
         const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
         boost::asio::ip::tcp::endpoint remote_endpoint) :
-        _socket(socket), _remote_endpoint(remote_endpoint), _pid(0) {
+        _socket(socket), _remote_endpoint(remote_endpoint),
+        _recv_buffer(DEFAULT_RECV_BUFFER_SIZE), _recv_begin(0), _recv_end(0),
+        _batch_timer(io_service), _batch_timer_pending(false), _pid(0) {
     assert(!socket->is_open()); // socket must not be connect
 }
 
 message_queue::message_queue(
         message_queue&& other) : _socket(std::move(other._socket)),
-                _remote_endpoint(other._remote_endpoint), _pid(other._pid) {
+                _remote_endpoint(other._remote_endpoint),
+                _recv_buffer(std::move(other._recv_buffer)),
+                _recv_begin(other._recv_begin), _recv_end(other._recv_end),
+                _batch(std::move(other._batch)),
+                _batch_timer(std::move(other._batch_timer)),
+                _batch_timer_pending(other._batch_timer_pending), _pid(other._pid) {
 }
 
 message_queue::~message_queue() {
@@ -140,94 +159,188 @@ void message_queue::disconnect() {
 
 void message_queue::send_message(
         const message::Message& message) {
-#if defined(USE_SEND_BUFFER)
+    dcl::util::TraceSpan span("Send message", "message", message.get_type());
     std::lock_guard<std::recursive_mutex> lock(_mutex);
 
-    _send_buffer.resize(0);
-    message.pack(_send_buffer);
-    _send_header.size = htonl(_send_buffer.size());
-    _send_header.type = htonl(message.get_type());
-    // send message header and body in one go
-    boost::asio::write(*_socket, std::vector<boost::asio::const_buffer>( {
-            boost::asio::const_buffer(&_send_header, sizeof(header_type)),
-            boost::asio::const_buffer(_send_buffer.begin(), _send_buffer.size()) }));
+    dcl::ByteBuffer buf;
+    pack_message(message, buf);
+    write_message(message, buf); // also sends batched messages
+}
+
+void message_queue::post_message(
+        const message::Message& message) {
+    dcl::util::TraceSpan span("Post message", "message", message.get_type());
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
 
-    dcl::util::Logger << dcl::util::Verbose
-            << "Sent message (size=" << _send_buffer.size() << ", type=" << message.get_type() << ')'
-            << std::endl;
-#else
-    // send message length and type (4 + 4 Byte), followed by message body
     dcl::ByteBuffer buf;
-    message.pack(buf); // pack message to determine length
-    header_type header({ htonl(buf.size()), htonl(message.get_type()) });
+    pack_message(message, buf);
+
+    if (sizeof(header_type) + buf.size() >= DEFAULT_BATCH_SIZE) {
+        // do not copy large messages into batch
+        write_message(message, buf);
+        return;
+    }
+
+    append_message(message, buf);
 
+    if (_batch.size() >= DEFAULT_BATCH_SIZE) {
+        write_batch();
+    } else if (!_batch_timer_pending) {
+        // flush batch after delay
+        _batch_timer.expires_from_now(DEFAULT_BATCH_DELAY);
+        _batch_timer.async_wait([this](const boost::system::error_code& ec){
+                handle_batch_timeout(ec); });
+        _batch_timer_pending = true;
+    }
+}
+
+void message_queue::flush() {
     std::lock_guard<std::recursive_mutex> lock(_mutex);
-    // send message header and body in one go
-    boost::asio::write(*_socket, std::vector<boost::asio::const_buffer>( {
-            boost::asio::const_buffer(&header, sizeof(header_type)),
-            boost::asio::const_buffer(buf.begin(), buf.size()) }));
+    if (!_batch.empty()) write_batch();
+}
+
+void message_queue::pack_message(
+        const message::Message& message,
+        dcl::ByteBuffer& buf) {
+    // reference large message fields rather than copying them
+    buf.set_gather_threshold(GATHER_THRESHOLD);
+    message.pack(buf);
+}
+
+void message_queue::write_message(
+        const message::Message& message,
+        const dcl::ByteBuffer& buf) {
+    header_type header({ htonl(buf.size()), htonl(message.get_type()) });
+
+    buf.segments(_segments);
+    _write_buffers.clear();
+
+    // send batched messages, message header and body in one go
+    if (!_batch.empty()) {
+        _write_buffers.push_back(boost::asio::buffer(_batch.data(), _batch.size()));
+    }
+    _write_buffers.push_back(boost::asio::const_buffer(&header, sizeof(header_type)));
+    for (const auto& segment : _segments) {
+        _write_buffers.push_back(boost::asio::const_buffer(segment.first, segment.second));
+    }
+    boost::asio::write(*_socket, _write_buffers);
 
     dcl::util::Logger << dcl::util::Verbose
-            << "Sent message (size=" << buf.size() << ", type=" << message.get_type() << ')'
+            << "Sent message (size=" << buf.size() << ", type=" << message.get_type()
+            << ", #segments=" << _segments.size() << ')'
             << std::endl;
-#endif
-}
-
-void message_queue::start_read_header() {
-    // read header
-    boost::asio::async_read(*_socket,
-            boost::asio::buffer(&_message_header, sizeof(header_type)),
-            [this](const boost::system::error_code& ec, size_t bytes_transferred){
-                    handle_header(ec, bytes_transferred); });
-}
-
-void message_queue::handle_header(
-        const boost::system::error_code& ec,
-        size_t bytes_transferred) {
-    if (ec) {
-        dcl::util::Logger << dcl::util::Error
-                << "Could not read message header: " << ec.message()
-                << std::endl;
-        // FIXME Report error via MessageHandler
-    } else {
-        // extract message size and type from header and start reading message body
-        start_read_message(ntohl(_message_header.size));
+
+    if (!_batch.empty()) {
+        clear_batch();
+    }
+}
+
+void message_queue::append_message(
+        const message::Message& message,
+        const dcl::ByteBuffer& buf) {
+    header_type header({ htonl(buf.size()), htonl(message.get_type()) });
+
+    // append message header and body to batch
+    auto header_begin = reinterpret_cast<const char *>(&header);
+    _batch.insert(std::end(_batch), header_begin, header_begin + sizeof(header_type));
+    buf.segments(_segments);
+    for (const auto& segment : _segments) {
+        _batch.insert(std::end(_batch), segment.first, segment.first + segment.second);
     }
+
+    dcl::util::Logger << dcl::util::Verbose
+            << "Batched message (size=" << buf.size() << ", type=" << message.get_type() << ')'
+            << std::endl;
 }
 
-void message_queue::start_read_message(
-        message::Message::size_type size) {
+void message_queue::write_batch() {
+    // send all batched messages in one go
+    boost::asio::write(*_socket, boost::asio::buffer(_batch.data(), _batch.size()));
+
     dcl::util::Logger << dcl::util::Verbose
-            << "Incoming message (size=" << size << ')' << std::endl;
-    _message_buffer.resize(size);
-    // read message
-    boost::asio::async_read(*_socket,
-            boost::asio::buffer(_message_buffer.begin(), _message_buffer.size()),
-            [this](const boost::system::error_code& ec, size_t bytes_transferred){
-                    handle_message(ec, bytes_transferred); });
-}
-
-void message_queue::handle_message(
-        const boost::system::error_code& ec,
-        size_t bytes_transferred) {
+            << "Sent message batch (size=" << _batch.size() << ')'
+            << std::endl;
+
+    clear_batch();
+}
+
+void message_queue::clear_batch() {
+    _batch.clear(); // keep capacity for next batch
+    if (_batch_timer_pending) {
+        _batch_timer.cancel();
+        _batch_timer_pending = false;
+    }
+}
+
+void message_queue::handle_batch_timeout(
+        const boost::system::error_code& ec) {
+    if (ec == boost::asio::error::operation_aborted) {
+        return; // batch has already been sent
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    /* The timer may have been restarted after this handler has been
+     * scheduled */
+    if (_batch_timer_pending
+            && _batch_timer.expires_at() <= boost::asio::steady_timer::clock_type::now()) {
+        _batch_timer_pending = false;
+        if (!_batch.empty()) {
+            try {
+                write_batch();
+            } catch (const boost::system::system_error& err) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Could not send message batch: " << err.what()
+                        << std::endl;
+            }
+        }
+    }
+}
+
+std::unique_ptr<message::Message> message_queue::decode_message() {
     std::unique_ptr<message::Message> message;
+    size_t available = _recv_end - _recv_begin;
+
+    if (available >= sizeof(header_type)) {
+        header_type header;
+        std::memcpy(&header, _recv_buffer.data() + _recv_begin, sizeof(header_type));
+        size_t size = ntohl(header.size);
+        size_t frame_size = sizeof(header_type) + size;
+
+        if (available >= frame_size) {
+            /* unpack message body directly from receive buffer; it is not
+             * modified until the message has been unpacked */
+            auto body = _recv_buffer.data() + _recv_begin + sizeof(header_type);
+            dcl::ByteBuffer buf(dcl::ByteBuffer::view(size, body));
+            _recv_begin += frame_size;
+
+            dcl::util::TraceSpan span("Receive message", "message", ntohl(header.type));
+
+            // create message of type header.type from buf
+            message.reset(message::createMessage(ntohl(header.type)));
+            dcl::util::Logger << dcl::util::Debug
+                    << "Received message (size=" << size
+                    << ", type=" << message->get_type() << ')'
+                    << std::endl;
+
+            message->unpack(buf); // restore message from buffer
+            return message;
+        }
+
+        // enlarge receive buffer, if it cannot hold the incomplete message
+        if (frame_size > _recv_buffer.size()) {
+            _recv_buffer.resize(frame_size);
+        }
+    }
 
-    if (ec) {
-        dcl::util::Logger << dcl::util::Error
-                << "Could not read message: " << ec.message()
-                << std::endl;
-    } else {
-        // create message of type _message_header.type from _message_buffer
-        message.reset(message::createMessage(ntohl(_message_header.type)));
-        dcl::util::Logger << dcl::util::Debug
-                << "Received message (size=" << _message_buffer.size()
-                << ", type=" << message->get_type() << ')'
-                << std::endl;
-
-        message->unpack(_message_buffer); // restore message from buffer
+    // move incomplete message to beginning of receive buffer
+    if (_recv_begin > 0) {
+        std::copy(_recv_buffer.data() + _recv_begin, _recv_buffer.data() + _recv_end,
+                _recv_buffer.data());
+        _recv_end -= _recv_begin;
+        _recv_begin = 0;
     }
 
-    // FIXME Return message or report error via MessageHandler
+    return message;
 }
 
 } /* namespace comm */
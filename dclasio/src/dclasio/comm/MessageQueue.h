@@ -54,18 +54,27 @@
 #if !defined(NO_TEMPLATES)
 #include <dcl/util/Logger.h>
 
-#include <boost/asio/read.hpp>
+#include <boost/asio/buffer.hpp>
 #endif
 
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/steady_timer.hpp>
+
 #include <boost/asio/ip/tcp.hpp>
 
 #include <boost/system/error_code.hpp>
 
+// TODO Replace htonl, ntohl by own, portable implementation
+#include <netinet/in.h>
+
+#include <chrono>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace dclasio {
 
@@ -81,20 +90,38 @@ namespace comm {
 
 class message_queue {
 public:
+    /*!
+     * \brief Maximum number of bytes of batched messages.
+     *
+     * A batch is flushed when it reaches this size.
+     */
+    static const size_t DEFAULT_BATCH_SIZE;
+    /*!
+     * \brief Maximum delay of batched messages.
+     *
+     * A batch is flushed when its first message has been delayed for this time.
+     */
+    static const std::chrono::microseconds DEFAULT_BATCH_DELAY;
+
     /*!
      * \brief Creates a message queue from a connected socket
-     * \param[in]  socket   the socket
+     * \param[in]  io_service   the I/O service which is associated with the socket
+     * \param[in]  socket       the socket
+     * \param[in]  pid          ID of the remote process
      */
     message_queue(
+            boost::asio::io_service& io_service,
             const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
             dcl::process_id pid);
     /*!
      * \brief Creates a message queue to the specified remote endpoint
      *
+     * \param io_service        the I/O service which is associated with the socket
      * \param socket            a socket associated with a local endpoint
      * \param remote_endpoint   the remote process
      */
     message_queue(
+            boost::asio::io_service& io_service,
             const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
             boost::asio::ip::tcp::endpoint remote_endpoint);
     message_queue(
@@ -103,6 +130,8 @@ public:
 
     dcl::process_id get_process_id() const { return _pid; }
 
+    const boost::asio::ip::tcp::endpoint& get_remote_endpoint() const { return _remote_endpoint; }
+
     /*!
      * \brief Connects this message queue to a remote process
      * Moreover, the ID of the local process associated with this message queue is
@@ -118,15 +147,52 @@ public:
 
     void disconnect();
 
+    /*!
+     * \brief Sends a message immediately
+     *
+     * Batched messages are sent before the message within the same write
+     * operation.
+     *
+     * \param[in]  message  the message to send
+     */
     void send_message(
             const message::Message& message);
 
+    /*!
+     * \brief Adds a message to this message queue's batch of outgoing messages
+     *
+     * The batch is sent in a single write operation, when it exceeds
+     * DEFAULT_BATCH_SIZE, when DEFAULT_BATCH_DELAY has expired, or when the
+     * next message is sent using send_message.
+     * Hence, this method must only be used for messages which are not awaited
+     * by the caller.
+     *
+     * \param[in]  message  the message to send
+     */
+    void post_message(
+            const message::Message& message);
+
+    /*!
+     * \brief Sends all batched messages
+     */
+    void flush();
+
+    /*!
+     * \brief Starts receiving messages from this message queue
+     *
+     * The handler is called for each received message until an error occurs.
+     * Multiple messages are decoded from a single read operation, if the
+     * remote process has batched them.
+     *
+     * \param[in]  handler  a handler which is called for each received message;
+     *             the handler takes ownership of the message
+     */
     template<typename MessageHandler>
     void recv_message(
             // TODO Provide message location as input
 //            message::Message *& message,
             MessageHandler handler) {
-        start_read_header(handler);
+        start_read(handler);
     }
 
 private:
@@ -135,94 +201,116 @@ private:
         message::Message::class_type type;
     } header_type; //!< message header comprising size of message body and message type ID
 
-    void start_read_header();
-    void handle_header(
-            const boost::system::error_code& ec,
-            size_t bytes_transferred);
-    void start_read_message(
-            message::Message::size_type size);
-    void handle_message(
-            const boost::system::error_code& ec,
-            size_t bytes_transferred);
+    static const size_t DEFAULT_RECV_BUFFER_SIZE = 65536; //!< initial size of receive buffer
+    static const dcl::ByteBuffer::size_type GATHER_THRESHOLD = 256; //!< minimum size of message fields which are sent without copying
+
+    /*!
+     * \brief Packs a message into a buffer
+     *
+     * Large message fields are only referenced by the buffer, such that the
+     * message must not be modified until the buffer has been sent.
+     *
+     * \param[in]  message  the message to pack
+     * \param[out] buf      the buffer to pack the message into
+     */
+    void pack_message(
+            const message::Message& message,
+            dcl::ByteBuffer& buf);
+    /*!
+     * \brief Sends all batched messages and a packed message
+     *
+     * The message is sent from the buffer's segments without copying it.
+     * The caller must hold this message queue's mutex.
+     *
+     * \param[in]  message  the message
+     * \param[in]  buf      the packed message
+     */
+    void write_message(
+            const message::Message& message,
+            const dcl::ByteBuffer& buf);
+    /*!
+     * \brief Appends a packed message to the batch of outgoing messages
+     *
+     * The caller must hold this message queue's mutex.
+     *
+     * \param[in]  message  the message to append
+     * \param[in]  buf      the packed message
+     */
+    void append_message(
+            const message::Message& message,
+            const dcl::ByteBuffer& buf);
+    /*!
+     * \brief Sends all batched messages
+     *
+     * The caller must hold this message queue's mutex.
+     */
+    void write_batch();
+    void clear_batch();
+    void handle_batch_timeout(
+            const boost::system::error_code& ec);
 
     template<typename MessageHandler>
-    void start_read_header(
+    void start_read(
             MessageHandler handler) {
-        // read header
-        boost::asio::async_read(*_socket,
-                boost::asio::buffer(&_message_header, sizeof(header_type)),
+        // read as many bytes as available, i.e., possibly multiple messages
+        _socket->async_read_some(
+                boost::asio::buffer(_recv_buffer.data() + _recv_end, _recv_buffer.size() - _recv_end),
                 [this, handler](const boost::system::error_code& ec, size_t bytes_transferred){
-                        handle_header(ec, bytes_transferred, handler); });
+                        handle_read(ec, bytes_transferred, handler); });
     }
 
     template<typename MessageHandler>
-    void handle_header(
+    void handle_read(
             const boost::system::error_code& ec,
             size_t bytes_transferred,
             MessageHandler handler) {
         if (ec) {
             dcl::util::Logger << dcl::util::Error
-                    << "Could not read message header: " << ec.message()
+                    << "Could not read message: " << ec.message()
                     << std::endl;
             // FIXME Report error asynchronously
-            handler(nullptr, ec);
-        } else {
-            // extract message size and type from header and start reading message body
-            start_read_message(ntohl(_message_header.size), handler);
+            handler(std::unique_ptr<message::Message>(), ec);
+            return;
         }
-    }
 
-    template<typename MessageHandler>
-    void start_read_message(
-            message::Message::size_type size,
-            MessageHandler handler) {
-        dcl::util::Logger << dcl::util::Verbose
-                << "Incoming message (size=" << size << ')' << std::endl;
-        _message_buffer.resize(size);
-        // read message
-        boost::asio::async_read(*_socket,
-                boost::asio::buffer(_message_buffer.begin(), _message_buffer.size()),
-                [this, handler](const boost::system::error_code& ec, size_t bytes_transferred){
-                        handle_message(ec, bytes_transferred, handler); });
-    }
+        _recv_end += bytes_transferred;
 
-    template<typename MessageHandler>
-    void handle_message(
-            const boost::system::error_code& ec,
-            size_t bytes_transferred,
-            MessageHandler handler) {
+        // decode all complete messages from receive buffer
         std::unique_ptr<message::Message> message;
-
-        if (ec) {
-            dcl::util::Logger << dcl::util::Error
-                    << "Could not read message: " << ec.message()
-                    << std::endl;
-        } else {
-            // create message of type _message_header.type from _message_buffer
-            message.reset(message::createMessage(ntohl(_message_header.type)));
-            dcl::util::Logger << dcl::util::Debug
-                    << "Received message (size=" << _message_buffer.size()
-                    << ", type=" << message->get_type() << ')'
-                    << std::endl;
-
-            message->unpack(_message_buffer); // restore message from buffer
+        while ((message = decode_message())) {
+            handler(std::move(message), ec);
         }
 
-        /* FIXME Return message and report error asynchronously
-        _socket->get_io_service().post([handler, message, ec] () { handler(message, ec); });
-         */
-        handler(message.get(), ec);
+        start_read(handler);
     }
 
+    /*!
+     * \brief Decodes the next complete message from the receive buffer
+     *
+     * If the receive buffer does not contain a complete message, its content
+     * is moved to the beginning of the buffer and the buffer is enlarged, if
+     * it cannot hold the incomplete message.
+     *
+     * \return the decoded message, or \c nullptr if no complete message is available
+     */
+    std::unique_ptr<message::Message> decode_message();
+
     // TODO Store socket instance rather than smart pointer to instance
     std::shared_ptr<boost::asio::ip::tcp::socket> _socket; //!< I/O object for remote process
     boost::asio::ip::tcp::endpoint _remote_endpoint; //!< remote endpoint of message queue
-    header_type _message_header;
-    dcl::ByteBuffer _message_buffer;
-#if defined(USE_SEND_BUFFER)
-    header_type _send_header;
-    dcl::ByteBuffer _send_buffer;
-#endif
+
+    std::vector<char> _recv_buffer; //!< buffer for incoming messages
+    size_t _recv_begin; //!< begin of undecoded bytes in receive buffer
+    size_t _recv_end; //!< end of undecoded bytes in receive buffer
+
+    std::vector<char> _batch; //!< batched outgoing messages including headers
+    /* Scratch lists for sending messages; they are reused in order to avoid
+     * heap allocations */
+    std::vector<dcl::ByteBuffer::segment_type> _segments;
+    std::vector<boost::asio::const_buffer> _write_buffers;
+    boost::asio::steady_timer _batch_timer; //!< timer for flushing batched messages
+    bool _batch_timer_pending; //!< true, if the batch timer has been started
+
     /* FIXME Remove process ID from message_queue
      * This is a hack to avoid a message_queue-to-process_id lookup table in MessageDispatcher */
     dcl::process_id _pid;
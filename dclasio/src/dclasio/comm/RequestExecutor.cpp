@@ -0,0 +1,294 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+
+/*!
+ * \file RequestExecutor.cpp
+ *
+ * \date 2026-10-15
+ * \author dmanam
+ */
+
+#include "RequestExecutor.h"
+
+#include <dcl/DCLTypes.h>
+
+#include <dcl/util/Logger.h>
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+
+namespace dclasio {
+
+namespace comm {
+
+RequestExecutor::RequestExecutor(unsigned int numThreads) :
+        _stopped(false) {
+    if (numThreads == 0) {
+        numThreads = std::thread::hardware_concurrency();
+        if (numThreads == 0) numThreads = 1;
+    }
+
+    _workers.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i) {
+        _workers.push_back(std::thread(&RequestExecutor::run, this));
+    }
+
+    dcl::util::Logger << dcl::util::Info
+            << "Started request executor (#threads=" << numThreads << ')'
+            << std::endl;
+}
+
+RequestExecutor::~RequestExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopped = true;
+        _strandReady.notify_all();
+    }
+
+    for (auto& worker : _workers) {
+        worker.join();
+    }
+}
+
+void RequestExecutor::execute(
+        const strand_id& strand,
+        const task_type& task) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    submit(std::vector<strand_id>(1, strand), task);
+}
+
+void RequestExecutor::executeAfter(
+        const std::vector<strand_id>& strands,
+        const std::vector<strand_id>& predecessors,
+        const task_type& task) {
+    assert(!strands.empty());
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<strand_id> joint(strands);
+
+    for (const auto& predecessor : predecessors) {
+        if (_strands.find(predecessor) != std::end(_strands)) {
+            joint.push_back(predecessor);
+        }
+    }
+
+    submit(joint, task);
+}
+
+void RequestExecutor::executeBarrier(
+        const std::vector<strand_id>& strands,
+        const task_type& task) {
+    assert(!strands.empty());
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<strand_id> barrier(strands);
+    dcl::process_id pid = strands.front().first;
+
+    /* strands are ordered by process ID */
+    auto first = _strands.lower_bound(strand_id(pid, 0));
+    for (auto i = first; i != std::end(_strands) && i->first.first == pid; ++i) {
+        barrier.push_back(i->first);
+    }
+
+    submit(barrier, task);
+}
+
+void RequestExecutor::submit(
+        std::vector<strand_id> strands,
+        const task_type& task) {
+    assert(!strands.empty());
+
+    /* discard tasks of cancelled processes */
+    if (_cancelled.find(strands.front().first) != std::end(_cancelled)) return;
+
+    std::sort(std::begin(strands), std::end(strands));
+    strands.erase(std::unique(std::begin(strands), std::end(strands)),
+            std::end(strands));
+
+    auto entry = std::make_shared<Task>(task, strands);
+    for (const auto& strand : strands) {
+        assert(strand.first == strands.front().first); // strands must belong to the same process
+
+        Strand& s = _strands[strand];
+        s.tasks.push_back(entry);
+        if (!s.scheduled) {
+            s.scheduled = true;
+            _readyStrands.push_back(strand);
+            _strandReady.notify_one();
+        }
+    }
+}
+
+void RequestExecutor::cancel(
+        dcl::process_id pid,
+        const task_type& onCancelled) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        /* strands are ordered by process ID */
+        auto i = _strands.lower_bound(strand_id(pid, 0));
+        while (i != std::end(_strands) && i->first.first == pid) {
+            i->second.tasks.clear();
+            if (i->second.parked) {
+                /* parked strands are not executed by any worker and would
+                 * never be resumed, as the tasks they wait for are discarded */
+                i = _strands.erase(i);
+            } else {
+                ++i;
+            }
+        }
+
+        if (hasStrands(pid)) {
+            /* strands of process are still scheduled or executed; the last
+             * worker leaving them calls the completion handler */
+            _cancelled[pid] = onCancelled;
+            return;
+        }
+    }
+
+    onCancelled();
+}
+
+bool RequestExecutor::hasStrands(
+        dcl::process_id pid) const {
+    auto i = _strands.lower_bound(strand_id(pid, 0));
+    return (i != std::end(_strands) && i->first.first == pid);
+}
+
+void RequestExecutor::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    for (;;) {
+        _strandReady.wait(lock, [this] {
+            return (_stopped || !_readyStrands.empty()); });
+        if (_stopped) break;
+
+        strand_id strand = _readyStrands.front();
+        _readyStrands.pop_front();
+
+        auto i = _strands.find(strand);
+        if (!i->second.tasks.empty()) {
+            std::shared_ptr<Task> task(std::move(i->second.tasks.front()));
+            i->second.tasks.pop_front();
+
+            if (--task->pending > 0) {
+                /* The task is executed by the worker of the last strand which
+                 * reaches it. Until then, this strand is parked, i.e., it
+                 * remains scheduled but is not executed. */
+                i->second.parked = true;
+                continue;
+            }
+
+            /* other workers must not execute this strand meanwhile, as it is
+             * still marked as scheduled */
+            lock.unlock();
+            try {
+                task->function();
+            } catch (const std::exception& err) {
+                dcl::util::Logger << dcl::util::Error
+                        << "Request execution failed: " << err.what()
+                        << std::endl;
+            } catch (...) {
+                /* Some exceptions (e.g., dcl::CLError) are not derived from
+                 * std::exception. The strand must be released anyway. */
+                dcl::util::Logger << dcl::util::Error
+                        << "Request execution failed: unknown error"
+                        << std::endl;
+            }
+            lock.lock();
+
+            /* resume the other strands of the task */
+            for (const auto& other : task->strands) {
+                if (other == strand) continue;
+                auto j = _strands.find(other);
+                /* parked strands are removed when their process is cancelled */
+                if (j == std::end(_strands)) continue;
+                j->second.parked = false;
+                leave(other, lock);
+            }
+        }
+
+        leave(strand, lock);
+    }
+}
+
+void RequestExecutor::leave(
+        const strand_id& strand,
+        std::unique_lock<std::mutex>& lock) {
+    /* strands may have been modified while executing a task */
+    auto i = _strands.find(strand);
+    if (i == std::end(_strands)) return;
+
+    if (!i->second.tasks.empty()) {
+        /* reschedule strand behind other ready strands */
+        _readyStrands.push_back(strand);
+        _strandReady.notify_one();
+        return;
+    }
+
+    _strands.erase(i);
+
+    auto cancelled = _cancelled.find(strand.first);
+    if (cancelled != std::end(_cancelled) && !hasStrands(strand.first)) {
+        /* this worker left the last strand of a cancelled process */
+        task_type onCancelled(std::move(cancelled->second));
+        _cancelled.erase(cancelled);
+
+        lock.unlock();
+        try {
+            onCancelled();
+        } catch (const std::exception& err) {
+            dcl::util::Logger << dcl::util::Error
+                    << "Cancellation failed: " << err.what()
+                    << std::endl;
+        } catch (...) {
+            dcl::util::Logger << dcl::util::Error
+                    << "Cancellation failed: unknown error"
+                    << std::endl;
+        }
+        lock.lock();
+    }
+}
+
+} /* namespace comm */
+
+} /* namespace dclasio */
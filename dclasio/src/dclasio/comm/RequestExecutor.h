@@ -0,0 +1,215 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+
+/*!
+ * \file RequestExecutor.h
+ *
+ * \date 2026-10-15
+ * \author dmanam
+ */
+
+#ifndef REQUESTEXECUTOR_H_
+#define REQUESTEXECUTOR_H_
+
+#include <dcl/DCLTypes.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dclasio {
+
+namespace comm {
+
+/*!
+ * \brief An executor which runs requests on a pool of worker threads.
+ *
+ * Requests are submitted to strands. Requests of the same strand are executed
+ * one at a time in the order of submission, while requests of different
+ * strands are executed concurrently.
+ * A strand is identified by the ID of the process which issued the requests
+ * and the ID of an object (e.g., a command queue) the requests refer to.
+ * A request may be submitted to several strands of a process. It is executed
+ * once, when all of these strands have reached it.
+ */
+class RequestExecutor {
+public:
+    typedef std::pair<dcl::process_id, dcl::object_id> strand_id;
+    typedef std::function<void ()> task_type;
+
+    /*!
+     * \brief Creates an executor and starts its worker threads.
+     *
+     * \param[in]  numThreads   the number of worker threads;
+     *             if 0, one thread per hardware thread is created
+     */
+    RequestExecutor(
+            unsigned int numThreads = 0);
+    /*!
+     * \brief Discards pending requests and joins all worker threads.
+     */
+    virtual ~RequestExecutor();
+
+    /*!
+     * \brief Submits a task to a strand.
+     *
+     * \param[in]  strand   the strand to execute the task on
+     * \param[in]  task     the task
+     */
+    void execute(
+            const strand_id&    strand,
+            const task_type&    task);
+
+    /*!
+     * \brief Submits a task to one or more strands of a process, which is executed after the tasks which have been submitted to other strands before.
+     *
+     * The task is executed when all tasks which have been submitted to the
+     * strands and predecessors before have been executed. Only predecessors
+     * with pending or running tasks are considered. Tasks which are submitted
+     * to the strands afterwards are executed after the task.
+     *
+     * \param[in]  strands      the strands to execute the task on
+     * \param[in]  predecessors the strands whose current tasks must be executed before
+     * \param[in]  task         the task
+     */
+    void executeAfter(
+            const std::vector<strand_id>&   strands,
+            const std::vector<strand_id>&   predecessors,
+            const task_type&                task);
+
+    /*!
+     * \brief Submits a task to several strands of a process, which is executed after all tasks of the process which have been submitted before.
+     *
+     * All strands of the process with pending or running tasks are
+     * predecessors of the task.
+     *
+     * \param[in]  strands  the strands to execute the task on
+     * \param[in]  task     the task
+     */
+    void executeBarrier(
+            const std::vector<strand_id>&   strands,
+            const task_type&                task);
+
+    /*!
+     * \brief Discards the pending tasks of all strands of a process.
+     *
+     * This method does not block. When the tasks of the process that are
+     * currently executed have finished, the completion handler is called by
+     * the last worker thread leaving a strand of the process, or by the
+     * calling thread, if no task of the process is executed. Until then,
+     * tasks which are submitted for the process are discarded as well.
+     *
+     * \param[in]  pid         the process ID
+     * \param[in]  onCancelled the completion handler
+     */
+    void cancel(
+            dcl::process_id     pid,
+            const task_type&    onCancelled);
+
+private:
+    /*!
+     * \brief A task which has been submitted to one or more strands
+     */
+    struct Task {
+        Task(
+                const task_type&                function,
+                const std::vector<strand_id>&   strands) :
+            function(function), strands(strands), pending(strands.size()) { }
+
+        task_type function;
+        std::vector<strand_id> strands; //!< strands the task has been submitted to
+        size_t pending; //!< number of strands which have not reached the task yet
+    };
+
+    struct Strand {
+        Strand() : scheduled(false), parked(false) { }
+
+        std::deque<std::shared_ptr<Task>> tasks;
+        bool scheduled; //!< true, if the strand is in the ready list, executed by a worker, or parked
+        bool parked; //!< true, if the strand waits for other strands to reach a task
+    };
+
+    void run();
+
+    /*!
+     * \brief Submits a task to the specified strands.
+     *
+     * The executor's mutex must be locked by the caller.
+     */
+    void submit(
+            std::vector<strand_id>  strands,
+            const task_type&        task);
+
+    /*!
+     * \brief Reschedules a strand, or removes it if it has no more tasks.
+     *
+     * The executor's mutex must be locked by the caller. It is unlocked
+     * temporarily, if the completion handler of a cancelled process is called.
+     */
+    void leave(
+            const strand_id&                strand,
+            std::unique_lock<std::mutex>&   lock);
+
+    /*!
+     * \brief Checks if a process has strands with pending or running tasks.
+     *
+     * The executor's mutex must be locked by the caller.
+     */
+    bool hasStrands(
+            dcl::process_id pid) const;
+
+    std::map<strand_id, Strand> _strands; //!< strands with pending or running tasks
+    std::deque<strand_id> _readyStrands;  //!< strands waiting for a worker thread
+    std::map<dcl::process_id, task_type> _cancelled; //!< cancelled processes and their completion handlers
+
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _strandReady; //!< condition: strand added to ready list
+    bool _stopped;
+};
+
+} /* namespace comm */
+
+} /* namespace dclasio */
+
+#endif /* REQUESTEXECUTOR_H_ */
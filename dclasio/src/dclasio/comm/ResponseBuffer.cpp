@@ -50,11 +50,9 @@
 
 #include <condition_variable>
 #include <cstddef>
-#include <iterator>
 #include <memory>
 #include <mutex>
 #include <utility>
-#include <vector>
 
 namespace dclasio {
 
@@ -62,8 +60,7 @@ namespace comm {
 
 ResponseBuffer::ResponseBuffer(size_t size) :
 	_interrupt(false) {
-    _responses.resize(size);
-    _tail = _head = std::begin(_responses);
+    _slots.reserve(size);
 }
 
 ResponseBuffer::~ResponseBuffer() {
@@ -72,89 +69,67 @@ ResponseBuffer::~ResponseBuffer() {
 void ResponseBuffer::put(std::unique_ptr<message::Response>&& response) {
 	std::lock_guard<std::mutex> lock(_mutex);
 
-	while (!_interrupt && !insert(std::move(response))) {
-		_responseRemoved.wait(_mutex);
+	auto requestId = response->get_request_id();
+	if (_expired.erase(requestId)) {
+	    /* nobody is waiting for this response anymore */
+	    return;
 	}
-	if (_interrupt) throw dcl::ThreadInterrupted();
+
+	/* create slot if response is received before a thread waits for it */
+	Slot& slot = _slots[requestId];
+	slot.response = std::move(response);
+	slot.completed.notify_one();
 }
 
 std::unique_ptr<message::Response> ResponseBuffer::tryGet(const message::Request& request) {
 	std::lock_guard<std::mutex> lock(_mutex);
-	return remove(request);
+	std::unique_ptr<message::Response> response;
+
+	auto i = _slots.find(request.id);
+	if (i != std::end(_slots) && i->second.response) {
+	    response = std::move(i->second.response);
+	    _slots.erase(i);
+	}
+
+	return response;
 }
 
 std::unique_ptr<message::Response> ResponseBuffer::get(const message::Request& request) {
 	std::lock_guard<std::mutex> lock(_mutex);
-	std::unique_ptr<message::Response> response;
+	Slot& slot = _slots[request.id];
+	slot.waiting = true;
 
-	while (!_interrupt && !(response = remove(request))) {
-		_responseAdded.wait(_mutex);
+	while (!_interrupt && !slot.response) {
+		slot.completed.wait(_mutex);
 	};
 	if (_interrupt) throw dcl::ThreadInterrupted();
 
+	std::unique_ptr<message::Response> response(std::move(slot.response));
+	_slots.erase(request.id);
+
 	return response;
 }
 
 void ResponseBuffer::interrupt() {
 	std::lock_guard<std::mutex> lock(_mutex);
 	_interrupt = true;
-	_responseAdded.notify_all();
-	_responseRemoved.notify_all();
+	for (auto& slot : _slots) {
+	    slot.second.completed.notify_all();
+	}
 }
 
 void ResponseBuffer::clear() {
 	std::lock_guard<std::mutex> lock(_mutex);
 
-	_responses.clear();
-	_tail = _head = std::begin(_responses);
-
-    _responseRemoved.notify_all();
-}
-
-bool ResponseBuffer::insert(std::unique_ptr<message::Response>&& response) {
-    std::vector<std::unique_ptr<message::Response>>::iterator i = _tail;
-
-    do {
-    	std::vector<std::unique_ptr<message::Response>>::iterator entry = i;
-
-        /* next buffer position */
-    	if (++i == std::end(_responses)) {
-    		i = std::begin(_responses);
-    	}
-
-        if (!*entry) {
-            *entry = std::move(response); /* move response into buffer */
-            _tail = i;                    /* remember next buffer position for subsequent insert operation */
-            _responseAdded.notify_all();
-            break;
-        }
-    } while (i != _tail); /* only run through buffer once */
-
-    return (response == nullptr);
-}
-
-std::unique_ptr<message::Response> ResponseBuffer::remove(const message::Request& request) {
-    std::unique_ptr<message::Response> response;
-    std::vector<std::unique_ptr<message::Response>>::iterator i = _head;
-
-    do {
-        std::vector<std::unique_ptr<message::Response>>::iterator entry = i;
-
-        /* next buffer position */
-        if (++i == std::end(_responses)) {
-            i = std::begin(_responses);
-        }
-        if (*entry && (*entry)->get_request_id() == request.id) {
-            response = std::move(*entry); /* remove response from buffer
-                                             (must be removed *before* notification) */
-            _head = i;                    /* remember next buffer position for subsequent search */
-            _responseRemoved.notify_one();
-            break;
-        }
-
-    } while (i != _head); /* only run through buffer once */
-
-    return response;
+	/* slots of waiting threads must be kept */
+	for (auto i = std::begin(_slots); i != std::end(_slots); ) {
+	    if (!i->second.waiting) {
+	        i = _slots.erase(i);
+	    } else {
+	        ++i;
+	    }
+	}
+	_expired.clear();
 }
 
 } /* namespace comm */
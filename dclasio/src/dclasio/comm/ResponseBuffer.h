@@ -49,30 +49,49 @@
 
 #include <dcl/DCLException.h>
 
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <memory>
 #include <mutex>
-#include <vector>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace dclasio {
 
 namespace comm {
 
 /**
- * @class A ring buffer for saving responses from compute nodes.
+ * @class A completion table for saving responses from compute nodes.
+ *
+ * Responses are stored in a slot keyed by the ID of the associated request.
+ * Each slot has its own condition variable, such that inserting a response
+ * only wakes the thread waiting for that response.
  */
 class ResponseBuffer {
 public:
 	static const size_t DEFAULT_SIZE = 64;
 
+	/**
+	 * @brief Creates an empty response buffer.
+	 *
+	 * @param[in]  size the expected number of outstanding requests;
+	 *             the buffer grows beyond this size if required
+	 */
 	ResponseBuffer(
 	        size_t size = DEFAULT_SIZE);
 	virtual ~ResponseBuffer();
 
+	/**
+	 * @brief Adds a response to the buffer.
+	 *
+	 * This method never blocks. Responses to requests for which a timed get
+	 * has expired are discarded.
+	 *
+	 * @param[in]  response the response to add
+	 */
 	void put(
 	        std::unique_ptr<message::Response>&& response);
-    /* TODO Add timed method for adding responses */
 
 	std::unique_ptr<message::Response> tryGet(
 	        const message::Request& request);
@@ -97,16 +116,25 @@ public:
 	        const message::Request& request,
 	        const std::chrono::duration<Rep, Period>& timeout) {
 	    std::lock_guard<std::mutex> lock(_mutex);
-	    std::unique_ptr<message::Response> response;
+	    auto deadline = std::chrono::steady_clock::now() + timeout;
+	    Slot& slot = _slots[request.id];
+	    slot.waiting = true;
 
-	    while (!_interrupt && !(response = remove(request))) {
-	        if (_responseAdded.wait_for(_mutex, timeout) == std::cv_status::timeout) {
+	    while (!_interrupt && !slot.response) {
+	        if (slot.completed.wait_until(_mutex, deadline) == std::cv_status::timeout) {
 	            /* timeout expired */
 	            break;
 	        }
 	    };
 	    if (_interrupt) throw dcl::ThreadInterrupted();
 
+	    std::unique_ptr<message::Response> response(std::move(slot.response));
+	    _slots.erase(request.id);
+	    if (!response) {
+	        /* discard response if it arrives after the timeout */
+	        _expired.insert(request.id);
+	    }
+
 	    return response;
 	}
 
@@ -114,17 +142,23 @@ public:
 	void clear();
 
 private:
-	bool insert(
-	        std::unique_ptr<message::Response>&& response);
-	std::unique_ptr<message::Response> remove(
-	        const message::Request& request);
+	/**
+	 * @brief A slot of the completion table
+	 */
+	struct Slot {
+	    Slot() : waiting(false) { }
+
+	    std::unique_ptr<message::Response> response; /**< the response, or NULL if not yet received */
+	    std::condition_variable_any completed;       /**< condition: response received */
+	    bool waiting;                                /**< true, if a thread waits for the response */
+	};
 
-	std::vector<std::unique_ptr<message::Response>> _responses;
-	std::vector<std::unique_ptr<message::Response>>::iterator _head, _tail;
+	/* Elements of an unordered map are not relocated when the map grows, such
+	 * that waiting threads may keep a reference to their slot. */
+	std::unordered_map<message::Request::id_type, Slot> _slots;
+	std::unordered_set<message::Request::id_type> _expired; /**< requests for which a timed get has expired */
 
 	std::mutex _mutex;                            /**< buffer mutex */
-	std::condition_variable_any _responseAdded;   /**< condition: added response to buffer */
-	std::condition_variable_any _responseRemoved; /**< condition: removed response from buffer */
 	bool _interrupt;
 };
 
@@ -54,22 +54,32 @@
 #include <CL/cl.h>
 #endif
 
+#include <vector>
+
 namespace dclasio {
 
 namespace message {
 
 CommandExecutionStatusChangedMessage::CommandExecutionStatusChangedMessage() :
-    _commandId(0), _status(CL_SUBMITTED) {
+    _commandId(0), _status(CL_SUBMITTED), _hostId(0) {
+}
+
+CommandExecutionStatusChangedMessage::CommandExecutionStatusChangedMessage(
+		dcl::object_id commandId, cl_int status, dcl::process_id hostId):
+	_commandId(commandId), _status(status), _hostId(hostId) {
 }
 
 CommandExecutionStatusChangedMessage::CommandExecutionStatusChangedMessage(
-		dcl::object_id commandId, cl_int status):
-	_commandId(commandId), _status(status) {
+		dcl::object_id commandId, cl_int status,
+		const std::vector<cl_ulong>& profilingInfo):
+	_commandId(commandId), _status(status), _hostId(0),
+	_profilingInfo(profilingInfo) {
 }
 
 CommandExecutionStatusChangedMessage::CommandExecutionStatusChangedMessage(
 		const CommandExecutionStatusChangedMessage& rhs) :
-	_commandId(rhs._commandId), _status(rhs._status) {
+	_commandId(rhs._commandId), _status(rhs._status), _hostId(rhs._hostId),
+	_profilingInfo(rhs._profilingInfo) {
 }
 
 CommandExecutionStatusChangedMessage::~CommandExecutionStatusChangedMessage() { }
@@ -82,6 +92,14 @@ cl_int CommandExecutionStatusChangedMessage::status() const {
 	return _status;
 }
 
+dcl::process_id CommandExecutionStatusChangedMessage::hostId() const {
+	return _hostId;
+}
+
+const std::vector<cl_ulong>& CommandExecutionStatusChangedMessage::profilingInfo() const {
+	return _profilingInfo;
+}
+
 } /* namespace message */
 
 } /* namespace dclasio */
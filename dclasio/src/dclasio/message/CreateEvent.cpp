@@ -46,6 +46,8 @@
 
 #include <dcl/DCLTypes.h>
 
+#include <cstddef>
+#include <string>
 #include <vector>
 
 namespace dclasio {
@@ -56,14 +58,18 @@ CreateEvent::CreateEvent() {
 
 CreateEvent::CreateEvent(dcl::object_id contextId,
 		dcl::object_id eventId,
-		const std::vector<dcl::object_id>& memObjectIds) :
-	_contextId(contextId), _eventId(eventId), _memObjectIds(memObjectIds) {
+		const std::vector<dcl::object_id>& memObjectIds,
+		size_t offset, size_t cb,
+		const std::string& computeNodeUrl) :
+	_contextId(contextId), _eventId(eventId), _memObjectIds(memObjectIds),
+	_offset(offset), _cb(cb), _computeNodeUrl(computeNodeUrl) {
 }
 
 CreateEvent::CreateEvent(
 		const CreateEvent& rhs) :
 	Request(rhs), _contextId(rhs._contextId), _eventId(rhs._eventId),
-	_memObjectIds(rhs._memObjectIds)  {
+	_memObjectIds(rhs._memObjectIds), _offset(rhs._offset), _cb(rhs._cb),
+	_computeNodeUrl(rhs._computeNodeUrl) {
 }
 
 CreateEvent::~CreateEvent() { }
@@ -80,5 +86,17 @@ const std::vector<dcl::object_id>& CreateEvent::memObjectIds() const {
 	return _memObjectIds;
 }
 
+size_t CreateEvent::offset() const {
+	return _offset;
+}
+
+size_t CreateEvent::cb() const {
+	return _cb;
+}
+
+const std::string& CreateEvent::computeNodeUrl() const {
+	return _computeNodeUrl;
+}
+
 } /* namespace message */
 } /* namespace dclasio */
@@ -47,6 +47,7 @@
 #include <dcl/DCLTypes.h>
 
 #include <cstddef>
+#include <string>
 #include <vector>
 
 namespace dclasio {
@@ -64,11 +65,14 @@ EnqueueBroadcastBuffer::EnqueueBroadcastBuffer(
 		size_t srcOffset,
 		const std::vector<size_t>& dstOffsets,
 		size_t cb,
+		const std::string& parentUrl,
+		const std::vector<dcl::process_id>& childIds,
 		const std::vector<dcl::object_id> *eventIdWaitList,
 		bool event) :
 	_commandQueueIds(commandQueueIds), _commandId(commandId),
 			_srcBufferId(srcBufferId), _dstBufferIds(dstBufferIds),
-			_srcOffset(srcOffset), _dstOffsets(dstOffsets), _cb(cb), _event(event)
+			_srcOffset(srcOffset), _dstOffsets(dstOffsets), _cb(cb),
+			_parentUrl(parentUrl), _childIds(childIds), _event(event)
 {
 	if (eventIdWaitList) {
 		_eventIdWaitList = *eventIdWaitList;
@@ -79,7 +83,8 @@ EnqueueBroadcastBuffer::EnqueueBroadcastBuffer(const EnqueueBroadcastBuffer& rhs
 	Request(rhs), _commandQueueIds(rhs._commandQueueIds), _commandId(
 			rhs._commandId), _srcBufferId(rhs._srcBufferId), _dstBufferIds(
 			rhs._dstBufferIds), _srcOffset(rhs._srcOffset), _dstOffsets(
-			rhs._dstOffsets), _cb(rhs._cb), _eventIdWaitList(
+			rhs._dstOffsets), _cb(rhs._cb), _parentUrl(rhs._parentUrl),
+			_childIds(rhs._childIds), _eventIdWaitList(
 			rhs._eventIdWaitList), _event(rhs._event)
 {
 }
@@ -112,6 +117,14 @@ size_t EnqueueBroadcastBuffer::cb() const {
 	return _cb;
 }
 
+const std::string& EnqueueBroadcastBuffer::parentUrl() const {
+	return _parentUrl;
+}
+
+const std::vector<dcl::process_id>& EnqueueBroadcastBuffer::childIds() const {
+	return _childIds;
+}
+
 const std::vector<dcl::object_id>& EnqueueBroadcastBuffer::eventIdWaitList() const {
 	return _eventIdWaitList;
 }
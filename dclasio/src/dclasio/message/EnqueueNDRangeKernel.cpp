@@ -44,10 +44,18 @@
 #include <dclasio/message/EnqueueNDRangeKernel.h>
 #include <dclasio/message/Request.h>
 
+#include <dcl/Binary.h>
 #include <dcl/DCLTypes.h>
 
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
 #include <cassert>
 #include <cstddef>
+#include <map>
 #include <vector>
 
 namespace dclasio {
@@ -76,9 +84,10 @@ EnqueueNDRangeKernel::EnqueueNDRangeKernel(
 
 EnqueueNDRangeKernel::EnqueueNDRangeKernel(const EnqueueNDRangeKernel& rhs) :
         Request(rhs), _commandQueueId(rhs._commandQueueId), _commandId(
-                rhs._commandId), _kernelId(rhs._kernelId), _global(rhs._global), _local(
-                rhs._local), _eventIdWaitList(rhs._eventIdWaitList), _event(
-                rhs._event) {
+                rhs._commandId), _kernelId(rhs._kernelId), _offset(rhs._offset), _global(
+                rhs._global), _local(rhs._local), _eventIdWaitList(rhs._eventIdWaitList), _event(
+                rhs._event), _argBinaries(rhs._argBinaries), _argMemObjects(
+                rhs._argMemObjects), _argLocalSizes(rhs._argLocalSizes) {
 }
 
 dcl::object_id EnqueueNDRangeKernel::commandQueueId() const {
@@ -113,5 +122,36 @@ bool EnqueueNDRangeKernel::event() const {
     return _event;
 }
 
+void EnqueueNDRangeKernel::setArgBinary(
+        cl_uint index,
+        size_t size,
+        const void *value) {
+    _argBinaries[index] = dcl::Binary(size, value);
+}
+
+void EnqueueNDRangeKernel::setArgMemObject(
+        cl_uint index,
+        dcl::object_id memObjectId) {
+    _argMemObjects[index] = memObjectId;
+}
+
+void EnqueueNDRangeKernel::setArgLocal(
+        cl_uint index,
+        size_t size) {
+    _argLocalSizes[index] = size;
+}
+
+const std::map<cl_uint, dcl::Binary>& EnqueueNDRangeKernel::argBinaries() const {
+    return _argBinaries;
+}
+
+const std::map<cl_uint, dcl::object_id>& EnqueueNDRangeKernel::argMemObjects() const {
+    return _argMemObjects;
+}
+
+const std::map<cl_uint, size_t>& EnqueueNDRangeKernel::argLocalSizes() const {
+    return _argLocalSizes;
+}
+
 } /* namespace message */
 } /* namespace dclasio */
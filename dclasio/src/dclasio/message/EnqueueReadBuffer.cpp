@@ -63,10 +63,11 @@ EnqueueReadBuffer::EnqueueReadBuffer(
 		bool blocking_read,
 		size_t offset,
 		size_t cb,
+		size_t chunkSize,
 		const std::vector<dcl::object_id> *eventIdWaitList,
 		bool event) :
 	_commandQueueId(commandQueueId), _commandId(commandId), _bufferId(bufferId),
-			_blocking(blocking_read), _offset(offset), _cb(cb), _event(event) {
+			_blocking(blocking_read), _offset(offset), _cb(cb), _chunkSize(chunkSize), _event(event) {
 	if (eventIdWaitList) {
 		_eventIdWaitList = *eventIdWaitList;
 	}
@@ -76,7 +77,7 @@ EnqueueReadBuffer::EnqueueReadBuffer(
 		const EnqueueReadBuffer& rhs) :
 	Request(rhs), _commandQueueId(rhs._commandQueueId),
 			_commandId(rhs._commandId),	_bufferId(rhs._bufferId),
-			_blocking(rhs._blocking), _offset(rhs._offset), _cb(rhs._cb),
+			_blocking(rhs._blocking), _offset(rhs._offset), _cb(rhs._cb), _chunkSize(rhs._chunkSize),
 			_eventIdWaitList(rhs._eventIdWaitList), _event(rhs._event) {
 }
 
@@ -104,6 +105,10 @@ size_t EnqueueReadBuffer::cb() const {
 	return _cb;
 }
 
+size_t EnqueueReadBuffer::chunkSize() const {
+	return _chunkSize;
+}
+
 const std::vector<dcl::object_id>& EnqueueReadBuffer::eventIdWaitList(void) const {
 	return _eventIdWaitList;
 }
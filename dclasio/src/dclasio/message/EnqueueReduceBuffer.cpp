@@ -44,17 +44,21 @@
 #include <dclasio/message/EnqueueReduceBuffer.h>
 #include <dclasio/message/Request.h>
 
+#include <dcl/Binary.h>
 #include <dcl/DCLTypes.h>
 
 #include <cassert>
 #include <cstddef>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace dclasio {
 namespace message {
 
 EnqueueReduceBuffer::EnqueueReduceBuffer() :
-        _commandId(0), _dstId(0), _kernelId(0), _event(false) {
+        _commandId(0), _dstId(0), _kernelId(0), _contextId(0), _deviceId(0),
+        _parentId(0), _event(false) {
 }
 
 EnqueueReduceBuffer::EnqueueReduceBuffer(
@@ -66,11 +70,16 @@ EnqueueReduceBuffer::EnqueueReduceBuffer(
         const std::vector<size_t>& offset,
         const std::vector<size_t>& global,
         const std::vector<size_t>& local,
+        dcl::object_id contextId,
+        dcl::object_id deviceId,
+        dcl::process_id parentId,
+        const std::vector<std::string>& childUrls,
         const std::vector<dcl::object_id> *eventIdWaitList,
         bool event) :
         _commandQueueId(commandQueueId), _commandId(commandId), _srcIds(srcIds), _dstId(
                 dstId), _kernelId(kernelId), _offset(offset), _global(global), _local(
-                local), _event(event) {
+                local), _contextId(contextId), _deviceId(deviceId), _parentId(
+                parentId), _childUrls(childUrls), _event(event) {
     if (eventIdWaitList) {
         _eventIdWaitList = *eventIdWaitList;
     }
@@ -79,8 +88,12 @@ EnqueueReduceBuffer::EnqueueReduceBuffer(
 EnqueueReduceBuffer::EnqueueReduceBuffer(const EnqueueReduceBuffer& rhs) :
         Request(rhs), _commandQueueId(rhs._commandQueueId), _commandId(
                 rhs._commandId), _srcIds(rhs._srcIds), _dstId(rhs._dstId), _kernelId(
-                rhs._kernelId), _global(rhs._global), _local(rhs._local), _eventIdWaitList(
-                rhs._eventIdWaitList), _event(rhs._event) {
+                rhs._kernelId), _offset(rhs._offset), _global(rhs._global), _local(
+                rhs._local), _contextId(rhs._contextId), _deviceId(rhs._deviceId), _parentId(
+                rhs._parentId), _childUrls(rhs._childUrls), _eventIdWaitList(
+                rhs._eventIdWaitList), _event(rhs._event), _argBinaries(
+                rhs._argBinaries), _argMemObjects(rhs._argMemObjects), _argLocalSizes(
+                rhs._argLocalSizes) {
 }
 
 dcl::object_id EnqueueReduceBuffer::commandQueueId() const {
@@ -115,6 +128,22 @@ const std::vector<size_t>& EnqueueReduceBuffer::local() const {
     return _local;
 }
 
+dcl::object_id EnqueueReduceBuffer::contextId() const {
+    return _contextId;
+}
+
+dcl::object_id EnqueueReduceBuffer::deviceId() const {
+    return _deviceId;
+}
+
+dcl::process_id EnqueueReduceBuffer::parentId() const {
+    return _parentId;
+}
+
+const std::vector<std::string>& EnqueueReduceBuffer::childUrls() const {
+    return _childUrls;
+}
+
 const std::vector<dcl::object_id>& EnqueueReduceBuffer::eventIdWaitList() const {
     return _eventIdWaitList;
 }
@@ -123,5 +152,36 @@ bool EnqueueReduceBuffer::event() const {
     return _event;
 }
 
+void EnqueueReduceBuffer::setArgBinary(
+        cl_uint index,
+        size_t size,
+        const void *value) {
+    _argBinaries[index] = dcl::Binary(size, value);
+}
+
+void EnqueueReduceBuffer::setArgMemObject(
+        cl_uint index,
+        dcl::object_id memObjectId) {
+    _argMemObjects[index] = memObjectId;
+}
+
+void EnqueueReduceBuffer::setArgLocal(
+        cl_uint index,
+        size_t size) {
+    _argLocalSizes[index] = size;
+}
+
+const std::map<cl_uint, dcl::Binary>& EnqueueReduceBuffer::argBinaries() const {
+    return _argBinaries;
+}
+
+const std::map<cl_uint, dcl::object_id>& EnqueueReduceBuffer::argMemObjects() const {
+    return _argMemObjects;
+}
+
+const std::map<cl_uint, size_t>& EnqueueReduceBuffer::argLocalSizes() const {
+    return _argLocalSizes;
+}
+
 } /* namespace message */
 } /* namespace dclasio */
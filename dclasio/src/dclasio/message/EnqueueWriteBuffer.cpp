@@ -63,10 +63,11 @@ EnqueueWriteBuffer::EnqueueWriteBuffer(
 		bool blocking_write,
 		size_t offset,
 		size_t cb,
+		size_t chunkSize,
 		const std::vector<dcl::object_id> *eventIdWaitList,
 		bool event) :
 	_commandQueueId(commandQueueId), _commandId(commandId), _bufferId(bufferId),
-			_blocking(blocking_write), _offset(offset), _cb(cb), _event(event) {
+			_blocking(blocking_write), _offset(offset), _cb(cb), _chunkSize(chunkSize), _event(event) {
 
 	if (eventIdWaitList) {
 		_eventIdWaitList = *eventIdWaitList;
@@ -76,7 +77,7 @@ EnqueueWriteBuffer::EnqueueWriteBuffer(
 EnqueueWriteBuffer::EnqueueWriteBuffer(const EnqueueWriteBuffer& rhs) :
 	Request(rhs), _commandQueueId(rhs._commandQueueId),
 			_commandId(rhs._commandId), _bufferId(rhs._bufferId),
-			_blocking(rhs._blocking), _offset(rhs._offset), _cb(rhs._cb),
+			_blocking(rhs._blocking), _offset(rhs._offset), _cb(rhs._cb), _chunkSize(rhs._chunkSize),
 			_eventIdWaitList(rhs._eventIdWaitList),	_event(rhs._event) {
 }
 
@@ -104,6 +105,10 @@ size_t EnqueueWriteBuffer::cb() const {
 	return _cb;
 }
 
+size_t EnqueueWriteBuffer::chunkSize() const {
+	return _chunkSize;
+}
+
 const std::vector<dcl::object_id>& EnqueueWriteBuffer::eventIdWaitList() const {
 	return _eventIdWaitList;
 }
@@ -0,0 +1,132 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file EnqueueWriteBuffers.cpp
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include <dclasio/message/EnqueueWriteBuffers.h>
+#include <dclasio/message/Request.h>
+
+#include <dcl/DCLTypes.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace dclasio {
+namespace message {
+
+EnqueueWriteBuffers::EnqueueWriteBuffers() :
+    _commandId(0), _cb(0), _chunkSize(0), _successorId(0), _event(false) {
+}
+
+EnqueueWriteBuffers::EnqueueWriteBuffers(
+        const std::vector<dcl::object_id>& commandQueueIds,
+        dcl::object_id commandId,
+        const std::vector<dcl::object_id>& bufferIds,
+        const std::vector<size_t>& offsets,
+        size_t cb,
+        size_t chunkSize,
+        const std::string& predecessorUrl,
+        dcl::process_id successorId,
+        const std::vector<dcl::object_id> *eventIdWaitList,
+        bool event) :
+    _commandQueueIds(commandQueueIds), _commandId(commandId),
+            _bufferIds(bufferIds), _offsets(offsets), _cb(cb),
+            _chunkSize(chunkSize), _predecessorUrl(predecessorUrl),
+            _successorId(successorId), _event(event)
+{
+    if (eventIdWaitList) {
+        _eventIdWaitList = *eventIdWaitList;
+    }
+}
+
+EnqueueWriteBuffers::EnqueueWriteBuffers(const EnqueueWriteBuffers& rhs) :
+    Request(rhs), _commandQueueIds(rhs._commandQueueIds),
+            _commandId(rhs._commandId), _bufferIds(rhs._bufferIds),
+            _offsets(rhs._offsets), _cb(rhs._cb), _chunkSize(rhs._chunkSize),
+            _predecessorUrl(rhs._predecessorUrl),
+            _successorId(rhs._successorId),
+            _eventIdWaitList(rhs._eventIdWaitList), _event(rhs._event)
+{
+}
+
+const std::vector<dcl::object_id>& EnqueueWriteBuffers::commandQueueIds() const {
+    return _commandQueueIds;
+}
+
+dcl::object_id EnqueueWriteBuffers::commandId() const {
+    return _commandId;
+}
+
+const std::vector<dcl::object_id>& EnqueueWriteBuffers::bufferIds() const {
+    return _bufferIds;
+}
+
+const std::vector<size_t>& EnqueueWriteBuffers::offsets() const {
+    return _offsets;
+}
+
+size_t EnqueueWriteBuffers::cb() const {
+    return _cb;
+}
+
+size_t EnqueueWriteBuffers::chunkSize() const {
+    return _chunkSize;
+}
+
+const std::string& EnqueueWriteBuffers::predecessorUrl() const {
+    return _predecessorUrl;
+}
+
+dcl::process_id EnqueueWriteBuffers::successorId() const {
+    return _successorId;
+}
+
+const std::vector<dcl::object_id>& EnqueueWriteBuffers::eventIdWaitList() const {
+    return _eventIdWaitList;
+}
+
+bool EnqueueWriteBuffers::event() const {
+    return _event;
+}
+
+} /* namespace message */
+} /* namespace dclasio */
@@ -59,20 +59,14 @@ EventProfilingInfosReponse::EventProfilingInfosReponse() {
 }
 
 EventProfilingInfosReponse::EventProfilingInfosReponse(
-        const Request& request,
-        cl_ulong received_,
-        cl_ulong queued_,
-        cl_ulong submit_,
-        cl_ulong start_,
-        cl_ulong end_) :
-        DefaultResponse(request), received(received_), queued(queued_), submit(
-                submit_), start(start_), end(end_) {
+        const Request& request) :
+        DefaultResponse(request) {
 }
 
 EventProfilingInfosReponse::EventProfilingInfosReponse(
         const EventProfilingInfosReponse& rhs) :
-        DefaultResponse(rhs), received(rhs.received), queued(rhs.queued), submit(
-                rhs.submit), start(rhs.start), end(rhs.end) {
+        DefaultResponse(rhs), errcodes(rhs.errcodes), received(rhs.received),
+        queued(rhs.queued), submit(rhs.submit), start(rhs.start), end(rhs.end) {
 }
 
 EventProfilingInfosReponse::~EventProfilingInfosReponse() {
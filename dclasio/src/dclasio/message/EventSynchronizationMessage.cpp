@@ -51,17 +51,18 @@ namespace dclasio {
 namespace message {
 
 EventSynchronizationMessage::EventSynchronizationMessage() :
-    _commandId(0) {
+    _commandId(0), _destinationId(0) {
 }
 
 EventSynchronizationMessage::EventSynchronizationMessage(
-        dcl::object_id commandId) :
-        _commandId(commandId) {
+        dcl::object_id commandId,
+        dcl::process_id destinationId) :
+        _commandId(commandId), _destinationId(destinationId) {
 }
 
 EventSynchronizationMessage::EventSynchronizationMessage(
         const EventSynchronizationMessage& rhs) :
-        _commandId(rhs._commandId) {
+        _commandId(rhs._commandId), _destinationId(rhs._destinationId) {
 }
 
 EventSynchronizationMessage::~EventSynchronizationMessage() {
@@ -71,6 +72,10 @@ dcl::object_id EventSynchronizationMessage::commandId() const {
     return _commandId;
 }
 
+dcl::process_id EventSynchronizationMessage::destinationId() const {
+    return _destinationId;
+}
+
 } /* namespace message */
 
 } /* namespace dclasio */
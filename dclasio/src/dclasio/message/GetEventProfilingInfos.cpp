@@ -46,6 +46,8 @@
 
 #include <dcl/DCLTypes.h>
 
+#include <vector>
+
 namespace dclasio {
 namespace message {
 
@@ -53,17 +55,21 @@ GetEventProfilingInfos::GetEventProfilingInfos() {
 }
 
 GetEventProfilingInfos::GetEventProfilingInfos(
-		dcl::object_id eventID) : _eventId(eventID) {
+		dcl::object_id eventID) : _eventIds(1, eventID) {
+}
+
+GetEventProfilingInfos::GetEventProfilingInfos(
+		const std::vector<dcl::object_id>& eventIds) : _eventIds(eventIds) {
 }
 
 GetEventProfilingInfos::GetEventProfilingInfos(const GetEventProfilingInfos& rhs) :
-	_eventId(rhs._eventId) {
+	_eventIds(rhs._eventIds) {
 }
 
 GetEventProfilingInfos::~GetEventProfilingInfos() { }
 
-dcl::object_id GetEventProfilingInfos::eventId() const {
-	return _eventId;
+const std::vector<dcl::object_id>& GetEventProfilingInfos::eventIds() const {
+	return _eventIds;
 }
 
 } /* namespace message */
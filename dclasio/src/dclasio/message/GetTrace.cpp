@@ -0,0 +1,119 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file GetTrace.cpp
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include <dclasio/message/GetTrace.h>
+
+#include <dclasio/message/Request.h>
+#include <dclasio/message/Response.h>
+
+#include <dcl/util/Trace.h>
+
+#include <vector>
+
+namespace dclasio {
+namespace message {
+
+GetTrace::GetTrace() {
+}
+
+GetTrace::GetTrace(const GetTrace& rhs) :
+    Request(rhs) {
+}
+
+GetTrace::~GetTrace() {
+}
+
+/* ****************************************************************************/
+
+TraceResponse::TraceResponse() {
+}
+
+TraceResponse::TraceResponse(
+        const Request& request,
+        const std::vector<dcl::util::TraceRecord>& records) :
+        DefaultResponse(request) {
+    _names.reserve(records.size());
+    _categories.reserve(records.size());
+    _threads.reserve(records.size());
+    _start.reserve(records.size());
+    _end.reserve(records.size());
+    _args.reserve(records.size());
+
+    for (const auto& record : records) {
+        _names.push_back(record.name);
+        _categories.push_back(record.category);
+        _threads.push_back(record.thread);
+        _start.push_back(record.start);
+        _end.push_back(record.end);
+        _args.push_back(record.arg);
+    }
+}
+
+TraceResponse::TraceResponse(const TraceResponse& rhs) :
+        DefaultResponse(rhs), _names(rhs._names), _categories(rhs._categories),
+        _threads(rhs._threads), _start(rhs._start), _end(rhs._end),
+        _args(rhs._args) {
+}
+
+TraceResponse::~TraceResponse() {
+}
+
+void TraceResponse::records(
+        std::vector<dcl::util::TraceRecord>& records) const {
+    records.clear();
+    records.reserve(_names.size());
+
+    for (size_t i = 0; i < _names.size(); ++i) {
+        dcl::util::TraceRecord record;
+        record.name = _names[i];
+        record.category = _categories[i];
+        record.thread = _threads[i];
+        record.start = _start[i];
+        record.end = _end[i];
+        record.arg = _args[i];
+        records.push_back(record);
+    }
+}
+
+} /* namespace message */
+} /* namespace dclasio */
@@ -75,6 +75,7 @@
 #include <dclasio/message/EnqueueUnmapBuffer.h>
 #include <dclasio/message/EnqueueWaitForEvents.h>
 #include <dclasio/message/EnqueueWriteBuffer.h>
+#include <dclasio/message/EnqueueWriteBuffers.h>
 #include <dclasio/message/ErrorResponse.h>
 #include <dclasio/message/EventProfilingInfosResponse.h>
 #include <dclasio/message/EventSynchronizationMessage.h>
@@ -82,11 +83,14 @@
 #include <dclasio/message/FlushRequest.h>
 #include <dclasio/message/GetEventProfilingInfos.h>
 #include <dclasio/message/GetKernelInfo.h>
+#include <dclasio/message/GetTrace.h>
 #include <dclasio/message/InfoResponse.h>
 #include <dclasio/message/Message.h>
 #include <dclasio/message/Request.h>
 #include <dclasio/message/Response.h>
 #include <dclasio/message/SetKernelArg.h>
+#include <dclasio/message/SubscribeEvent.h>
+#include <dclasio/message/SynchronizeClock.h>
 
 #include <stdexcept>
 
@@ -132,6 +136,7 @@ Message * createMessage(Message::class_type type) {
     case EnqueueUnmapBuffer::TYPE:          return new EnqueueUnmapBuffer();
     case EnqueueWaitForEvents::TYPE:        return new EnqueueWaitForEvents();
     case EnqueueWriteBuffer::TYPE:          return new EnqueueWriteBuffer();
+    case EnqueueWriteBuffers::TYPE:         return new EnqueueWriteBuffers();
     case FinishRequest::TYPE:               return new FinishRequest();
     case FlushRequest::TYPE:                return new FlushRequest();
     case GetDeviceIDs::TYPE:                return new GetDeviceIDs();
@@ -144,13 +149,18 @@ Message * createMessage(Message::class_type type) {
     case SetKernelArg::TYPE:                return new SetKernelArg();
     case SetKernelArgBinary::TYPE:          return new SetKernelArgBinary();
     case SetKernelArgMemObject::TYPE:       return new SetKernelArgMemObject();
+    case SubscribeEvent::TYPE:              return new SubscribeEvent();
+    case SynchronizeClock::TYPE:            return new SynchronizeClock();
+    case GetTrace::TYPE:                    return new GetTrace();
 
     // response messages
+    case ClockResponse::TYPE:               return new ClockResponse();
     case DefaultResponse::TYPE:             return new DefaultResponse();
     case DeviceIDsResponse::TYPE:           return new DeviceIDsResponse();
     case DeviceInfosResponse::TYPE:         return new DeviceInfosResponse();
     case EventProfilingInfosReponse::TYPE:  return new EventProfilingInfosReponse();
     case ErrorResponse::TYPE:               return new ErrorResponse();
+    case TraceResponse::TYPE:               return new TraceResponse();
     case InfoResponse::TYPE:                return new InfoResponse();
 
     default:
@@ -0,0 +1,89 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+
+/*!
+ * \file SubscribeEvent.cpp
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include <dclasio/message/SubscribeEvent.h>
+#include <dclasio/message/Request.h>
+
+#include <dcl/DCLTypes.h>
+
+namespace dclasio {
+
+namespace message {
+
+SubscribeEvent::SubscribeEvent() :
+    _eventId(0), _commandQueueId(0), _subscriberId(0) {
+}
+
+SubscribeEvent::SubscribeEvent(
+        dcl::object_id eventId,
+        dcl::object_id commandQueueId,
+        dcl::process_id subscriberId) :
+    _eventId(eventId), _commandQueueId(commandQueueId),
+    _subscriberId(subscriberId) {
+}
+
+SubscribeEvent::SubscribeEvent(
+        const SubscribeEvent& rhs) :
+    Request(rhs), _eventId(rhs._eventId),
+    _commandQueueId(rhs._commandQueueId), _subscriberId(rhs._subscriberId) {
+}
+
+SubscribeEvent::~SubscribeEvent() {
+}
+
+dcl::object_id SubscribeEvent::eventId() const {
+    return _eventId;
+}
+
+dcl::object_id SubscribeEvent::commandQueueId() const {
+    return _commandQueueId;
+}
+
+dcl::process_id SubscribeEvent::subscriberId() const {
+    return _subscriberId;
+}
+
+} /* namespace message */
+
+} /* namespace dclasio */
@@ -74,10 +74,14 @@
 #include <dclasio/message/EnqueueReduceBuffer.h>
 #include <dclasio/message/EnqueueUnmapBuffer.h>
 #include <dclasio/message/EnqueueWriteBuffer.h>
+#include <dclasio/message/EnqueueWriteBuffers.h>
 #include <dclasio/message/EnqueueWaitForEvents.h>
 #include <dclasio/message/ErrorResponse.h>
+#include <dclasio/message/EventProfilingInfosResponse.h>
 #include <dclasio/message/FinishRequest.h>
 #include <dclasio/message/FlushRequest.h>
+#include <dclasio/message/GetEventProfilingInfos.h>
+#include <dclasio/message/Request.h>
 
 #include <dcl/CLError.h>
 #include <dcl/CLObjectRegistry.h>
@@ -87,6 +91,7 @@
 #include <dcl/DCLTypes.h>
 #include <dcl/Remote.h>
 
+#include <dcl/util/Environment.h>
 #include <dcl/util/Logger.h>
 
 #ifdef __APPLE__
@@ -101,7 +106,9 @@
 
 #include <algorithm>
 #include <cassert>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdlib>
 #include <functional>
 #include <iterator>
 #include <map>
@@ -109,13 +116,42 @@
 #include <ostream>
 #include <set>
 #include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
 
+namespace {
+
+/**
+ * @brief Default size of the chunks in which buffer data is streamed
+ */
+const size_t DEFAULT_PIPELINE_CHUNK_SIZE = 1024 * 1024;
+
+/**
+ * @brief Returns the size of the chunks in which buffer data is streamed
+ *
+ * Reads and writes are streamed in chunks of this size, such that a compute
+ * node copies a chunk between device and host memory while the next chunk is
+ * transferred over the network. A multicast upload is forwarded in chunks of
+ * this size.
+ *
+ * The chunk size is set in bytes by the environment variable
+ * DCL_PIPELINE_CHUNK_SIZE. If it is set to 0, data is not streamed, i.e., each
+ * compute node only processes data after it has been received completely.
+ */
+size_t pipelineChunkSize() {
+    static const size_t chunkSize = dcl::util::getEnvSize(
+            "DCL_PIPELINE_CHUNK_SIZE", DEFAULT_PIPELINE_CHUNK_SIZE);
+    return chunkSize;
+}
+
+} /* unnamed namespace */
+
 _cl_command_queue::_cl_command_queue(cl_context context, cl_device_id device,
 		cl_command_queue_properties properties) :
-	_context(context), _device(device), _properties(properties)
+	_context(context), _device(device), _properties(properties),
+	_pendingRequests(0), _deferredError(CL_SUCCESS)
 {
 	if (!context) throw dclicd::Error(CL_INVALID_CONTEXT);
 	if (!device) throw dclicd::Error(CL_INVALID_DEVICE);
@@ -223,9 +259,15 @@ void _cl_command_queue::finish() {
 		throw dclicd::Error(err);
 	}
 
+	/* Failed commands must be updated before waiting for local commands */
+	cl_int errcode = awaitPendingRequests();
+
 	/* TODO Make compute node call _cl_command_queue::onFinish */
 	onFinish();
 
+	/* Report error of a preceding asynchronous enqueue operation */
+	if (errcode != CL_SUCCESS) throw dclicd::Error(errcode);
+
     dcl::util::Logger << dcl::util::Info
             << "Finished command queue (ID=" << _id << ')' << std::endl;
 }
@@ -247,11 +289,83 @@ void _cl_command_queue::flush() {
 	} catch (const dcl::ProtocolException& err) {
 		throw dclicd::Error(err);
 	}
+
+	/* Errors of preceding asynchronous enqueue operations are not reported
+	 * here, but by the failed commands' events and by finish */
+}
+
+void _cl_command_queue::addUnprofiledEvent(dclicd::Event& event) {
+    std::lock_guard<std::mutex> lock(_unprofiledEventsMutex);
+    _unprofiledEvents.insert(&event);
+}
+
+void _cl_command_queue::removeUnprofiledEvent(dclicd::Event& event) {
+    std::lock_guard<std::mutex> lock(_unprofiledEventsMutex);
+    _unprofiledEvents.erase(&event);
+}
+
+void _cl_command_queue::fetchProfilingInfos() {
+    /* Registered events are not deleted while the lock is held */
+    std::lock_guard<std::mutex> lock(_unprofiledEventsMutex);
+    if (_unprofiledEvents.empty()) return;
+
+    std::vector<dclicd::Event *> events(
+            std::begin(_unprofiledEvents), std::end(_unprofiledEvents));
+    std::vector<dcl::object_id> eventIds;
+    eventIds.reserve(events.size());
+    for (auto event : events) {
+        eventIds.push_back(event->remoteId());
+    }
+    /* Events are not registered again, even if the request fails */
+    _unprofiledEvents.clear();
+
+    try {
+        dclasio::message::GetEventProfilingInfos request(eventIds);
+        std::unique_ptr<dclasio::message::EventProfilingInfosReponse> response(
+                static_cast<dclasio::message::EventProfilingInfosReponse *>(
+                        computeNode().executeCommand(
+                                request, dclasio::message::EventProfilingInfosReponse::TYPE).release()));
+        if (       response->errcodes.size() != events.size()
+                || response->received.size() != events.size()
+                || response->queued.size() != events.size()
+                || response->submit.size() != events.size()
+                || response->start.size() != events.size()
+                || response->end.size() != events.size()) {
+            throw dcl::ProtocolException("Invalid event profiling info response");
+        }
+
+        for (unsigned int i = 0; i < events.size(); ++i) {
+            if (response->errcodes[i] == CL_SUCCESS) {
+                events[i]->onProfilingInfo(response->received[i],
+                        response->queued[i], response->submit[i],
+                        response->start[i], response->end[i]);
+            }
+        }
+
+        dcl::util::Logger << dcl::util::Info
+                << "Got event profiling info (command queue ID=" << _id
+                << ", events=" << events.size() << ')'
+                << std::endl;
+    } catch (const dcl::CLError& err) {
+        throw dclicd::Error(err);
+    } catch (const dcl::IOException& err) {
+        throw dclicd::Error(err);
+    } catch (const dcl::ProtocolException& err) {
+        throw dclicd::Error(err);
+    }
 }
 
 void _cl_command_queue::createEventIdWaitList(
 		const std::vector<cl_event>& event_wait_list,
 		std::vector<dcl::object_id>& eventIds) {
+    createEventIdWaitList(event_wait_list, eventIds,
+            std::vector<dcl::ComputeNode *>(1, &computeNode()));
+}
+
+void _cl_command_queue::createEventIdWaitList(
+		const std::vector<cl_event>& event_wait_list,
+		std::vector<dcl::object_id>& eventIds,
+		const std::vector<dcl::ComputeNode *>& computeNodes) {
 	eventIds.resize(event_wait_list.size());
 	for (unsigned int i = 0; i < event_wait_list.size(); ++i) {
 		cl_event event = event_wait_list[i];
@@ -263,6 +377,31 @@ void _cl_command_queue::createEventIdWaitList(
 		if (context != _context) throw dclicd::Error(CL_INVALID_CONTEXT);
 		eventIds[i] = event->remoteId();
 	}
+
+	/* Create substitute events on compute nodes which do not know the events yet */
+	for (auto event : event_wait_list) {
+	    for (auto computeNode : computeNodes) {
+	        event->subscribe(*computeNode);
+	    }
+	}
+}
+
+void _cl_command_queue::initializeMemoryObjects(
+        const std::vector<cl_mem>& memObjects) {
+    for (auto memObject : memObjects) {
+        /* Only buffers defer the upload of their initial data. dOpenCL does
+         * not implement images yet; their initial data must be uploaded
+         * eagerly when they are created. */
+        auto buffer = dynamic_cast<dclicd::Buffer *>(memObject);
+        if (buffer) buffer->initialize(this);
+    }
+}
+
+void _cl_command_queue::modifyMemoryObjects(
+        const std::vector<cl_mem>& memObjects) {
+    for (auto memObject : memObjects) {
+        memObject->coherenceDirectory().modify(computeNode());
+    }
 }
 
 void _cl_command_queue::enqueueCommand(
@@ -277,9 +416,76 @@ void _cl_command_queue::enqueueCommand(
 	_commands.push_back(command);
 }
 
+void _cl_command_queue::enqueueRequest(
+        dclasio::message::Request& request,
+        const std::shared_ptr<dclicd::command::Command>& command,
+        bool blocking) {
+#if defined(DCL_ASYNC_ENQUEUE)
+    if (!blocking) {
+        {
+            std::lock_guard<std::mutex> lock(_pendingRequestsMutex);
+            ++_pendingRequests;
+        }
+
+        try {
+            computeNode().sendRequest(request,
+                    std::bind(&_cl_command_queue::onResponse, this, command,
+                            std::placeholders::_1));
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_pendingRequestsMutex);
+            if (--_pendingRequests == 0) _pendingRequestsDone.notify_all();
+            throw;
+        }
+        return;
+    }
+#endif
+
+    computeNode().executeCommand(request);
+}
+
+void _cl_command_queue::onResponse(
+        const std::shared_ptr<dclicd::command::Command>& command,
+        cl_int errcode) {
+    if (errcode != CL_SUCCESS) {
+        dcl::util::Logger << dcl::util::Error
+                << "Asynchronous enqueue failed (command queue ID=" << _id
+                << ", command ID=" << (command ? command->remoteId() : 0)
+                << ", error=" << errcode
+                << ')' << std::endl;
+
+        /* The command will never be executed by the compute node. Its event
+         * is set to the error status just like for a command which failed
+         * remotely. */
+        if (command) command->onExecutionStatusChanged(errcode);
+    }
+
+    /* The pending request is completed last, as this command queue may be
+     * deleted as soon as no requests are pending (see finishLocally) */
+    std::lock_guard<std::mutex> lock(_pendingRequestsMutex);
+    if (errcode != CL_SUCCESS && _deferredError == CL_SUCCESS) {
+        _deferredError = errcode;
+    }
+    if (--_pendingRequests == 0) _pendingRequestsDone.notify_all();
+}
+
+cl_int _cl_command_queue::awaitPendingRequests() {
+    std::unique_lock<std::mutex> lock(_pendingRequestsMutex);
+    while (_pendingRequests > 0) {
+        _pendingRequestsDone.wait(lock);
+    }
+
+    cl_int errcode = _deferredError;
+    _deferredError = CL_SUCCESS;
+    return errcode;
+}
+
 void _cl_command_queue::finishLocally() {
     std::vector<std::shared_ptr<dclicd::command::Command>> commands;
 
+    /* Await responses to asynchronous enqueue requests, such that failed
+     * commands are not waited for forever */
+    awaitPendingRequests();
+
     /* Clean up command queue */
     {
         std::lock_guard<std::mutex> lock(_commandsMutex);
@@ -320,13 +526,16 @@ void _cl_command_queue::enqueueWaitForEvents(
 		if (context != _context) throw dclicd::Error(CL_INVALID_CONTEXT);
 		eventIds[i] = event->remoteId();
 	}
+	for (auto event : eventList) {
+	    event->subscribe(computeNode());
+	}
 
 	/*
 	 * Enqueue wait for events command on command queue's compute node
 	 */
 	try {
 		dclasio::message::EnqueueWaitForEvents request(_id, eventIds);
-		_device->remote().getComputeNode().executeCommand(request);
+		enqueueRequest(request, nullptr);
 		dcl::util::Logger << dcl::util::Info
 				<< "Enqueued wait for events (command queue ID=" << _id << ')'
 				<< std::endl;
@@ -342,6 +551,7 @@ void _cl_command_queue::enqueueWaitForEvents(
 
 void _cl_command_queue::enqueueMarker(
 		const std::vector<cl_event>& event_wait_list, cl_event *event) {
+    std::shared_ptr<dclicd::command::Command> marker;
     std::vector<dcl::object_id> eventIds;
 
     /* Convert event wait list */
@@ -349,8 +559,7 @@ void _cl_command_queue::enqueueMarker(
 
     /* Create event */
     if (event) {
-        std::shared_ptr<dclicd::command::Command> marker(
-                std::make_shared<dclicd::command::Command>(CL_COMMAND_MARKER, this));
+        marker = std::make_shared<dclicd::command::Command>(CL_COMMAND_MARKER, this);
         enqueueCommand(marker);
         *event = new dclicd::Event(_context, marker);
 //        *event = new dclicd::Event(_context, this, CL_COMMAND_MARKER);
@@ -362,7 +571,7 @@ void _cl_command_queue::enqueueMarker(
     try {
         dclasio::message::EnqueueMarker request(_id, (event ? (*event)->remoteId() : 0),
                 &eventIds, (event != nullptr));
-        _device->remote().getComputeNode().executeCommand(request);
+        enqueueRequest(request, marker);
         dcl::util::Logger << dcl::util::Info
                 << "Enqueued marker (command queue ID=" << _id
                 << ", command ID=" << (event ? (*event)->remoteId() : 0)
@@ -378,6 +587,7 @@ void _cl_command_queue::enqueueMarker(
 
 void _cl_command_queue::enqueueBarrier(
 		const std::vector<cl_event>& event_wait_list, cl_event *event) {
+    std::shared_ptr<dclicd::command::Command> barrier;
     std::vector<dcl::object_id> eventIds;
 
     /* Convert event wait list */
@@ -385,8 +595,7 @@ void _cl_command_queue::enqueueBarrier(
 
     /* Create event */
     if (event) {
-        std::shared_ptr<dclicd::command::Command> barrier(
-                std::make_shared<dclicd::command::Command>(CL_COMMAND_BARRIER, this));
+        barrier = std::make_shared<dclicd::command::Command>(CL_COMMAND_BARRIER, this);
         enqueueCommand(barrier);
         *event = new dclicd::Event(_context, barrier);
 //        *event = new dclicd::Event(_context, this, CL_COMMAND_BARRIER);
@@ -395,7 +604,7 @@ void _cl_command_queue::enqueueBarrier(
 	try {
         dclasio::message::EnqueueBarrier request(_id, (event ? (*event)->remoteId() : 0),
                 &eventIds, (event != nullptr));
-        _device->remote().getComputeNode().executeCommand(request);
+        enqueueRequest(request, barrier);
         dcl::util::Logger << dcl::util::Info
                 << "Enqueued barrier (command queue ID=" << _id
                 << ", command ID=" << (event ? (*event)->remoteId() : 0)
@@ -409,6 +618,50 @@ void _cl_command_queue::enqueueBarrier(
     }
 }
 
+std::shared_ptr<dclicd::command::Command> _cl_command_queue::enqueueUpload(
+        dclicd::Buffer *buffer,
+        size_t offset,
+        size_t cb,
+        const void *ptr) {
+    std::shared_ptr<dclicd::command::Command> upload;
+
+    assert(buffer != nullptr);
+
+    // Enqueue write buffer command locally
+    upload = std::make_shared<dclicd::command::WriteMemoryCommand>(
+            CL_COMMAND_WRITE_BUFFER, this, cb, ptr, pipelineChunkSize());
+    enqueueCommand(upload);
+
+    // Enqueue write buffer command on command queue's compute node
+    try {
+        dclasio::message::EnqueueWriteBuffer request(_id, upload->remoteId(),
+                buffer->remoteId(), false, offset, cb, pipelineChunkSize());
+        enqueueRequest(request, upload);
+
+        if (_properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) {
+            /* Order the upload before all subsequent commands */
+            dclasio::message::EnqueueBarrier barrier(_id, 0);
+            enqueueRequest(barrier, nullptr);
+        }
+
+        dcl::util::Logger << dcl::util::Info
+                << "Enqueued initial data upload to buffer (command queue ID=" << _id
+                << ", buffer ID=" << buffer->remoteId()
+                << ", offset=" << offset
+                << ", size=" << cb
+                << ", command ID=" << upload->remoteId()
+                << ')' << std::endl;
+    } catch (const dcl::CLError& err) {
+        throw dclicd::Error(err);
+    } catch (const dcl::IOException& err) {
+        throw dclicd::Error(err);
+    } catch (const dcl::ProtocolException& err) {
+        throw dclicd::Error(err);
+    }
+
+    return upload;
+}
+
 void _cl_command_queue::enqueueRead(
 		dclicd::Buffer *buffer,
 		cl_bool blocking_read,
@@ -427,9 +680,12 @@ void _cl_command_queue::enqueueRead(
 	// Convert event wait list
 	createEventIdWaitList(event_wait_list, eventIds);
 
+	// Upload initial data of buffer on first use on this compute node
+	buffer->initialize(this);
+
 	// Enqueue read buffer command locally
 	readBuffer = std::make_shared<dclicd::command::ReadMemoryCommand>(
-            CL_COMMAND_READ_BUFFER, this, cb, ptr);
+            CL_COMMAND_READ_BUFFER, this, cb, ptr, pipelineChunkSize());
 	enqueueCommand(readBuffer);
 
 	// Create event
@@ -440,9 +696,10 @@ void _cl_command_queue::enqueueRead(
 	// Enqueue read buffer command on command queue's compute node
 	try {
 		dclasio::message::EnqueueReadBuffer request(_id, readBuffer->remoteId(),
-				buffer->remoteId(), blocking_read, offset, cb, &eventIds,
+				buffer->remoteId(), blocking_read, offset, cb,
+				pipelineChunkSize(), &eventIds,
 				(event != nullptr));
-		_device->remote().getComputeNode().executeCommand(request);
+		enqueueRequest(request, readBuffer, blocking_read);
 		dcl::util::Logger << dcl::util::Info
 				<< "Enqueued data download from buffer (command queue ID="
 				<< _id << ", buffer ID=" << buffer->remoteId()
@@ -482,22 +739,28 @@ void _cl_command_queue::enqueueWrite(
 	// Convert event wait list
 	createEventIdWaitList(event_wait_list, eventIds);
 
+	/* Upload initial data of buffer on first use on this compute node
+	 * The buffer may only be written partially by this command */
+	buffer->initialize(this);
+
 	// Enqueue write buffer command locally
 	writeBuffer = std::make_shared<dclicd::command::WriteMemoryCommand>(
-            CL_COMMAND_WRITE_BUFFER, this, cb, ptr);
+            CL_COMMAND_WRITE_BUFFER, this, cb, ptr, pipelineChunkSize());
 	enqueueCommand(writeBuffer);
 
+	buffer->coherenceDirectory().modify(computeNode(), offset, cb);
+
 	// Create event
 	if (event) {
-		*event = new dclicd::Event(_context, writeBuffer, std::vector<cl_mem>(1, buffer));
+		*event = new dclicd::Event(_context, writeBuffer, std::vector<cl_mem>(1, buffer), offset, cb);
 	}
 
 	// Enqueue write buffer command on command queue's compute node
 	try {
 		dclasio::message::EnqueueWriteBuffer enqueueWriteBuffer(_id,
 				writeBuffer->remoteId(), buffer->remoteId(), blocking_write,
-				offset, cb, &eventIds, (event != nullptr));
-		_device->remote().getComputeNode().executeCommand(enqueueWriteBuffer);
+				offset, cb, pipelineChunkSize(), &eventIds, (event != nullptr));
+		enqueueRequest(enqueueWriteBuffer, writeBuffer, blocking_write);
 		dcl::util::Logger << dcl::util::Info
 				<< "Enqueued data upload to buffer (command queue ID=" << _id
 				<< ", buffer ID=" << buffer->remoteId()
@@ -528,6 +791,7 @@ void _cl_command_queue::enqueueCopy(
 		size_t cb,
 		const std::vector<cl_event>& event_wait_list,
 		cl_event *event) {
+	std::shared_ptr<dclicd::command::Command> copyBuffer;
 	std::vector<dcl::object_id> eventIds;
 
     if (!src) throw dclicd::Error(CL_INVALID_MEM_OBJECT);
@@ -540,12 +804,17 @@ void _cl_command_queue::enqueueCopy(
 	// Convert event wait list
 	createEventIdWaitList(event_wait_list, eventIds);
 
+	// Upload initial data of buffers on first use on this compute node
+	src->initialize(this);
+	dst->initialize(this);
+
+	dst->coherenceDirectory().modify(computeNode(), dst_offset, cb);
+
 	// Create event
 	if (event) {
-        std::shared_ptr<dclicd::command::Command> copyBuffer(
-                std::make_shared<dclicd::command::Command>(CL_COMMAND_COPY_BUFFER, this));
+        copyBuffer = std::make_shared<dclicd::command::Command>(CL_COMMAND_COPY_BUFFER, this);
         enqueueCommand(copyBuffer);
-		*event = new dclicd::Event(_context, copyBuffer, std::vector<cl_mem>(1, dst));
+		*event = new dclicd::Event(_context, copyBuffer, std::vector<cl_mem>(1, dst), dst_offset, cb);
 //        *event = new dclicd::Event(_context, this, CL_COMMAND_COPY_BUFFER);
 	}
 
@@ -553,7 +822,7 @@ void _cl_command_queue::enqueueCopy(
 		dclasio::message::EnqueueCopyBuffer request(_id, (event ? (*event)->remoteId() : 0),
 				src->remoteId(), dst->remoteId(), src_offset, dst_offset, cb,
 				&eventIds, (event != nullptr));
-		_device->remote().getComputeNode().executeCommand(request);
+		enqueueRequest(request, copyBuffer);
 		dcl::util::Logger << dcl::util::Info
 				<< "Enqueued copy buffer (command queue ID=" << _id
 				<< ", src buffer ID=" << src->remoteId()
@@ -594,9 +863,21 @@ void * _cl_command_queue::enqueueMap(
     // Convert event wait list
     createEventIdWaitList(event_wait_list, eventIds);
 
+    // Upload initial data of buffer on first use on this compute node
+    buffer->initialize(this);
+
+    /* The mapped region needs not be downloaded, if the host holds a valid
+     * replica of the buffer */
+    if ((map_flags & CL_MAP_READ) && buffer->coherenceDirectory().lookupHost(offset, cb)) {
+        dcl::util::Logger << dcl::util::Debug
+                << "Mapping buffer from host replica (ID=" << buffer->remoteId() << ')'
+                << std::endl;
+        map_flags &= ~CL_MAP_READ;
+    }
+
 	// Enqueue map buffer command locally
 	mapBuffer = std::make_shared<dclicd::command::MapBufferCommand>(
-            this, buffer, map_flags, cb, ptr);
+            this, buffer, map_flags, offset, cb, ptr);
 	enqueueCommand(mapBuffer);
 
 	// Create event
@@ -609,7 +890,7 @@ void * _cl_command_queue::enqueueMap(
                 buffer->remoteId(), blocking_map, map_flags,
                 offset, cb,
                 &eventIds, (event != nullptr));
-        _device->remote().getComputeNode().executeCommand(request);
+        enqueueRequest(request, mapBuffer, blocking_map);
         dcl::util::Logger << dcl::util::Info
                 << "Enqueued map buffer (command queue ID=" << _id
                 << ", buffer ID=" << buffer->remoteId()
@@ -668,13 +949,21 @@ void _cl_command_queue::enqueueUnmap(
 	        this, buffer, mapping->flags(), mapping->cb(), mapped_ptr);
 	enqueueCommand(unmapMemory);
 
+	if (mapping->flags() & CL_MAP_WRITE) {
+	    /* The changes are uploaded from the buffer's host replica, which
+	     * therefore includes these changes */
+	    buffer->coherenceDirectory().modify(computeNode(),
+	            mapping->offset(), mapping->cb(), true);
+	}
+
 	// Create event
 	if (event) {
         if (mapping->flags() & CL_MAP_WRITE) {
             /* The memory object had been mapped for writing. Thus, the unmap
              * operation modifies the memory object which is therefore
              * associated with the unmap event. */
-            *event = new dclicd::Event(_context, unmapMemory, std::vector<cl_mem>(1, memobj));
+            *event = new dclicd::Event(_context, unmapMemory, std::vector<cl_mem>(1, memobj),
+                    mapping->offset(), mapping->cb());
         } else {
             *event = new dclicd::Event(_context, unmapMemory);
         }
@@ -688,7 +977,7 @@ void _cl_command_queue::enqueueUnmap(
                     memobj->remoteId(), mapping->flags(),
                     mapping->offset(), mapping->cb(),
                     &eventIds, (event != nullptr));
-            _device->remote().getComputeNode().executeCommand(request);
+            enqueueRequest(request, unmapMemory);
             break;
         }
         case CL_MEM_OBJECT_IMAGE2D:
@@ -731,6 +1020,7 @@ void _cl_command_queue::enqueueNDRangeKernel(
 		const std::vector<size_t>& local,
 		const std::vector<cl_event>& event_wait_list,
 		cl_event *event) {
+	std::shared_ptr<dclicd::command::Command> nDRangeKernel;
 	std::vector<dcl::object_id> eventIds;
 
 	if (!kernel) throw dclicd::Error(CL_INVALID_KERNEL);
@@ -740,9 +1030,15 @@ void _cl_command_queue::enqueueNDRangeKernel(
 	/* Convert event wait list */
 	createEventIdWaitList(event_wait_list, eventIds);
 
+	/* Upload initial data of kernel arguments on first use on this compute node */
+	initializeMemoryObjects(kernel->memoryObjects());
+
+	/* Kernels cannot be analyzed, such that all writable memory objects are
+	 * considered modified */
+	modifyMemoryObjects(kernel->writeMemoryObjects());
+
 	if (event) {
-        std::shared_ptr<dclicd::command::Command> nDRangeKernel(
-                std::make_shared<dclicd::command::Command>(CL_COMMAND_NDRANGE_KERNEL, this));
+        nDRangeKernel = std::make_shared<dclicd::command::Command>(CL_COMMAND_NDRANGE_KERNEL, this);
         enqueueCommand(nDRangeKernel);
 		*event = new dclicd::Event(_context, nDRangeKernel, kernel->writeMemoryObjects());
 //        *event = new dclicd::Event(_context, this, CL_COMMAND_NDRANGE_KERNEL);
@@ -755,7 +1051,14 @@ void _cl_command_queue::enqueueNDRangeKernel(
 		dclasio::message::EnqueueNDRangeKernel request(
 				_id, (event ? (*event)->remoteId() : 0), kernel->remoteId(),
 				offset, global, local, &eventIds, (event != nullptr));
-		_device->remote().getComputeNode().executeCommand(request);
+		auto arguments = kernel->packChangedArguments(computeNode(), request);
+		try {
+		    enqueueRequest(request, nDRangeKernel);
+		} catch (...) {
+		    /* The changed arguments have not been set on the compute node */
+		    kernel->invalidateArguments(computeNode(), arguments);
+		    throw;
+		}
 		dcl::util::Logger << dcl::util::Info
 				<< "Enqueued ND range kernel (command queue ID=" << _id
 				<< ", kernel ID=" << kernel->remoteId()
@@ -774,6 +1077,7 @@ void _cl_command_queue::enqueueTask(
         cl_kernel kernel,
         const std::vector<cl_event>& event_wait_list,
         cl_event *event) {
+    std::shared_ptr<dclicd::command::Command> task;
     std::vector<dcl::object_id> eventIds;
 
     if (!kernel) throw dclicd::Error(CL_INVALID_KERNEL);
@@ -783,9 +1087,15 @@ void _cl_command_queue::enqueueTask(
     /* Convert event wait list */
     createEventIdWaitList(event_wait_list, eventIds);
 
+    /* Upload initial data of kernel arguments on first use on this compute node */
+    initializeMemoryObjects(kernel->memoryObjects());
+
+    /* Kernels cannot be analyzed, such that all writable memory objects are
+     * considered modified */
+    modifyMemoryObjects(kernel->writeMemoryObjects());
+
     if (event) {
-        std::shared_ptr<dclicd::command::Command> task(
-                std::make_shared<dclicd::command::Command>(CL_COMMAND_TASK, this));
+        task = std::make_shared<dclicd::command::Command>(CL_COMMAND_TASK, this);
         enqueueCommand(task);
         *event = new dclicd::Event(_context, task, kernel->writeMemoryObjects());
 //        *event = new dclicd::Event(_context, this, CL_COMMAND_TASK);
@@ -802,7 +1112,14 @@ void _cl_command_queue::enqueueTask(
                 _id, (event ? (*event)->remoteId() : 0), kernel->remoteId(),
                 std::vector<size_t>(), std::vector<size_t>(1, 1), std::vector<size_t>(1, 1),
                 &eventIds, (event != nullptr));
-        _device->remote().getComputeNode().executeCommand(request);
+        auto arguments = kernel->packChangedArguments(computeNode(), request);
+        try {
+            enqueueRequest(request, task);
+        } catch (...) {
+            /* The changed arguments have not been set on the compute node */
+            kernel->invalidateArguments(computeNode(), arguments);
+            throw;
+        }
         dcl::util::Logger << dcl::util::Info
                 << "Enqueued task (command queue ID=" << _id
                 << ", kernel ID=" << kernel->remoteId()
@@ -827,9 +1144,12 @@ void _cl_command_queue::enqueueBroadcast(
 		const std::vector<cl_event>& event_wait_list,
 		cl_event *event) {
 	cl_context context;
+	std::vector<dcl::ComputeNode *> computeNodes; // participating compute nodes
+	std::map<dcl::ComputeNode *, cl_command_queue> nodeCommandQueues;
 	std::map<dcl::ComputeNode *, std::vector<dcl::object_id>> nodeCommandQueueIds;
-	std::map<dcl::ComputeNode *, std::set<dcl::object_id>> nodeDstIds;
+	std::map<dcl::ComputeNode *, std::vector<dcl::object_id>> nodeDstIds;
     std::map<dcl::ComputeNode *, std::vector<size_t>> nodeDstOffsets;
+    std::set<dcl::object_id> dstIds;
 	std::vector<dcl::object_id> eventIds;
 
 	if (!src) throw dclicd::Error(CL_INVALID_MEM_OBJECT);
@@ -863,66 +1183,163 @@ void _cl_command_queue::enqueueBroadcast(
 
 		/* TODO Offset of destination buffer must specify valid buffer region */
 
-		computeNode = &queue->computeNode();
-
-		nodeCommandQueueIds[computeNode].push_back(queue->remoteId());
-		inserted = nodeDstIds[computeNode].insert(dst->remoteId()).second;
+		inserted = dstIds.insert(dst->remoteId()).second;
 		if (!inserted) {
 		    /* destination buffer specified more than once */
 		    throw dclicd::Error(CL_INVALID_VALUE);
 		}
+
+		computeNode = &queue->computeNode();
+
+		if (nodeCommandQueues.insert(std::make_pair(computeNode, queue)).second) {
+		    computeNodes.push_back(computeNode);
+		}
+		nodeCommandQueueIds[computeNode].push_back(queue->remoteId());
+		nodeDstIds[computeNode].push_back(dst->remoteId());
 		nodeDstOffsets[computeNode].push_back(offset);
 	}
 
-	/* Convert event wait list */
-	commandQueueList[0]->createEventIdWaitList(event_wait_list, eventIds);
+	/* Use a compute node which already holds the source range as root of
+	 * the broadcast, such that the data need not be acquired first */
+	auto root = std::find_if(std::begin(computeNodes), std::end(computeNodes),
+	        [src, srcOffset, cb](dcl::ComputeNode *computeNode) {
+	    return src->coherenceDirectory().isValid(computeNode, srcOffset, cb);
+	});
+	if (root != std::end(computeNodes)) {
+	    std::rotate(std::begin(computeNodes), root, root + 1);
+	}
+
+	/* Upload initial data of buffers to compute nodes on first use */
+	for (size_t l = 0; l < dsts.size(); ++l) {
+	    dsts[l]->initialize(commandQueueList[l]);
+	}
+
+	/* Convert event wait list
+	 * Only the roots of the broadcast wait for the events */
+	commandQueueList[0]->createEventIdWaitList(event_wait_list, eventIds,
+	        dclicd::Event::isNodeToNodeEnabled()
+	                ? std::vector<dcl::ComputeNode *>(1, computeNodes.front())
+	                : computeNodes);
+
+	/* Record modification of destination buffers */
+	for (size_t l = 0; l < dsts.size(); ++l) {
+	    dsts[l]->coherenceDirectory().modify(commandQueueList[l]->computeNode(),
+	            dstOffsets[l], cb);
+	}
 
-//	if (event) {
-//	    try {
-//	        /* TODO Create broadcast command */
-//	        *event = new dclicd::Event(context, broadcast);
-//	    } catch (const std::bad_alloc&) {
-//	        throw dclicd::Error(CL_OUT_OF_RESOURCES);
-//	    }
-//	}
+	/* Create a broadcast command for each compute node, which is completed by
+	 * that compute node when its destination buffers have been written. The
+	 * event is created before the requests, as they refer to the commands. */
+	std::map<dcl::ComputeNode *, std::shared_ptr<dclicd::command::Command>> nodeCommands;
+	if (event) {
+	    for (auto computeNode : computeNodes) {
+	        cl_command_queue queue = nodeCommandQueues[computeNode];
+	        auto broadcast = std::make_shared<dclicd::command::Command>(
+	                CL_COMMAND_BROADCAST_BUFFER_WWU, queue);
+	        queue->enqueueCommand(broadcast);
+	        nodeCommands[computeNode] = broadcast;
+	    }
+
+	    try {
+	        if (computeNodes.size() > 1) {
+	            /* The event is completed by the host when the broadcast
+	             * commands of all compute nodes have completed (see
+	             * enqueueWriteBuffers) */
+	            auto compoundEvent = new dclicd::CompoundEvent(context,
+	                    CL_COMMAND_BROADCAST_BUFFER_WWU,
+	                    nodeCommandQueues[computeNodes.front()], computeNodes.size());
+	            for (auto computeNode : computeNodes) {
+	                nodeCommands[computeNode]->setCompletionHandler(std::bind(
+	                        &dclicd::CompoundEvent::onCommandComplete, compoundEvent,
+	                        std::placeholders::_1));
+	            }
+	            *event = compoundEvent;
+	        } else {
+	            *event = new dclicd::Event(context, nodeCommands[computeNodes.front()],
+	                    std::vector<cl_mem>(std::begin(dsts), std::end(dsts)));
+	        }
+	    } catch (const std::bad_alloc&) {
+	        throw dclicd::Error(CL_OUT_OF_RESOURCES);
+	    }
+	}
 
 	/*
 	 * Enqueue broadcast (remote operation)
+	 *
+	 * The compute nodes form a binomial tree with the root at rank 0: the
+	 * parent of rank r is r without its highest bit, and the children of r
+	 * are r + 2^n for all 2^n > r. Thus, each compute node sends the data to
+	 * at most log2(N) children, and the broadcast completes in log2(N) steps.
+	 * If node-to-node synchronization is disabled, every compute node is a
+	 * root that obtains the source buffer from the host.
 	 */
 	try {
-	    auto i = std::begin(nodeCommandQueueIds);
-        auto j = std::begin(nodeDstIds);
-        auto k = std::begin(nodeDstOffsets);
-        std::vector<std::pair<dcl::ComputeNode *, dclasio::message::EnqueueBroadcastBuffer>> requests;
+	    const bool nodeToNode = dclicd::Event::isNodeToNodeEnabled();
+	    const size_t size = computeNodes.size();
+        std::vector<std::vector<std::pair<dcl::ComputeNode *, dclasio::message::EnqueueBroadcastBuffer>>> levels;
+
+        for (auto computeNode : computeNodes) {
+            if (!nodeToNode || computeNode == computeNodes.front()) {
+                src->initialize(nodeCommandQueues[computeNode]);
+            }
+        }
 
         /*
-         * Create and send requests
+         * Create requests
          */
-        for (; i != std::end(nodeCommandQueueIds) && j != std::end(nodeDstIds); ++i, ++j) {
-            auto computeNode = i->first;
+        for (size_t rank = 0; rank < size; ++rank) {
+            auto computeNode = computeNodes[rank];
+            std::string parentUrl;
+            std::vector<dcl::process_id> childIds;
+            size_t level = 0;
+
+            if (nodeToNode) {
+                size_t n = 1;
+                while (n <= rank) {
+                    if (rank & n) ++level;
+                    n <<= 1;
+                }
+                if (rank > 0) parentUrl = computeNodes[rank - (n >> 1)]->url();
+                for (; rank + n < size; n <<= 1) {
+                    childIds.push_back(computeNodes[rank + n]->get_id());
+                }
+            }
+
             /* TODO Avoid copying 'enqueue broadcast buffer' requests */
             dclasio::message::EnqueueBroadcastBuffer request(
-                    i->second, (event ? (*event)->remoteId() : 0),
+                    nodeCommandQueueIds[computeNode],
+                    (event ? nodeCommands[computeNode]->remoteId() : 0),
                     src->remoteId(),
-                    std::vector<dcl::object_id>(std::begin(j->second), std::end(j->second)),
-                    srcOffset, k->second, cb,
-                    &eventIds, (event != nullptr));
-            computeNode->sendRequest(request);
-
-            requests.push_back(std::make_pair(computeNode, request)); // save pending request
+                    nodeDstIds[computeNode],
+                    srcOffset, nodeDstOffsets[computeNode], cb,
+                    parentUrl, childIds,
+                    (parentUrl.empty() ? &eventIds : nullptr), (event != nullptr));
+            if (levels.size() <= level) levels.resize(level + 1);
+            levels[level].push_back(std::make_pair(computeNode, request));
         }
 
         /*
-         * Await responses from all compute nodes
+         * Send requests and await responses
+         *
+         * Compute nodes connect to their parent when receiving their request.
+         * Hence, requests are sent level by level starting at the leaves, such
+         * that a compute node's children have connected before it looks them
+         * up, and the root is sent its request last.
          */
-        for (auto request : requests) {
-            request.first->awaitResponse(request.second);
-            /* TODO Receive responses from *all* compute nodes, i.e. do not stop receipt on first failure */
+        for (auto requests = levels.rbegin(); requests != levels.rend(); ++requests) {
+            for (auto& request : *requests) {
+                request.first->sendRequest(request.second);
+            }
+            for (auto& request : *requests) {
+                request.first->awaitResponse(request.second);
+                /* TODO Receive responses from *all* compute nodes, i.e. do not stop receipt on first failure */
+            }
         }
 
 		dcl::util::Logger << dcl::util::Info
 				<< "Enqueued broadcast buffer (src buffer ID=" << src->remoteId()
                 << ", command ID=" << (event ? (*event)->remoteId() : 0)
+                << ", compute nodes=" << size
 				<< ')' << std::endl;
 	} catch (const dcl::CLError& err) {
 		throw dclicd::Error(err);
@@ -933,6 +1350,176 @@ void _cl_command_queue::enqueueBroadcast(
 	}
 }
 
+void _cl_command_queue::enqueueWriteBuffers(
+        std::vector<cl_command_queue> commandQueueList,
+        std::vector<dclicd::Buffer *> buffers,
+        const std::vector<size_t> offsets,
+        size_t cb,
+        const void *ptr,
+        const std::vector<cl_event>& event_wait_list,
+        cl_event *event) {
+    cl_context context;
+    std::vector<dcl::ComputeNode *> computeNodes; // participating compute nodes
+    std::map<dcl::ComputeNode *, cl_command_queue> nodeCommandQueues;
+    std::map<dcl::ComputeNode *, std::vector<dcl::object_id>> nodeCommandQueueIds;
+    std::map<dcl::ComputeNode *, std::vector<dcl::object_id>> nodeBufferIds;
+    std::map<dcl::ComputeNode *, std::vector<cl_mem>> nodeBuffers;
+    std::map<dcl::ComputeNode *, std::vector<size_t>> nodeOffsets;
+    std::set<dcl::object_id> bufferIds;
+    std::vector<dcl::object_id> eventIds;
+
+    if (commandQueueList.empty() || buffers.empty()) {
+        throw dclicd::Error(CL_INVALID_VALUE);
+    }
+    if (cb == 0 || !ptr) throw dclicd::Error(CL_INVALID_VALUE);
+
+    /*
+     * Validate command queues and buffers
+     * Create ID lists
+     */
+    assert(commandQueueList.size() == buffers.size());
+    assert(offsets.size() == buffers.size());
+    context = commandQueueList.front() ? commandQueueList.front()->_context : nullptr;
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        cl_command_queue queue = commandQueueList[i];
+        cl_mem buffer = buffers[i];
+        dcl::ComputeNode *computeNode;
+
+        if (!queue) throw dclicd::Error(CL_INVALID_COMMAND_QUEUE);
+        if (queue->_context != context) throw dclicd::Error(CL_INVALID_CONTEXT);
+        if (!buffer) throw dclicd::Error(CL_INVALID_MEM_OBJECT);
+        if (buffer->context() != context) throw dclicd::Error(CL_INVALID_CONTEXT);
+
+        if (!bufferIds.insert(buffer->remoteId()).second) {
+            /* buffer specified more than once */
+            throw dclicd::Error(CL_INVALID_VALUE);
+        }
+
+        computeNode = &queue->computeNode();
+
+        if (nodeCommandQueues.insert(std::make_pair(computeNode, queue)).second) {
+            computeNodes.push_back(computeNode);
+        }
+        nodeCommandQueueIds[computeNode].push_back(queue->remoteId());
+        nodeBufferIds[computeNode].push_back(buffer->remoteId());
+        nodeBuffers[computeNode].push_back(buffer);
+        nodeOffsets[computeNode].push_back(offsets[i]);
+    }
+
+    /* Convert event wait list
+     * Only the first compute node of each chain waits for the events */
+    commandQueueList.front()->createEventIdWaitList(event_wait_list, eventIds,
+            dclicd::Event::isNodeToNodeEnabled()
+                    ? std::vector<dcl::ComputeNode *>(1, computeNodes.front())
+                    : computeNodes);
+
+    /* Upload initial data of buffers on first use on their compute nodes
+     * The buffers may only be written partially by this command */
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        buffers[i]->initialize(commandQueueList[i]);
+    }
+
+    /* Record modification of buffers */
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        buffers[i]->coherenceDirectory().modify(
+                commandQueueList[i]->computeNode(), offsets[i], cb);
+    }
+
+    /*
+     * Enqueue multicast upload (remote operation)
+     *
+     * The compute nodes form a chain: the host memory is uploaded to the first
+     * compute node only, and each compute node forwards the data chunk by chunk
+     * to the next one while still receiving it. Thus, the host memory is read
+     * and sent once, and the data transfers between compute nodes overlap.
+     * If node-to-node synchronization is disabled, every compute node forms a
+     * chain of its own and obtains the data from the host.
+     */
+    try {
+        const bool nodeToNode = dclicd::Event::isNodeToNodeEnabled();
+        const size_t chunkSize = pipelineChunkSize();
+        std::vector<std::vector<dcl::ComputeNode *>> chains;
+
+        dclicd::CompoundEvent *compoundEvent = nullptr;
+
+        if (nodeToNode) {
+            chains.push_back(computeNodes);
+        } else {
+            for (auto computeNode : computeNodes) {
+                chains.push_back(std::vector<dcl::ComputeNode *>(1, computeNode));
+            }
+        }
+
+        if (event && chains.size() > 1) {
+            /* The event is completed by the host when the upload commands of
+             * all chains have completed */
+            compoundEvent = new dclicd::CompoundEvent(context,
+                    CL_COMMAND_WRITE_BUFFER, commandQueueList.front(), chains.size());
+            *event = compoundEvent;
+        }
+
+        for (const auto& chain : chains) {
+            cl_command_queue head = nodeCommandQueues[chain.front()];
+            std::shared_ptr<dclicd::command::Command> upload;
+
+            /* Enqueue upload command locally on the first compute node */
+            upload = std::make_shared<dclicd::command::WriteMemoryCommand>(
+                    CL_COMMAND_WRITE_BUFFER, head, cb, ptr, chunkSize);
+            head->enqueueCommand(upload);
+
+            if (compoundEvent) {
+                upload->setCompletionHandler(std::bind(
+                        &dclicd::CompoundEvent::onCommandComplete, compoundEvent,
+                        std::placeholders::_1));
+            } else if (event) {
+                /* Commands waiting for the event acquire the buffers from the
+                 * first compute node, which completes the upload */
+                *event = new dclicd::Event(context, upload, nodeBuffers[chain.front()]);
+            }
+
+            /*
+             * Send requests
+             *
+             * Compute nodes connect to their predecessor when receiving their
+             * request. Hence, requests are sent from the last to the first
+             * compute node of the chain, such that each compute node's
+             * successor has connected before.
+             */
+            for (size_t rank = chain.size(); rank-- > 0; ) {
+                auto computeNode = chain[rank];
+
+                dclasio::message::EnqueueWriteBuffers request(
+                        nodeCommandQueueIds[computeNode], upload->remoteId(),
+                        nodeBufferIds[computeNode], nodeOffsets[computeNode],
+                        cb, chunkSize,
+                        (rank > 0 ? chain[rank - 1]->url() : std::string()),
+                        (rank + 1 < chain.size() ? chain[rank + 1]->get_id() : 0),
+                        (rank == 0 ? &eventIds : nullptr),
+                        (event != nullptr && rank == 0));
+                if (rank > 0) {
+                    computeNode->sendRequest(request);
+                    computeNode->awaitResponse(request);
+                } else {
+                    /* The first compute node completes the upload command */
+                    head->enqueueRequest(request, upload);
+                }
+            }
+
+            dcl::util::Logger << dcl::util::Info
+                    << "Enqueued multicast upload to buffers (command ID=" << upload->remoteId()
+                    << ", size=" << cb
+                    << ", compute nodes=" << chain.size()
+                    << ')' << std::endl;
+        }
+    } catch (const dcl::CLError& err) {
+        throw dclicd::Error(err);
+    } catch (const dcl::IOException& err) {
+        throw dclicd::Error(err);
+    } catch (const dcl::ProtocolException& err) {
+        throw dclicd::Error(err);
+    }
+}
+
 void _cl_command_queue::enqueueReduce(
 		std::vector<dclicd::Buffer *> srcs,
 		dclicd::Buffer *dst,
@@ -947,7 +1534,6 @@ void _cl_command_queue::enqueueReduce(
 		const std::vector<cl_event>& event_wait_list,
 		cl_event *event) {
 	cl_context context;
-	std::vector<dcl::object_id> srcIds;
 	std::vector<dcl::object_id> eventIds;
 
     if (!dst) throw dclicd::Error(CL_INVALID_MEM_OBJECT);
@@ -957,13 +1543,10 @@ void _cl_command_queue::enqueueReduce(
 
 	/*
 	 * Validate source buffers
-	 * Create ID lists
 	 */
 	for (auto src : srcs) {
 		if (!src) throw dclicd::Error(CL_INVALID_MEM_OBJECT);
 		if (src->context() != context) throw dclicd::Error(CL_INVALID_CONTEXT);
-
-		srcIds.push_back(src->remoteId());
 	}
 
 	/*
@@ -971,31 +1554,157 @@ void _cl_command_queue::enqueueReduce(
 	 */
 	if (kernel->program()->context() != context) throw dclicd::Error(CL_INVALID_CONTEXT);
 
-	/* Convert event wait list */
-    createEventIdWaitList(event_wait_list, eventIds);
+	/*
+	 * Assign source buffers to compute nodes
+	 *
+	 * A source buffer is reduced on a compute node which holds a valid
+	 * replica of it, preferably on this command queue's compute node (the
+	 * root). Source buffers without a replica on any compute node are
+	 * uploaded to the root.
+	 */
+	std::vector<dcl::ComputeNode *> computeNodes(1, &computeNode());
+	std::map<dcl::ComputeNode *, std::vector<dcl::object_id>> nodeSrcIds;
+	const bool nodeToNode = dclicd::Event::isNodeToNodeEnabled();
 
-//    if (event) {
-//        try {
-//            /* TODO Create reduce command */
-//            *event = new dclicd::Event(context, *reduce);
-//        } catch (const std::bad_alloc&) {
-//            throw dclicd::Error(CL_OUT_OF_RESOURCES);
-//        }
-//    }
+	for (auto src : srcs) {
+	    dcl::ComputeNode *srcNode = &computeNode();
+	    size_t size;
+
+	    src->getInfo(CL_MEM_SIZE, sizeof(size), &size, nullptr);
+	    if (nodeToNode && !src->coherenceDirectory().isValid(srcNode, 0, size)) {
+	        for (auto node : context->computeNodes()) {
+	            if (src->coherenceDirectory().isValid(node, 0, size)) {
+	                srcNode = node;
+	                break;
+	            }
+	        }
+	    }
+	    if (srcNode == &computeNode()) src->initialize(this);
+
+	    if (nodeSrcIds.find(srcNode) == std::end(nodeSrcIds)) {
+	        if (srcNode != &computeNode()) computeNodes.push_back(srcNode);
+	    }
+	    nodeSrcIds[srcNode].push_back(src->remoteId());
+	}
+
+	/* Convert event wait list; all compute nodes of the reduction wait for the events */
+    createEventIdWaitList(event_wait_list, eventIds, computeNodes);
+
+    /* Upload initial data of kernel arguments on first use on this compute node */
+    initializeMemoryObjects(kernel->memoryObjects());
+
+    /* Record modification of destination buffer */
+    dst->coherenceDirectory().modify(computeNode());
+
+    /* The reduce command is completed by the root of the reduction, when the
+     * result has been written to the destination buffer. The event is
+     * created before the requests, as they refer to the command. */
+    std::shared_ptr<dclicd::command::Command> reduce;
+    if (event) {
+        reduce = std::make_shared<dclicd::command::Command>(
+                CL_COMMAND_REDUCE_BUFFER_WWU, this);
+        enqueueCommand(reduce);
+
+        try {
+            *event = new dclicd::Event(context, reduce, std::vector<cl_mem>(1, dst));
+        } catch (const std::bad_alloc&) {
+            throw dclicd::Error(CL_OUT_OF_RESOURCES);
+        }
+    }
 
     /*
 	 * Enqueue reduction (remote operation)
+	 *
+	 * The compute nodes form a binomial tree with the root at rank 0 (see
+	 * enqueueBroadcast). Partial results are sent from children to parents,
+	 * such that each compute node receives at most log2(N) partial results.
 	 */
 	try {
-		dclasio::message::EnqueueReduceBuffer request(
-				_id, (event ? (*event)->remoteId() : 0),
-				srcIds, dst->remoteId(),
-				kernel->remoteId(), offset, global, local,
-				&eventIds, (event != nullptr));
-		executeCommand(context->computeNodes(), request);
+	    const size_t size = computeNodes.size();
+	    std::vector<std::vector<std::pair<dcl::ComputeNode *, dclasio::message::EnqueueReduceBuffer>>> levels;
+	    std::map<dcl::ComputeNode *, std::vector<cl_uint>> nodeArguments;
+
+	    /*
+	     * Create requests
+	     */
+	    for (size_t rank = 0; rank < size; ++rank) {
+	        auto node = computeNodes[rank];
+	        dcl::process_id parentId = 0;
+	        std::vector<std::string> childUrls;
+	        dcl::object_id deviceId = 0;
+	        size_t level = 0;
+
+	        size_t n = 1;
+	        while (n <= rank) {
+	            if (rank & n) ++level;
+	            n <<= 1;
+	        }
+	        if (rank > 0) parentId = computeNodes[rank - (n >> 1)]->get_id();
+	        for (; rank + n < size; n <<= 1) {
+	            childUrls.push_back(computeNodes[rank + n]->url());
+	        }
+
+	        if (rank > 0) {
+	            /* The reduction is performed by any device of the context on
+	             * this compute node */
+	            for (auto device : context->devices()) {
+	                if (&device->remote().getComputeNode() == node) {
+	                    deviceId = device->remote().getId();
+	                    break;
+	                }
+	            }
+	        }
+
+	        /* TODO Avoid copying 'enqueue reduce buffer' requests */
+	        dclasio::message::EnqueueReduceBuffer request(
+	                (rank == 0 ? _id : 0), (reduce ? reduce->remoteId() : 0),
+	                nodeSrcIds[node], dst->remoteId(),
+	                kernel->remoteId(), offset, global, local,
+	                context->remoteId(), deviceId, parentId, childUrls,
+	                &eventIds, (event != nullptr && rank == 0));
+	        nodeArguments[node] = kernel->packChangedArguments(*node, request);
+
+	        if (levels.size() <= level) levels.resize(level + 1);
+	        levels[level].push_back(std::make_pair(node, request));
+	    }
+
+	    /*
+	     * Send requests and await responses
+	     *
+	     * Compute nodes connect to their children when receiving their
+	     * request. Hence, requests are sent level by level, such that a
+	     * compute node's parent has connected before it starts sending.
+	     */
+	    try {
+	        for (auto& requests : levels) {
+	            for (auto& request : requests) {
+	                request.first->sendRequest(request.second);
+	            }
+	            for (auto& request : requests) {
+	                request.first->awaitResponse(request.second);
+	                /* TODO Receive responses from *all* compute nodes, i.e. do not stop receipt on first failure */
+	            }
+	        }
+	    } catch (...) {
+	        /* The changed arguments may not have been set on the compute nodes,
+	         * while the combining kernel's first two arguments may have been
+	         * overwritten already */
+	        for (const auto& arguments : nodeArguments) {
+	            kernel->invalidateArguments(*arguments.first, arguments.second);
+	            kernel->invalidateArguments(*arguments.first, { 0, 1 });
+	        }
+	        throw;
+	    }
+
+	    /* The combining kernel's first two arguments have been overwritten */
+	    for (auto node : computeNodes) {
+	        kernel->invalidateArguments(*node, { 0, 1 });
+	    }
+
 		dcl::util::Logger << dcl::util::Info
 				<< "Enqueued reduce buffer (dst buffer ID=" << dst->remoteId()
-                << ", command ID=" << (event ? (*event)->remoteId() : 0)
+                << ", command ID=" << (reduce ? reduce->remoteId() : 0)
+                << ", compute nodes=" << size
 				<< ')' << std::endl;
 	} catch (const dcl::CLError& err) {
 		throw dclicd::Error(err);
@@ -50,6 +50,8 @@
 
 #include "dclicd/command/Command.h"
 
+#include <dclasio/message/Request.h>
+
 #include <dcl/CommandQueueListener.h>
 #include <dcl/ComputeNode.h>
 #include <dcl/DataTransfer.h>
@@ -62,15 +64,19 @@
 #include <CL/cl.h>
 #endif
 
+#include <condition_variable>
 #include <cstddef>
 #include <memory>
 #include <mutex>
+#include <set>
+#include <utility>
 #include <vector>
 
 namespace dclicd {
 
 /* forward declarations */
 class Buffer;
+class Event;
 class ReadMemoryEvent;
 
 } /* namespace dclicd */
@@ -92,6 +98,15 @@ public:
             const std::vector<cl_event>&    event_wait_list,
             cl_event *event = nullptr);
 
+    static void enqueueWriteBuffers(
+            std::vector<cl_command_queue>   commandQueueList,
+            std::vector<dclicd::Buffer *>   buffers,
+            const std::vector<size_t>       offsets,
+            size_t                          cb,
+            const void *                    ptr,
+            const std::vector<cl_event>&    event_wait_list,
+            cl_event *event = nullptr);
+
     void enqueueReduce(
             std::vector<dclicd::Buffer *>   srcs,
             dclicd::Buffer *                dst,
@@ -124,6 +139,34 @@ public:
     void finish();
     void flush();
 
+    /**
+     * @brief Registers a completed event whose profiling info has not been obtained yet.
+     *
+     * @param[in]  event    an event of a command of this command queue
+     */
+    void addUnprofiledEvent(
+            dclicd::Event& event);
+
+    /**
+     * @brief Deregisters an event whose profiling info has not been obtained yet.
+     *
+     * This method must be called before the event is deleted.
+     *
+     * @param[in]  event    an event of a command of this command queue
+     */
+    void removeUnprofiledEvent(
+            dclicd::Event& event);
+
+    /**
+     * @brief Obtains the profiling info of all registered events at once.
+     *
+     * The profiling info of all events is obtained by a single request, rather
+     * than a request per event. Afterwards, no events are registered.
+     *
+     * This is a blocking operation.
+     */
+    void fetchProfilingInfos();
+
 #if defined(CL_USE_DEPRECATED_OPENCL_1_1_APIS) || (defined(CL_VERSION_1_1) && !defined(CL_VERSION_1_2))
     void enqueueWaitForEvents(
             const std::vector<cl_event>& eventList);
@@ -165,6 +208,26 @@ public:
             const std::vector<cl_event>&    event_wait_list,
             cl_event *event = nullptr);
 
+    /**
+     * @brief Enqueues a non-blocking upload of a buffer's host data.
+     *
+     * This method is reserved for internal use by dOpenCL, i.e., to upload
+     * the initial data of a buffer to this command queue's compute node. The
+     * upload is ordered before all commands subsequently enqueued to this
+     * command queue.
+     *
+     * @param[in]  buffer   the buffer to upload data to
+     * @param[in]  offset   the offset in bytes in the buffer to upload data to
+     * @param[in]  cb       the number of bytes to upload
+     * @param[in]  ptr      the data to upload; must remain valid until the upload is complete
+     * @return the upload command
+     */
+    std::shared_ptr<dclicd::command::Command> enqueueUpload(
+            dclicd::Buffer *                buffer,
+            size_t                          offset,
+            size_t                          cb,
+            const void *                    ptr);
+
     void enqueueRead(
             dclicd::Buffer *                buffer,
             cl_bool                         blocking_read,
@@ -229,10 +292,52 @@ protected:
     void destroy();
 
 private:
+    /**
+     * @brief Converts an event wait list into a list of event IDs.
+     *
+     * The events are made available on this command queue's compute node.
+     *
+     * @param[in]  event_wait_list  the event wait list
+     * @param[out] eventIds         the IDs of the events in the wait list
+     */
     void createEventIdWaitList(
             const std::vector<cl_event>&    event_wait_list,
             std::vector<dcl::object_id>&    eventIds);
 
+    /**
+     * @brief Converts an event wait list into a list of event IDs.
+     *
+     * The events are made available on the specified compute nodes, e.g., on
+     * all compute nodes which receive the event wait list of a collective
+     * operation.
+     *
+     * @param[in]  event_wait_list  the event wait list
+     * @param[out] eventIds         the IDs of the events in the wait list
+     * @param[in]  computeNodes     the compute nodes that wait for the events
+     */
+    void createEventIdWaitList(
+            const std::vector<cl_event>&            event_wait_list,
+            std::vector<dcl::object_id>&            eventIds,
+            const std::vector<dcl::ComputeNode *>&  computeNodes);
+
+    /**
+     * @brief Uploads the initial data of memory objects to this command queue's
+     * compute node, if they are used on this compute node for the first time.
+     *
+     * @param[in]  memObjects   the memory objects used by a command
+     */
+    void initializeMemoryObjects(
+            const std::vector<cl_mem>&      memObjects);
+
+    /**
+     * @brief Records the modification of memory objects by a command on this
+     * command queue's compute node in their coherence directories.
+     *
+     * @param[in]  memObjects   the memory objects modified by a command
+     */
+    void modifyMemoryObjects(
+            const std::vector<cl_mem>&      memObjects);
+
     /**
      * @brief Enqueues a command.
      *
@@ -244,6 +349,50 @@ private:
     void enqueueCommand(
             const std::shared_ptr<dclicd::command::Command>& command);
 
+    /**
+     * @brief Sends an enqueue request to this command queue's compute node.
+     *
+     * If dOpenCL has been built with asynchronous enqueue (DCL_ASYNC_ENQUEUE),
+     * a non-blocking request is sent without awaiting the compute node's
+     * response. The response is collected in the background; an error is
+     * reported to the associated command (and its event) as soon as the
+     * response is received, and by the next finish of this command queue.
+     * Blocking requests are always executed synchronously.
+     *
+     * @param[in]  request  the request to send
+     * @param[in]  command  the command associated with the request; may be @c NULL
+     * @param[in]  blocking @c true, if the request must be executed synchronously
+     */
+    void enqueueRequest(
+            dclasio::message::Request&                          request,
+            const std::shared_ptr<dclicd::command::Command>&    command,
+            bool                                                blocking = false);
+
+    /**
+     * @brief Callback for the response to an asynchronously sent enqueue request.
+     *
+     * This method is called by the communication layer's receiving thread.
+     * If the request failed, the command's execution status is set to the
+     * error code. As this command queue may be deleted as soon as no requests
+     * are pending, the pending request is completed last.
+     *
+     * @param[in]  command  the command associated with the request; may be @c NULL
+     * @param[in]  errcode  the response's error code
+     */
+    void onResponse(
+            const std::shared_ptr<dclicd::command::Command>&    command,
+            cl_int                                              errcode);
+
+    /**
+     * @brief Waits for the responses to all asynchronously sent enqueue requests.
+     *
+     * This is a blocking operation.
+     *
+     * @return the error code of the first failed request since the last call
+     *         of this method, or @c CL_SUCCESS
+     */
+    cl_int awaitPendingRequests();
+
     /**
      * @brief Finishes this command queue locally.
      *
@@ -273,6 +422,24 @@ private:
      */
     std::vector<std::shared_ptr<dclicd::command::Command>> _commands;
     std::mutex _commandsMutex;
+
+    /**
+     * @brief Number of enqueue requests whose responses are pending
+     *
+     * @see enqueueRequest
+     */
+    unsigned int _pendingRequests;
+    cl_int _deferredError; /**< error code of first failed request */
+    std::mutex _pendingRequestsMutex;
+    std::condition_variable _pendingRequestsDone; /**< condition: all pending responses have been received */
+
+    /**
+     * @brief Completed events whose profiling info has not been obtained yet
+     *
+     * @see fetchProfilingInfos
+     */
+    std::set<dclicd::Event *> _unprofiledEvents;
+    std::mutex _unprofiledEventsMutex;
 };
 
 #endif /* CL_COMMANDQUEUE_H_ */
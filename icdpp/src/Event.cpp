@@ -51,6 +51,7 @@
 #include "dclicd/Error.h"
 #include "dclicd/utility.h"
 
+#include <dclasio/message/CommandMessage.h>
 #include <dclasio/message/DeleteEvent.h>
 
 #include <dcl/CLError.h>
@@ -66,6 +67,7 @@
 #include <CL/cl.h>
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <condition_variable>
 #include <cstddef>
@@ -78,8 +80,10 @@
 #include <vector>
 
 
-_cl_event::_cl_event(cl_context context, cl_int status) :
-	_context(context), _status(status) {
+_cl_event::_cl_event(cl_context context, cl_int status,
+        dcl::ComputeNode *computeNode) :
+	_context(context), _status(status), _computeNode(computeNode),
+	_notified(false), _finalStatus(CL_COMPLETE) {
     if (!context) { throw dclicd::Error(CL_INVALID_CONTEXT); }
 }
 
@@ -105,6 +109,111 @@ bool _cl_event::release() {
     }
 }
 
+void _cl_event::subscribe(dcl::ComputeNode& computeNode) {
+    std::unique_lock<std::mutex> lock(_substitutesMutex);
+    if (&computeNode == _computeNode) return; // compute node holds native event
+
+    auto substitute = _substitutes.find(&computeNode);
+    if (substitute != std::end(_substitutes)) {
+        /* substitute event already exists, or is being created by another
+         * thread; the latter must be awaited, as the caller is about to use
+         * the substitute event */
+        _substituteCreated.wait(lock, [this, &computeNode] {
+            auto substitute = _substitutes.find(&computeNode);
+            return substitute == std::end(_substitutes)
+                    || substitute->second != Substitute::CREATING; });
+        if (_substitutes.count(&computeNode)) return;
+    }
+    _substitutes[&computeNode] = Substitute::CREATING;
+    lock.unlock();
+
+    /* Do not hold the lock while awaiting the compute node's response, as the
+     * final execution status may be forwarded meanwhile */
+    try {
+        createSubstituteEvent(computeNode);
+    } catch (...) {
+        lock.lock();
+        _substitutes.erase(&computeNode);
+        _substituteCreated.notify_all();
+        throw;
+    }
+
+    lock.lock();
+    /* If the final execution status has been forwarded while the substitute
+     * event has been created, the compute node has been skipped. Otherwise,
+     * the compute node of this event may notify the compute node directly. */
+    bool notify = _notified;
+    cl_int status = _finalStatus;
+    _substitutes[&computeNode] = notify
+            ? Substitute::FORWARDED : Substitute::SUBSCRIBING;
+    _substituteCreated.notify_all();
+    lock.unlock();
+
+    if (!notify) {
+        /* The subscription is acknowledged asynchronously, as the compute
+         * node of this event must not process it before the event's command */
+        if (!subscribeDirectly(computeNode)) onSubscribed(computeNode, false);
+    } else {
+        try {
+            dclasio::message::CommandExecutionStatusChangedMessage message(remoteId(), status);
+            computeNode.sendMessage(message);
+        } catch (const dcl::CLError& err) {
+            throw dclicd::Error(err);
+        } catch (const dcl::IOException& err) {
+            throw dclicd::Error(err);
+        } catch (const dcl::ProtocolException& err) {
+            throw dclicd::Error(err);
+        }
+    }
+}
+
+bool _cl_event::subscribeDirectly(dcl::ComputeNode& computeNode) {
+    return false;
+}
+
+void _cl_event::onSubscribed(dcl::ComputeNode& computeNode, bool direct) {
+    std::lock_guard<std::mutex> lock(_substitutesMutex);
+    auto substitute = _substitutes.find(&computeNode);
+    if (substitute == std::end(_substitutes)
+            || substitute->second != Substitute::SUBSCRIBING) return;
+    /* If the final execution status has been forwarded before the
+     * acknowledgment, it is not sent again when deleting this event */
+    substitute->second = (direct && !_notified)
+            ? Substitute::DIRECT : Substitute::FORWARDED;
+    _substituteCreated.notify_all();
+}
+
+void _cl_event::notifySubscribers(cl_int status) {
+    std::vector<dcl::ComputeNode *> computeNodes;
+
+    {
+        std::lock_guard<std::mutex> lock(_substitutesMutex);
+        if (_notified) return; // final execution status already forwarded
+        _notified = true;
+        _finalStatus = status;
+        for (const auto& substitute : _substitutes) {
+            /* compute nodes whose substitute event is still being created are
+             * notified by subscribe; compute nodes whose subscription has not
+             * been acknowledged may not be notified by the event's compute
+             * node */
+            if (substitute.second == Substitute::FORWARDED
+                    || substitute.second == Substitute::SUBSCRIBING) {
+                computeNodes.push_back(substitute.first);
+            }
+        }
+    }
+
+    if (computeNodes.empty()) return;
+
+    dclasio::message::CommandExecutionStatusChangedMessage message(remoteId(), status);
+    dcl::sendMessage(computeNodes, message);
+    dcl::util::Logger << dcl::util::Debug
+            << "Forwarded update of command execution status to compute nodes (ID=" << remoteId()
+            << ", status=" << status
+            << ", compute nodes=" << computeNodes.size()
+            << ')' << std::endl;
+}
+
 void _cl_event::destroy() {
     /* Events must only be deleted if their reference count is 0 *and* their
      * associated command is completed (or terminated).
@@ -117,9 +226,38 @@ void _cl_event::destroy() {
 	assert(_ref_count == 0);
 	assert(isComplete());
 
+	/* Delete native event and substitute events */
+	std::vector<dcl::ComputeNode *> computeNodes;
+	std::vector<dcl::ComputeNode *> directSubstitutes;
+	if (_computeNode) computeNodes.push_back(_computeNode);
+	{
+	    /* Pending subscriptions must be awaited, as their acknowledgment
+	     * refers to this event */
+	    std::unique_lock<std::mutex> lock(_substitutesMutex);
+	    _substituteCreated.wait(lock, [this] {
+	        return std::none_of(std::begin(_substitutes), std::end(_substitutes),
+	                [](const std::pair<dcl::ComputeNode * const, Substitute>& substitute) {
+	                    return substitute.second == Substitute::SUBSCRIBING; }); });
+	    for (const auto& substitute : _substitutes) {
+	        computeNodes.push_back(substitute.first);
+	        if (substitute.second == Substitute::DIRECT) {
+	            directSubstitutes.push_back(substitute.first);
+	        }
+	    }
+	}
+	if (computeNodes.empty()) return;
+
 	try {
+	    if (!directSubstitutes.empty()) {
+	        /* The final execution status sent by the event's compute node may
+	         * not have arrived yet. It is sent again before deleting the
+	         * substitute events, such that they do not remain incomplete. */
+	        dclasio::message::CommandExecutionStatusChangedMessage message(remoteId(), _status);
+	        dcl::sendMessage(directSubstitutes, message);
+	    }
+
 		dclasio::message::DeleteEvent request(remoteId());
-		dcl::executeCommand(_context->computeNodes(), request);
+		dcl::executeCommand(computeNodes, request);
 		dcl::util::Logger << dcl::util::Info
 				<< "Event deleted (ID=" << remoteId() << ')' << std::endl;
 	} catch (const dcl::CLError& err) {
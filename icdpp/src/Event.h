@@ -62,6 +62,10 @@
 #include <utility>
 #include <vector>
 
+namespace dcl {
+class ComputeNode;
+} /* namespace dcl */
+
 
 class _cl_event:
 public _cl_retainable {
@@ -86,6 +90,23 @@ public:
 
     virtual dcl::object_id remoteId() const = 0;
 
+    /*!
+     * \brief Makes this event available on a compute node.
+     *
+     * Substitute events are created on demand, i.e., when a compute node
+     * refers to this event for the first time, e.g., in an event wait list.
+     * Only compute nodes which hold a substitute event are notified of this
+     * event's final execution status. If possible, the compute node of this
+     * event notifies the compute node directly (see subscribeDirectly);
+     * otherwise, the status is forwarded by the host. If this event is already
+     * complete, the compute node is notified right after creating the
+     * substitute event.
+     *
+     * \param[in]  computeNode  the compute node that refers to this event
+     */
+    void subscribe(
+            dcl::ComputeNode& computeNode);
+
     /**
      * \brief Wait for the event to be completed.
      *
@@ -127,10 +148,13 @@ protected:
      *
      * \param[in]  context
      * \param[in]  status   initial event status
+     * \param[in]  computeNode  compute node which holds the native event, or
+     *             \c nullptr if this event only exists on the host
      */
     _cl_event(
-            cl_context  context,
-            cl_int      status);
+            cl_context          context,
+            cl_int              status,
+            dcl::ComputeNode *  computeNode = nullptr);
 
     /*!
      * \brief Query command type.
@@ -182,6 +206,55 @@ protected:
     bool setCommandExecutionStatus(
             cl_int status);
 
+    /*!
+     * \brief Creates a substitute event for this event on a compute node.
+     *
+     * This method is reserved for internal use by subscribe.
+     *
+     * \param[in]  computeNode  the compute node to create the substitute event on
+     */
+    virtual void createSubstituteEvent(
+            dcl::ComputeNode& computeNode) = 0;
+
+    /*!
+     * \brief Requests the compute node of this event to notify a compute node directly.
+     *
+     * This method is reserved for internal use by subscribe. It is called after
+     * the substitute event has been created, if this event is not complete yet.
+     * The host forwards the final execution status to the compute node, until
+     * the request has been acknowledged by a call of onSubscribed.
+     * By default, compute nodes are not notified directly.
+     *
+     * \param[in]  computeNode  the compute node which holds a substitute event
+     * \return \c true, if the request has been sent, or \c false if the host
+     *         has to forward the final execution status
+     */
+    virtual bool subscribeDirectly(
+            dcl::ComputeNode& computeNode);
+
+    /*!
+     * \brief Callback for the response to a request sent by subscribeDirectly.
+     *
+     * \param[in]  computeNode  the compute node which holds a substitute event
+     * \param[in]  direct       \c true, if the compute node of this event
+     *             sends the final execution status to \c computeNode
+     */
+    void onSubscribed(
+            dcl::ComputeNode&   computeNode,
+            bool                direct);
+
+    /*!
+     * \brief Forwards the final execution status to all subscribed compute nodes.
+     *
+     * Compute nodes which are notified by the compute node of this event are
+     * skipped, unless their subscription has not been acknowledged yet.
+     * Compute nodes which subscribe later are notified when subscribing.
+     *
+     * \param[in]  status   the final command execution status
+     */
+    void notifySubscribers(
+            cl_int status);
+
     void destroy();
 
     cl_context _context;
@@ -200,6 +273,23 @@ private:
     void triggerCallbacks(
             cl_int status);
 
+    /*!
+     * \brief State of a substitute event
+     */
+    enum class Substitute {
+        CREATING,   //!< substitute event is being created
+        SUBSCRIBING,//!< direct notification has been requested, but not acknowledged yet
+        FORWARDED,  //!< final execution status is forwarded by the host
+        DIRECT      //!< final execution status is sent by the event's compute node
+    };
+
+    dcl::ComputeNode *_computeNode; //!< Compute node which holds the native event, or nullptr
+    std::map<dcl::ComputeNode *, Substitute> _substitutes; //!< Compute nodes which hold a substitute event
+    bool _notified; //!< true, if the final execution status has been forwarded to subscribers
+    cl_int _finalStatus; //!< Final execution status forwarded to subscribers
+    std::mutex _substitutesMutex; //!< Mutex for substitute events
+    std::condition_variable _substituteCreated; //!< Condition: substitute event created or subscription acknowledged
+
     /*! Saves a list of callbacks for each command execution status */
     std::map<cl_int, std::vector<std::pair<void (*)(cl_event, cl_int, void *), void *>>> _callbacks;
 };
@@ -52,15 +52,17 @@
 
 #include "dclicd/Error.h"
 #include "dclicd/utility.h"
+#include "dclicd/detail/KernelArgument.h"
 
 #include <dclasio/message/CreateKernel.h>
 #include <dclasio/message/CreateKernelsInProgram.h>
 #include <dclasio/message/DeleteKernel.h>
+#include <dclasio/message/EnqueueNDRangeKernel.h>
+#include <dclasio/message/EnqueueReduceBuffer.h>
 #include <dclasio/message/GetKernelInfo.h>
 #include <dclasio/message/InfoResponse.h>
 #include <dclasio/message/Request.h>
 #include <dclasio/message/Response.h>
-#include <dclasio/message/SetKernelArg.h>
 
 #include <dcl/Binary.h>
 #include <dcl/ComputeNode.h>
@@ -151,7 +153,7 @@ void _cl_kernel::destroy() {
 
 void _cl_kernel::setArgument(cl_uint index, size_t size, const void *value) {
 //    cl_uint numArgs;
-	std::unique_ptr<dclasio::message::Request> request;
+	std::unique_ptr<dclicd::detail::KernelArgument> argument;
 
 	/* Validate argument index using number of kernel arguments from kernel info */
 //	getInfo(CL_KERNEL_NUM_ARGS, sizeof(numArgs), &numArgs, nullptr);
@@ -160,11 +162,14 @@ void _cl_kernel::setArgument(cl_uint index, size_t size, const void *value) {
 
     /* TODO Determine argument type using type name and address qualifier from kernel argument info (available as of OpenCL 1.2) */
 
+	std::lock_guard<std::mutex> lock(_argumentsMutex);
+
+	_memoryObjects.erase(index);
+
 	if (value == nullptr) {
 		/* argument could be buffer object which should initialized with NULL
 		 * or could be declared with the __local qualifier */
-		request.reset(new dclasio::message::SetKernelArgMemObject(
-		        _id, index, size));
+		argument.reset(new dclicd::detail::KernelArgument(size));
 	} else {
 		if (size == sizeof(cl_mem)) {
 			/* value could be a pointer to buffer or image
@@ -172,8 +177,8 @@ void _cl_kernel::setArgument(cl_uint index, size_t size, const void *value) {
 			cl_mem mem = _cl_mem::findMemObject(*((cl_mem *) value));
 			if (mem) {
 				/* value points to memory object */
-				request.reset(new dclasio::message::SetKernelArgMemObject(
-				        _id, index, mem->remoteId()));
+				argument.reset(new dclicd::detail::KernelArgument(mem));
+				_memoryObjects[index] = mem;
 
 				if (mem->isOutput()) {
 				    /* If a writable (CL_MEM_WRITE_ONLY, CL_MEM_READ_WRITE)
@@ -190,23 +195,76 @@ void _cl_kernel::setArgument(cl_uint index, size_t size, const void *value) {
 		}
 	}
 
-	if (!request) {
+	if (!argument) {
 		/* value points to a regular variable */
-		request.reset(new dclasio::message::SetKernelArgBinary(
-		        _id, index, size, value));
+		argument.reset(new dclicd::detail::KernelArgument(size, value));
 	}
 
-	try {
-		dcl::executeCommand(_program->computeNodes(), *request);
-		dcl::util::Logger << dcl::util::Info
-				<< "Kernel argument set (ID=" << _id << ')' << std::endl;
-	} catch (const dcl::CLError& err) {
-		throw dclicd::Error(err);
-	} catch (const dcl::IOException& err) {
-		throw dclicd::Error(err);
-	} catch (const dcl::ProtocolException& err) {
-		throw dclicd::Error(err);
+	/* Only cache the argument here; it is sent to a compute node along with
+	 * the next kernel launch on that compute node. */
+	auto i = _arguments.find(index);
+	if (i == std::end(_arguments)) {
+	    _arguments.insert(std::make_pair(index, *argument));
+	} else {
+	    i->second = *argument;
+	}
+	for (auto computeNode : _program->computeNodes()) {
+	    _changedArguments[computeNode].insert(index);
 	}
+
+	dcl::util::Logger << dcl::util::Debug
+			<< "Kernel argument set (ID=" << _id
+			<< ", index=" << index
+			<< ')' << std::endl;
+}
+
+template<class LaunchRequest>
+std::vector<cl_uint> _cl_kernel::packChangedArguments(
+        dcl::ComputeNode& computeNode,
+        LaunchRequest& request) {
+    std::lock_guard<std::mutex> lock(_argumentsMutex);
+
+    auto changedArguments = _changedArguments.find(&computeNode);
+    if (changedArguments == std::end(_changedArguments)) return std::vector<cl_uint>();
+
+    for (auto index : changedArguments->second) {
+        const dclicd::detail::KernelArgument& argument = _arguments.at(index);
+
+        if (argument.type == dcl::kernel_arg_type::MEMORY) {
+            if (argument.value.size() == 0) {
+                /* local memory or NULL buffer */
+                request.setArgLocal(index, argument.size);
+            } else {
+                request.setArgMemObject(index,
+                        *static_cast<const dcl::object_id *>(argument.value.value()));
+            }
+        } else {
+            request.setArgBinary(index, argument.size, argument.value.value());
+        }
+    }
+
+    std::vector<cl_uint> indices(std::begin(changedArguments->second),
+            std::end(changedArguments->second));
+    _changedArguments.erase(changedArguments);
+    return indices;
+}
+
+template std::vector<cl_uint> _cl_kernel::packChangedArguments(
+        dcl::ComputeNode&, dclasio::message::EnqueueNDRangeKernel&);
+template std::vector<cl_uint> _cl_kernel::packChangedArguments(
+        dcl::ComputeNode&, dclasio::message::EnqueueReduceBuffer&);
+
+void _cl_kernel::invalidateArguments(
+        dcl::ComputeNode& computeNode,
+        const std::vector<cl_uint>& indices) {
+    std::lock_guard<std::mutex> lock(_argumentsMutex);
+
+    for (auto index : indices) {
+        /* Arguments which have not been set need not be sent again */
+        if (_arguments.count(index)) {
+            _changedArguments[&computeNode].insert(index);
+        }
+    }
 }
 
 std::vector<cl_mem> _cl_kernel::writeMemoryObjects() const {
@@ -222,6 +280,18 @@ std::vector<cl_mem> _cl_kernel::writeMemoryObjects() const {
             std::end(writeMemoryObjects));
 }
 
+std::vector<cl_mem> _cl_kernel::memoryObjects() const {
+    std::set<cl_mem> memoryObjects;
+
+    /* copy memory objects from argument list to set to remove duplicates */
+    for (const auto& argument : _memoryObjects) {
+        memoryObjects.insert(argument.second);
+    }
+
+    return std::vector<cl_mem>(std::begin(memoryObjects),
+            std::end(memoryObjects));
+}
+
 /*
  * Sends a 'create kernels in program' request to each compute node associated with program.
  *
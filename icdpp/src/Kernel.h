@@ -47,6 +47,8 @@
 
 #include "Retainable.h"
 
+#include "dclicd/detail/KernelArgument.h"
+
 #include <dcl/Binary.h>
 #include <dcl/DCLTypes.h>
 #include <dcl/Remote.h>
@@ -60,9 +62,20 @@
 #include <cstddef>
 #include <map>
 #include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
+namespace dcl {
+class ComputeNode;
+} /* namespace dcl */
+
+namespace dclasio {
+namespace message {
+class EnqueueNDRangeKernel;
+class EnqueueReduceBuffer;
+} /* namespace message */
+} /* namespace dclasio */
 
 class _cl_kernel: public _cl_retainable, public dcl::Remote {
 public:
@@ -112,6 +125,9 @@ public:
     /*!
      * \brief Sets a kernel argument.
      *
+     * The argument is cached locally and sent to the compute nodes along with
+     * the next kernel launch (see packChangedArguments).
+     *
      * \param[in]  index    index of the argument
      * \param[in]  size     size of the argument value
      * \param[in]  value    pointer to the argument value.
@@ -123,6 +139,36 @@ public:
             size_t      size,
             const void *value = nullptr);
 
+    /*!
+     * \brief Adds the arguments changed since the last launch on a compute node to a launch request.
+     *
+     * This method is defined for EnqueueNDRangeKernel and EnqueueReduceBuffer
+     * requests. The arguments are no longer considered changed afterwards. If
+     * the request fails, they have to be marked as changed again using
+     * invalidateArguments.
+     *
+     * \param[in]  computeNode the compute node the kernel will be launched on
+     * \param[out] request     the launch request the arguments are added to
+     * \return indices of the arguments added to the request
+     */
+    template<class LaunchRequest>
+    std::vector<cl_uint> packChangedArguments(
+            dcl::ComputeNode&   computeNode,
+            LaunchRequest&      request);
+
+    /*!
+     * \brief Marks arguments as changed on a compute node.
+     *
+     * This method must be called if the arguments have been overwritten on
+     * the compute node, such that they are sent again with the next launch.
+     *
+     * \param[in]  computeNode the compute node
+     * \param[in]  indices     indices of the overwritten arguments
+     */
+    void invalidateArguments(
+            dcl::ComputeNode&           computeNode,
+            const std::vector<cl_uint>& indices);
+
     /**
      * @brief Returns the memory objects (possibly) written to with this kernel
      *
@@ -130,6 +176,13 @@ public:
      */
     std::vector<cl_mem> writeMemoryObjects() const;
 
+    /**
+     * @brief Returns the memory objects currently set as arguments of this kernel
+     *
+     * @return a list of memory objects
+     */
+    std::vector<cl_mem> memoryObjects() const;
+
 protected:
     void destroy();
 
@@ -160,6 +213,16 @@ private:
      * @brief Memory objects modified by this kernel
      */
     std::vector<cl_mem> _writeMemoryObjects;
+    /**
+     * @brief Memory objects set as kernel arguments
+     */
+    std::map<cl_uint, cl_mem> _memoryObjects;
+
+    /** Kernel argument cache */
+    std::map<cl_uint, dclicd::detail::KernelArgument> _arguments;
+    /** Indices of arguments not yet sent to a compute node */
+    std::map<dcl::ComputeNode *, std::set<cl_uint>> _changedArguments;
+    std::mutex _argumentsMutex;
 };
 
 #endif /* CL_KERNEL_H_ */
@@ -55,6 +55,7 @@
 #include "dclicd/Error.h"
 #include "dclicd/utility.h"
 
+#include "dclicd/detail/CoherenceDirectory.h"
 #include "dclicd/detail/MappedMemory.h"
 
 #include <dclasio/message/CreateBuffer.h>
@@ -67,12 +68,15 @@
 #include <dcl/DCLTypes.h>
 #include <dcl/Remote.h>
 
+#include <dcl/util/Environment.h>
 #include <dcl/util/Logger.h>
 
 #ifdef __APPLE__
 #include <OpenCL/cl.h>
+#include <OpenCL/cl_wwu_dcl.h>
 #else
 #include <CL/cl.h>
+#include <CL/cl_wwu_dcl.h>
 #endif
 
 #include <algorithm>
@@ -101,6 +105,27 @@
 #endif
 
 
+namespace {
+
+/**
+ * @brief Default size of the blocks into which memory objects are divided
+ */
+const size_t DEFAULT_BLOCK_SIZE = 4 * 1024 * 1024;
+
+/**
+ * @brief Returns the size of the blocks into which memory objects are divided
+ *
+ * The block size is set in bytes by the environment variable DCL_BLOCK_SIZE.
+ * If it is set to 0, memory objects are not divided into blocks.
+ */
+size_t memoryBlockSize() {
+    static const size_t blockSize = dcl::util::getEnvSize(
+            "DCL_BLOCK_SIZE", DEFAULT_BLOCK_SIZE);
+    return blockSize;
+}
+
+} /* unnamed namespace */
+
 std::set<cl_mem> _cl_mem::_created_mem_obj;
 
 cl_mem _cl_mem::findMemObject(cl_mem ptr) {
@@ -113,7 +138,8 @@ _cl_mem::_cl_mem(
 		cl_mem_flags flags,
 		size_t size,
 		void *host_ptr) :
-	_context(context), _flags(flags), _size(size), _host_ptr(host_ptr), _data(nullptr) {
+	_context(context), _flags(flags), _size(size), _host_ptr(host_ptr), _data(nullptr),
+	_coherenceDirectory(size, memoryBlockSize(), host_ptr != nullptr) {
 	/* Read-write mode of memory object */
     cl_mem_flags rwMode = flags &
     		(CL_MEM_READ_WRITE | CL_MEM_READ_ONLY | CL_MEM_WRITE_ONLY);
@@ -154,7 +180,7 @@ _cl_mem::_cl_mem(
     	case CL_MEM_COPY_HOST_PTR:
     	    /* allocate memory for copying the host pointer */
     	    allocHostMemory();
-    	    /* TODO Copy data at host pointer to memory object's host memory */
+    	    std::memcpy(_data, _host_ptr, _size);
     		break;
     	case CL_MEM_USE_HOST_PTR:
     		/* CL_MEM_USE_HOST_PTR and CL_MEM_ALLOC_HOST_PTR are mutually
@@ -218,8 +244,13 @@ void _cl_mem::allocHostMemory() {
 #endif /* Linux */
 
     /* CL_MEM_ALLOC_HOST_PTR has been requested, page-lock the host memory
-     * for storing the memory object */
-    if ((_flags & CL_MEM_ALLOC_HOST_PTR)) lockHostMemory();
+     * for storing the memory object.
+     * If the memory object is divided into blocks, only blocks that are
+     * touched by a data transfer or mapping are locked (see lockHostMemory) */
+    _lockedBlocks.assign(
+            (_size + _coherenceDirectory.blockSize() - 1) / _coherenceDirectory.blockSize(),
+            false);
+    if (_coherenceDirectory.blockSize() == _size) lockHostMemory(0, _size);
 }
 
 void _cl_mem::freeHostMemory() {
@@ -233,23 +264,36 @@ void _cl_mem::freeHostMemory() {
     }
 }
 
-void _cl_mem::lockHostMemory() {
+void _cl_mem::lockHostMemory(size_t offset, size_t cb) {
+    if (!(_flags & CL_MEM_ALLOC_HOST_PTR)) return; // host memory must not be locked
+
 #ifdef DCL_MEM_LOCK
     assert(_data != nullptr);
 
 #ifdef _POSIX_MEMLOCK_RANGE
 #if defined(linux) || defined(__linux) || defined(__linux__)
-    struct rlimit mlock_limit;
-
-    ::getrlimit(RLIMIT_MEMLOCK, &mlock_limit);
-    /* Linux automatically rounds addr (i.e., _data) to page boundaries.
-     * However, as this is not required by POSIX, a portable implementation
-     * must not rely on proper alignment of addr. */
-    if (::mlock(_data, _size) != 0) {
-        /* memory locking failed */
-        std::cerr << "Cannot lock host memory for memory object: " << strerror(errno)
-                << " (mlock limit cur=" << mlock_limit.rlim_cur
-                << " bytes, max=" << mlock_limit.rlim_max << " bytes)" << std::endl;
+    size_t blockSize = _coherenceDirectory.blockSize();
+    size_t last = (cb > 0) ? (offset + cb - 1) / blockSize : offset / blockSize;
+
+    for (size_t i = offset / blockSize; i <= last && i < _lockedBlocks.size(); ++i) {
+        if (_lockedBlocks[i]) continue; // block is already locked
+
+        struct rlimit mlock_limit;
+        size_t blockOffset = i * blockSize;
+        size_t blockCb = std::min(blockSize, _size - blockOffset);
+
+        ::getrlimit(RLIMIT_MEMLOCK, &mlock_limit);
+        /* Linux automatically rounds addr (i.e., _data) to page boundaries.
+         * However, as this is not required by POSIX, a portable implementation
+         * must not rely on proper alignment of addr. */
+        if (::mlock(static_cast<char *>(_data) + blockOffset, blockCb) != 0) {
+            /* memory locking failed */
+            std::cerr << "Cannot lock host memory for memory object: " << strerror(errno)
+                    << " (mlock limit cur=" << mlock_limit.rlim_cur
+                    << " bytes, max=" << mlock_limit.rlim_max << " bytes)" << std::endl;
+            return;
+        }
+        _lockedBlocks[i] = true;
     }
 #endif /* Linux */
 #endif /* _POSIX_MEMLOCK_RANGE */
@@ -346,6 +390,14 @@ void _cl_mem::getInfo(
         dclicd::copy_info(offset(), param_value_size, param_value,
                 param_value_size_ret);
         break;
+    case CL_MEM_COHERENCE_HITS_WWU:
+        dclicd::copy_info(_coherenceDirectory.hits(), param_value_size, param_value,
+                param_value_size_ret);
+        break;
+    case CL_MEM_COHERENCE_MISSES_WWU:
+        dclicd::copy_info(_coherenceDirectory.misses(), param_value_size, param_value,
+                param_value_size_ret);
+        break;
 //    case CL_MEM_D3D10_RESOURCE_KHR:
 //        assert(!"cl_khr_d3d10_sharing not supported by dOpenCL");
 //        break;
@@ -363,13 +415,22 @@ bool _cl_mem::isOutput() const {
     return (_flags & (CL_MEM_WRITE_ONLY | CL_MEM_READ_WRITE));
 }
 
-void _cl_mem::onAcquireComplete(dcl::Process& destination, cl_int executionStatus) {
+dclicd::detail::CoherenceDirectory& _cl_mem::coherenceDirectory() {
+    return _coherenceDirectory;
+}
+
+void _cl_mem::onAcquireComplete(dcl::Process& destination,
+        size_t offset, size_t cb, cl_ulong version, cl_int executionStatus) {
     assert(executionStatus == CL_COMPLETE || executionStatus < 0);
 
     if (executionStatus == CL_COMPLETE) {
+        _coherenceDirectory.share(nullptr, offset, cb, version);
+        _coherenceDirectory.share(&destination, offset, cb, version);
+
         /* forward acquired memory object data to acquiring compute node */
         try {
-            destination.sendData(_size, _data);
+            destination.sendData(cb, static_cast<char *>(_data) + offset,
+                    dcl::DataTransfer::Priority::BACKGROUND);
         } catch (const dcl::IOException& e) {
             dcl::util::Logger << dcl::util::Error
                     << "(SYN) Acquire failed: " << e.what()
@@ -382,7 +443,8 @@ void _cl_mem::onAcquireComplete(dcl::Process& destination, cl_int executionStatu
     }
 }
 
-void _cl_mem::onAcquire(dcl::Process& destination, dcl::Process& source) {
+void _cl_mem::onAcquire(dcl::Process& destination, dcl::Process& source,
+        size_t offset, size_t cb, cl_ulong version) {
     dcl::util::Logger << dcl::util::Debug
             << "(SYN) Acquiring memory object from compute node '" << source.url()
             << "' on behalf of compute node '" << destination.url()
@@ -396,12 +458,36 @@ void _cl_mem::onAcquire(dcl::Process& destination, dcl::Process& source) {
      * different copies that are exchanged during synchronization between
      * compute nodes */
     try {
-        auto recv = acquire(source);
+        auto recv = acquire(source, offset, cb);
 
         /* forward memory object data to requesting compute node */
         recv->setCallback(
                 std::bind(&_cl_mem::onAcquireComplete, this,
-                        std::ref(destination), std::placeholders::_1));
+                        std::ref(destination), offset, cb, version,
+                        std::placeholders::_1));
+    } catch (const dcl::IOException& e) {
+        dcl::util::Logger << dcl::util::Error
+                << "(SYN) Acquire failed: " << e.what()
+                << std::endl;
+    }
+}
+
+void _cl_mem::onAcquireCached(dcl::Process& destination,
+        size_t offset, size_t cb, cl_ulong version) {
+    {
+        std::lock_guard<std::mutex> lock(_dataMutex);
+        lockHostMemory(offset, cb);
+    }
+
+    dcl::util::Logger << dcl::util::Debug
+            << "(SYN) Forwarding host replica of memory object to compute node '"
+            << destination.url() << "' (ID=" << remoteId() << ')'
+            << std::endl;
+
+    try {
+        destination.sendData(cb, static_cast<char *>(_data) + offset,
+                dcl::DataTransfer::Priority::BACKGROUND);
+        _coherenceDirectory.share(&destination, offset, cb, version);
     } catch (const dcl::IOException& e) {
         dcl::util::Logger << dcl::util::Error
                 << "(SYN) Acquire failed: " << e.what()
@@ -409,8 +495,11 @@ void _cl_mem::onAcquire(dcl::Process& destination, dcl::Process& source) {
     }
 }
 
-std::shared_ptr<dcl::DataTransfer> _cl_mem::acquire(dcl::Process& process) {
+std::shared_ptr<dcl::DataTransfer> _cl_mem::acquire(dcl::Process& process,
+        size_t offset, size_t cb) {
     std::lock_guard<std::mutex> lock(_dataMutex);
     allocHostMemory();
-    return process.receiveData(_size, _data);
+    lockHostMemory(offset, cb);
+    return process.receiveData(cb, static_cast<char *>(_data) + offset,
+            dcl::DataTransfer::Priority::BACKGROUND);
 }
@@ -46,6 +46,7 @@
 
 #include "Retainable.h"
 
+#include "dclicd/detail/CoherenceDirectory.h"
 #include "dclicd/detail/MappedMemory.h"
 
 #include <dcl/ComputeNode.h>
@@ -105,6 +106,16 @@ public:
      */
     bool isOutput() const;
 
+    /**
+     * @brief Returns the directory of this memory object's replicas
+     *
+     * Commands that modify this memory object on a compute node must record
+     * the modification in this directory.
+     *
+     * @return the coherence directory of this memory object
+     */
+    dclicd::detail::CoherenceDirectory& coherenceDirectory();
+
     /**
      * @brief Unmaps a previously mapped region of a memory object.
      *
@@ -127,10 +138,16 @@ public:
      *
      * @param[in]  destination      the requesting compute node where the memory
      *                              object has to be send to as an update
+     * @param[in]  offset           offset of the acquired range
+     * @param[in]  cb               size of the acquired range in bytes
+     * @param[in]  version          version of this memory object that is acquired
      * @param[in] executionStatus
      */
     void onAcquireComplete(
             dcl::Process& destination,
+            size_t        offset,
+            size_t        cb,
+            cl_ulong      version,
             cl_int        executionStatus);
 
     /**
@@ -145,10 +162,36 @@ public:
      *                          object has to be send to as an update
      * @param[in]  source       the compute node owning the latest changes to
      *                          this memory object
+     * @param[in]  offset       offset of the range to be acquired
+     * @param[in]  cb           size of the range to be acquired in bytes
+     * @param[in]  version      version of this memory object that is acquired
      */
     void onAcquire(
             dcl::Process& destination,
-            dcl::Process& source);
+            dcl::Process& source,
+            size_t        offset,
+            size_t        cb,
+            cl_ulong      version);
+
+    /**
+     * @brief Callback for acquiring this memory object's data from the host's replica on behalf of a compute node
+     *
+     * This method is used instead of onAcquire if the coherence directory of
+     * this memory object reports a valid replica on the host. The data is sent
+     * to the requesting compute node without acquiring it from another compute
+     * node.
+     *
+     * @param[in]  destination  the requesting compute node where the memory
+     *                          object has to be send to as an update
+     * @param[in]  offset       offset of the range to be acquired
+     * @param[in]  cb           size of the range to be acquired in bytes
+     * @param[in]  version      version of this memory object that is acquired
+     */
+    void onAcquireCached(
+            dcl::Process& destination,
+            size_t        offset,
+            size_t        cb,
+            cl_ulong      version);
 
 protected:
     _cl_mem(cl_context      context,
@@ -167,9 +210,18 @@ protected:
     void freeHostMemory();
 
     /**
-     * @brief Lock the pages holding this memory object in host memory.
+     * @brief Lock the pages holding a range of this memory object in host memory.
+     *
+     * If this memory object is divided into blocks, all blocks overlapping the
+     * range are locked. Memory is only locked, if CL_MEM_ALLOC_HOST_PTR has
+     * been specified for this memory object. The caller must hold _dataMutex.
+     *
+     * @param[in]  offset   offset of the range
+     * @param[in]  cb       size of the range in bytes
      */
-    void lockHostMemory();
+    void lockHostMemory(
+            size_t offset,
+            size_t cb);
 
     /**
      * @brief Unlock the pages holding this memory object in host memory.
@@ -201,16 +253,22 @@ protected:
      *
      * @param[in]  owner    the process (a compute node) to acquire the memory
      *                      object's data from
+     * @param[in]  offset   offset of the range to be acquired
+     * @param[in]  cb       size of the range to be acquired in bytes
      * @return a handle for the data transfer
      */
     std::shared_ptr<dcl::DataTransfer> acquire(
-            dcl::Process& process);
+            dcl::Process& process,
+            size_t        offset,
+            size_t        cb);
 
     cl_context _context;
     cl_mem_flags _flags;
     size_t _size;
     void *_host_ptr; /**< host_ptr argument specified, when memory object has been created */
     void *_data; /**< a cached copy of this memory object's data, used, e.g., for mapping */
+    dclicd::detail::CoherenceDirectory _coherenceDirectory; /**< Directory of this memory object's replicas */
+    std::vector<bool> _lockedBlocks; /**< Blocks of host memory which are page-locked */
 
     mutable std::mutex _dataMutex; /**< Mutex for data; mostly used for mapping */
 
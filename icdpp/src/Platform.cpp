@@ -52,6 +52,7 @@
 #include <dcl/CommunicationManager.h>
 
 #include <dcl/util/Logger.h>
+#include <dcl/util/Trace.h>
 
 #ifdef __APPLE__
 #include <OpenCL/cl.h>
@@ -155,6 +156,20 @@ _cl_platform_id::_cl_platform_id(
 }
 
 _cl_platform_id::~_cl_platform_id() {
+	/*
+	 * Write trace of host and compute nodes before disconnecting
+	 */
+	if (dcl::util::tracer.isEnabled()) {
+		std::ofstream out(dcl::util::tracer.fileName());
+		if (out) {
+			_communicationManager->writeTrace(out);
+		} else {
+			dcl::util::Logger << dcl::util::Error
+					<< "Cannot write trace file '" << dcl::util::tracer.fileName() << '\''
+					<< std::endl;
+		}
+	}
+
 	/*
 	 * Release all compute nodes
 	 */
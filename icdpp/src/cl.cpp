@@ -1545,6 +1545,9 @@ void * clGetExtensionFunctionAddressForPlatform(cl_platform_id platform,
         return reinterpret_cast<void *> (&clCreateContextFromComputeNodesWWU);
     }
 
+    if (!strcmp(func_name, "clEnqueueWriteBuffersWWU")) {
+        return reinterpret_cast<void *> (&clEnqueueWriteBuffersWWU);
+    }
     if (!strcmp(func_name, "clEnqueueBroadcastBufferWWU")) {
         return reinterpret_cast<void *> (&clEnqueueBroadcastBufferWWU);
     }
@@ -72,6 +72,47 @@
 
 /* Collective operation APIs */
 
+cl_int clEnqueueWriteBuffersWWU(cl_command_queue *command_queue_list,
+		cl_uint num_buffers, cl_mem *buffer_list, const size_t *offsets,
+		size_t cb, const void *ptr,
+		cl_uint num_events_in_wait_list, const cl_event * event_wait_list,
+		cl_event *event) {
+    std::vector<dclicd::Buffer *> buffers;
+    std::vector<size_t> bufferOffsets(num_buffers, 0);
+
+    if (!command_queue_list) return CL_INVALID_VALUE;
+	if ((num_buffers == 0) || !buffer_list) {
+		return CL_INVALID_VALUE;
+	}
+	if ((num_events_in_wait_list > 0 && !event_wait_list)
+			|| (num_events_in_wait_list == 0 && event_wait_list)) {
+		return CL_INVALID_VALUE;
+	}
+
+    /* convert buffer list */
+    buffers.reserve(num_buffers);
+    for (cl_mem *i = buffer_list; i != buffer_list + num_buffers; ++i) {
+        buffers.push_back(dynamic_cast<dclicd::Buffer *>(*i));
+    }
+
+    if (offsets) {
+        bufferOffsets.assign(offsets, offsets + num_buffers);
+    }
+
+	try {
+		_cl_command_queue::enqueueWriteBuffers(
+		        std::vector<cl_command_queue>(command_queue_list,
+		                command_queue_list + num_buffers),
+				buffers, bufferOffsets, cb, ptr,
+				std::vector<cl_event>(event_wait_list, event_wait_list
+						+ num_events_in_wait_list), event);
+	} catch (const dclicd::Error& err) {
+		return err.err();
+	}
+
+	return CL_SUCCESS;
+}
+
 cl_int clEnqueueBroadcastBufferWWU(cl_command_queue *command_queue_list,
 		cl_mem src_buffer, cl_uint num_dst_buffers, cl_mem *dst_buffer_list,
 		size_t src_offset, const size_t *dst_offset_list, size_t cb,
@@ -43,6 +43,7 @@
 
 #include "Buffer.h"
 
+#include "../CommandQueue.h"
 #include "../Context.h"
 #include "../Device.h"
 #include "../Memory.h"
@@ -51,6 +52,7 @@
 #include "Error.h"
 #include "utility.h"
 
+#include "command/Command.h"
 #include "detail/MappedMemory.h"
 
 #include <dclasio/message/CreateBuffer.h>
@@ -58,7 +60,6 @@
 
 #include <dcl/CLError.h>
 #include <dcl/ComputeNode.h>
-#include <dcl/DataTransfer.h>
 #include <dcl/DCLException.h>
 #include <dcl/DCLTypes.h>
 
@@ -92,52 +93,25 @@ Buffer::Buffer(
         size_t size,
         void *host_ptr) :
     _cl_mem(context, flags, size, host_ptr), _associatedMemory(nullptr), _offset(0) {
+    cl_mem_flags hostPtrFlags = flags &
+            (CL_MEM_COPY_HOST_PTR | CL_MEM_USE_HOST_PTR);
+
     try {
         /*
          * Create buffer
+         * The buffer is created uninitialized on all compute nodes, as the
+         * initial data is only uploaded to a compute node when the buffer is
+         * used on that compute node for the first time (see initialize).
          */
-        dclasio::message::CreateBuffer request(_id, _context->remoteId(), flags, size);
-
-        /* Tentative solution:
-         * Copy data to all compute nodes of context, if CL_MEM_COPY_HOST_PTR or
-         * CL_MEM_USE_HOST_PTR (cached copy) is specified.
-         * The memory objects on the compute nodes will not be updated by the
-         * memory coherency protocol, as there is no synchronization point (an
-         * event) before the first command actually uses the memory object on
-         * any compute node. */
-        if (flags & (CL_MEM_COPY_HOST_PTR | CL_MEM_USE_HOST_PTR)) {
-            const auto& computeNodes = _context->computeNodes();
-            std::vector<std::shared_ptr<const dcl::DataTransfer>> dataTransfers;
-
-            /* TODO Never send data to compute nodes when creating a memory object
-             * The current solution is working but introduces considerable
-             * communication overhead as the data is sent to *all* compute nodes.
-             * For an efficient implementation, do not copy this data to any
-             * compute node before the memory object is accessed by a device on
-             * a compute node. However, if CL_MEM_COPY_HOST_PTR has been
-             * specified the data has to be copied to a local buffer (_data). */
-
-            // send request and data
-            for (auto computeNode : computeNodes) {
-                assert(computeNode != nullptr);
-
-                computeNode->sendRequest(request);
-                auto sending =
-                        computeNode->sendData(size, host_ptr); // copy host pointer
-                dataTransfers.push_back(sending);
-            }
+        dclasio::message::CreateBuffer request(_id, _context->remoteId(),
+                flags & ~hostPtrFlags, size);
+        dcl::executeCommand(_context->computeNodes(), request);
 
-            // await responses from all compute nodes
-            for (auto computeNode : computeNodes) {
-                /* TODO Await completion of data transfer
-                 * Handle failed data transfers explicitly, as possibly no
-                 * response will be sent in that case. */
-
-                computeNode->awaitResponse(request);
-                /* TODO Receive responses from *all* compute nodes, i.e., do not stop receipt on first failure */
-            }
-        } else {
-            dcl::executeCommand(_context->computeNodes(), request);
+        if (hostPtrFlags) {
+            /* the initial data is kept in the buffer's host memory */
+            const auto& computeNodes = _context->computeNodes();
+            _uninitializedComputeNodes.insert(
+                    std::begin(computeNodes), std::end(computeNodes));
         }
 
         dcl::util::Logger << dcl::util::Info
@@ -167,6 +141,7 @@ void * Buffer::map(cl_map_flags flags, size_t offset, size_t cb) {
     {
         std::lock_guard<std::mutex> lock(_dataMutex);
         allocHostMemory();
+        lockHostMemory(offset, cb);
         ptr = static_cast<unsigned char *>(_data) + offset; // derive ptr from cache or host_ptr
         _mappedRegions.insert(std::make_pair(
                 ptr, detail::MappedBufferRegion(flags, offset, cb)));
@@ -185,6 +160,56 @@ void Buffer::unmap(void *mappedPtr) {
 //    freeHostMemory();
 }
 
+void Buffer::initialize(cl_command_queue commandQueue) {
+    assert(commandQueue != nullptr);
+    auto computeNode = &commandQueue->computeNode();
+    std::shared_ptr<command::Command> upload;
+
+    {
+        std::lock_guard<std::mutex> lock(_uploadsMutex);
+        if (_uninitializedComputeNodes.erase(computeNode) == 1) {
+            /* Buffer is used on compute node for the first time: enqueue
+             * upload of initial data *before* the command using the buffer.
+             * The host's data is only uploaded where it is still valid, and
+             * where the compute node has not acquired or modified the buffer
+             * yet. Otherwise, the upload would overwrite newer data. */
+            auto version = _coherenceDirectory.version();
+            for (const auto& range : _coherenceDirectory.hostOnlyRanges(*computeNode)) {
+                _uploads[computeNode] = commandQueue->enqueueUpload(this,
+                        range.first, range.second,
+                        static_cast<unsigned char *>(_data) + range.first);
+                /* compute node obtains a replica of the host's valid data */
+                _coherenceDirectory.share(computeNode, range.first, range.second,
+                        version);
+                dcl::util::Logger << dcl::util::Debug
+                        << "Uploading initial data of buffer on first use (ID=" << _id
+                        << ", compute node=" << computeNode->url()
+                        << ", offset=" << range.first
+                        << ", size=" << range.second << ')' << std::endl;
+            }
+            return;
+        }
+
+        auto i = _uploads.find(computeNode);
+        if (i == std::end(_uploads)) return; // compute node is initialized
+
+        if (i->second->isComplete()) {
+            _uploads.erase(i);
+            return;
+        }
+        /* Commands enqueued to the command queue of the upload are executed
+         * after the upload */
+        if (i->second->commandQueue() == commandQueue) return;
+        upload = i->second;
+    }
+
+    /* The buffer is currently uploaded using another command queue of the
+     * same compute node, which does not order the upload before commands of
+     * this command queue */
+    upload->commandQueue()->flush();
+    upload->wait();
+}
+
 const detail::MappedBufferRegion * Buffer::findMapping(void *mappedPtr) const {
     std::lock_guard<std::mutex> lock(_dataMutex);
 
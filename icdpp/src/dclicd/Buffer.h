@@ -48,6 +48,10 @@
 
 #include "detail/MappedMemory.h"
 
+#include "command/Command.h"
+
+#include <dcl/ComputeNode.h>
+
 #ifdef __APPLE__
 #include <OpenCL/cl.h>
 #else
@@ -56,6 +60,9 @@
 
 #include <cstddef>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 
 namespace dclicd {
 
@@ -91,6 +98,27 @@ public:
     const detail::MappedBufferRegion * findMapping(
             void *mappedPtr) const;
 
+    /*!
+     * \brief Uploads this buffer's initial data to a compute node on first use
+     *
+     * The initial data of a buffer created with CL_MEM_COPY_HOST_PTR or
+     * CL_MEM_USE_HOST_PTR is kept on the host rather than being sent to all
+     * compute nodes of the context. When a command using this buffer is
+     * enqueued on a compute node for the first time, the data is uploaded
+     * to that compute node using \c commandQueue. The upload is enqueued
+     * before the command, such that later changes to the buffer are acquired
+     * by the compute node by the memory consistency protocol as usual.
+     * Only ranges for which the host's data is still valid, and which the
+     * compute node has neither acquired nor modified yet, are uploaded.
+     *
+     * This method must be called before the command using this buffer is
+     * enqueued.
+     *
+     * \param[in]  commandQueue the command queue the command is enqueued to
+     */
+    void initialize(
+            cl_command_queue commandQueue);
+
 protected:
     cl_mem_object_type type() const ;
     cl_uint mapCount() const;
@@ -107,6 +135,16 @@ private:
      */
     std::map<void *, detail::MappedBufferRegion> _mappedRegions;
 
+    /*!
+     * \brief Compute nodes that did not receive this buffer's initial data yet
+     */
+    std::set<dcl::ComputeNode *> _uninitializedComputeNodes;
+    /*!
+     * \brief Pending uploads of this buffer's initial data
+     */
+    std::map<dcl::ComputeNode *, std::shared_ptr<command::Command>> _uploads;
+    std::mutex _uploadsMutex;
+
     /*
      * Sub-buffer attributes
      */
@@ -59,6 +59,7 @@
 #include <dclasio/message/EventProfilingInfosResponse.h>
 #include <dclasio/message/EventSynchronizationMessage.h>
 #include <dclasio/message/GetEventProfilingInfos.h>
+#include <dclasio/message/SubscribeEvent.h>
 
 #include <dcl/CLError.h>
 #include <dcl/CLObjectRegistry.h>
@@ -84,6 +85,7 @@
 #include <condition_variable>
 #include <cstddef>
 #include <cstdlib> // abort
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <iostream>
@@ -92,6 +94,7 @@
 #include <mutex>
 #include <ostream>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace dclicd {
@@ -100,12 +103,22 @@ namespace dclicd {
  * Event
  ******************************************************************************/
 
+bool Event::isNodeToNodeEnabled() {
+    static const bool enabled = [] {
+        const char *env = getenv("DCL_NODE_TO_NODE");
+        return !(env && std::strcmp(env, "0") == 0);
+    }();
+    return enabled;
+}
+
 Event::Event(cl_context context, 
 	const std::shared_ptr<command::Command>& command,
-	const std::vector<cl_mem>& memoryObjects) :
-	_cl_event(context, CL_QUEUED),
+	const std::vector<cl_mem>& memoryObjects,
+	size_t offset, size_t cb) :
+	_cl_event(context, CL_QUEUED, &command->commandQueue()->computeNode()),
 	_command(command), _commandQueued(dcl::util::clock.getTime()),
-	_memoryObjects(memoryObjects)
+	_memoryObjects(memoryObjects), _offset(cb ? offset : 0), _cb(cb),
+	_nodeToNode(!memoryObjects.empty() && isNodeToNodeEnabled())
 {
     assert(command != nullptr); // command must not be NULL
 #ifndef NDEBUG
@@ -114,45 +127,29 @@ Event::Event(cl_context context,
     assert(context == _context);
 #endif
 
+    /* Record the versions of the memory objects produced by the associated
+     * command. The command has been recorded in the memory objects'
+     * coherence directories when it has been enqueued. */
+    _versions.reserve(memoryObjects.size());
+    for (auto memoryObject : memoryObjects) {
+        _versions.push_back(memoryObject->coherenceDirectory().version());
+    }
+
     /* register event (required for consistency protocol) */
     _context->getPlatform()->remote().objectRegistry().bind<dcl::SynchronizationListener>(_command->remoteId(), *this);
 
-	try {
-		std::vector<dcl::object_id> memoryObjectIds;
-		
-		for (auto memoryObject : memoryObjects) {
-		    memoryObjectIds.push_back(memoryObject->remoteId());
-		}
-		
-		dclasio::message::CreateEvent createEvent(_context->remoteId(),
-				_command->remoteId(), memoryObjectIds);
-		std::vector<dcl::ComputeNode *> computeNodes(_context->computeNodes());
-
-		/* Create list of 'other' compute nodes.
-		 * Other compute nodes are compute nodes where no command has been
-		 * enqueued but which belong to the same context as the command queue
-		 * where the associated command has been enqueued. */
-		computeNodes.erase(std::find(std::begin(computeNodes), std::end(computeNodes),
-				&_command->commandQueue()->computeNode()));
-
-		/* Create substitute events on other compute nodes */
-		dcl::executeCommand(computeNodes, createEvent);
-		dcl::util::Logger << dcl::util::Info
-				<< "Event created (ID=" << _command->remoteId() << ')'
-				<< std::endl;
-	} catch (const dcl::CLError& err) {
-		throw Error(err);
-	} catch (const dcl::IOException& err) {
-		throw Error(err);
-	} catch (const dcl::ProtocolException& err) {
-		throw Error(err);
-	}
+    /* Substitute events on other compute nodes are created on demand (see
+     * _cl_event::subscribe) */
+    dcl::util::Logger << dcl::util::Info
+            << "Event created (ID=" << _command->remoteId() << ')'
+            << std::endl;
 
     _command->setEvent(*this); // attach event to local command
 	_command->commandQueue()->retain();
 }
 
 Event::~Event() {
+    _command->commandQueue()->removeUnprofiledEvent(*this);
     dclicd::release(_command->commandQueue());
 
 	/* deregister event */
@@ -174,44 +171,110 @@ void Event::wait() const {
 	waitNoFlush();
 }
 
+void Event::createSubstituteEvent(dcl::ComputeNode& computeNode) {
+	try {
+		std::vector<dcl::object_id> memoryObjectIds;
+
+		for (auto memoryObject : _memoryObjects) {
+		    memoryObjectIds.push_back(memoryObject->remoteId());
+		}
+
+		/* Substitute events only acquire the modified range of the memory
+		 * objects. If node-to-node communication is enabled, the compute node
+		 * connects to the event's compute node, such that it acquires changes
+		 * and receives the final execution status directly from there */
+		dclasio::message::CreateEvent createEvent(_context->remoteId(),
+				_command->remoteId(), memoryObjectIds, _offset, _cb,
+				isNodeToNodeEnabled() ? _command->commandQueue()->computeNode().url() : std::string());
+		computeNode.executeCommand(createEvent);
+		dcl::util::Logger << dcl::util::Info
+				<< "Substitute event created (ID=" << _command->remoteId()
+				<< ", compute node='" << computeNode.url() << "')"
+				<< std::endl;
+	} catch (const dcl::CLError& err) {
+		throw Error(err);
+	} catch (const dcl::IOException& err) {
+		throw Error(err);
+	} catch (const dcl::ProtocolException& err) {
+		throw Error(err);
+	}
+}
+
+bool Event::subscribeDirectly(dcl::ComputeNode& computeNode) {
+    /* Commands that are finished by the host, e.g., 'read buffer', are not
+     * completed on their compute node, such that the host has to send the
+     * event status update */
+    if (!isNodeToNodeEnabled() || _command->isCompletedByHost()) return false;
+
+    cl_command_queue commandQueue = _command->commandQueue();
+    try {
+        /* The request is executed after the command's request, as both are
+         * executed in order by the command queue's compute node */
+        dclasio::message::SubscribeEvent request(remoteId(),
+                commandQueue->remoteId(), computeNode.get_id());
+        commandQueue->computeNode().sendRequest(request,
+                [this, &computeNode](cl_int errcode) {
+                    if (errcode != CL_SUCCESS) {
+                        dcl::util::Logger << dcl::util::Warning
+                                << "Event subscription failed (ID=" << remoteId()
+                                << ", compute node='" << computeNode.url()
+                                << "', error=" << errcode
+                                << "), forwarding execution status instead" << std::endl;
+                    }
+                    onSubscribed(computeNode, errcode == CL_SUCCESS);
+                });
+    } catch (const dcl::DCLException& err) {
+        dcl::util::Logger << dcl::util::Warning
+                << "Event subscription failed (ID=" << remoteId()
+                << ", compute node='" << computeNode.url()
+                << "'), forwarding execution status instead" << std::endl;
+        return false;
+    }
+
+    dcl::util::Logger << dcl::util::Debug
+            << "Subscribing compute node '" << computeNode.url()
+            << "' to event (ID=" << remoteId() << ')' << std::endl;
+    return true;
+}
+
 bool Event::onCommandExecutionStatusChanged(cl_int status) {
-    /* TODO Send event status update to other compute nodes directly from the
-     *      compute node hosting the original event.
-     * The following is a work-around for missing node-to-node communication.
-     * However, commands that are finished by the host, e.g., 'read buffer',
-     * still have to send the event status update. */
 	if (status < 0 || status == CL_COMPLETE) { /* command failed or has been completed */
-		std::vector<dcl::ComputeNode *> computeNodes = _context->computeNodes();
-
 		/*
-		 * Forward event status change to other compute nodes in context
+		 * Forward event status change to subscribed compute nodes
 		 * The event status has been set to an error code or to 'complete' on
 		 * the compute node owning the event. The statuses of the corresponding
-		 * substitute events on other compute nodes of the context now have to
-		 * be updated accordingly.
+		 * substitute events on other compute nodes now have to be updated
+		 * accordingly, unless the compute node owning the event notifies them
+		 * directly.
 		 */
-		computeNodes.erase(std::find(std::begin(computeNodes), std::end(computeNodes),
-				&_command->commandQueue()->computeNode()));
-		if (!computeNodes.empty()) {
-            try {
-                dclasio::message::CommandExecutionStatusChangedMessage message(remoteId(), status);
-
-                dcl::sendMessage(computeNodes, message);
-                dcl::util::Logger << dcl::util::Debug
-                        << "Forwarded update of command execution status to compute nodes (ID=" << remoteId()
-                        << ", status=" << status
-                        << ')' << std::endl;
-            } catch (const dcl::DCLException& err) {
-                /* Application state has become inconsistent, abort */
-                std::cerr << "ERROR: event status update failed" << std::endl;
-                abort();
-            }
+		try {
+		    notifySubscribers(status);
+		} catch (const dcl::DCLException& err) {
+		    /* Application state has become inconsistent, abort */
+		    std::cerr << "ERROR: event status update failed" << std::endl;
+		    abort();
 		}
 	}
 
+	if (status == CL_COMPLETE && isProfilingEnabled() && !hasProfilingInfo()) {
+	    /* The profiling info has not been sent along with the completion,
+	     * e.g., as the command has been completed by the host. It will be
+	     * obtained together with the profiling info of other events. */
+	    _command->commandQueue()->addUnprofiledEvent(*this);
+	}
+
 	return setCommandExecutionStatus(status);
 }
 
+void Event::onProfilingInfo(
+        cl_ulong received,
+        cl_ulong queued,
+        cl_ulong submit,
+        cl_ulong start,
+        cl_ulong end) {
+    setProfilingInfo(received, queued, submit, start, end);
+}
+
 void Event::getProfilingInfo(
 		cl_kernel_info param_name,
 		size_t param_value_size,
@@ -224,18 +287,24 @@ void Event::getProfilingInfo(
 	if (!isComplete()) throw Error(CL_PROFILING_INFO_NOT_AVAILABLE);
      */
 
-	if (!_profilingInfo) {
-		/* Query profiling info from compute node */
+	if (!hasProfilingInfo()) {
 		try {
-			dclasio::message::GetEventProfilingInfos request(remoteId());
-			std::unique_ptr<dclasio::message::EventProfilingInfosReponse> response(
-					static_cast<dclasio::message::EventProfilingInfosReponse *>(
-							_command->commandQueue()->computeNode().executeCommand(
-									request, dclasio::message::EventProfilingInfosReponse::TYPE).release()));
-
-			_profilingInfo.reset(new detail::EventProfilingInfo(
-			        response->received,response->queued, response->submit,
-			        response->start, response->end));
+			/* Obtain the profiling info of all completed events of the command
+			 * queue at once, as they are usually queried one after another */
+			_command->commandQueue()->fetchProfilingInfos();
+
+			if (!hasProfilingInfo()) {
+				/* Query profiling info from compute node */
+				dclasio::message::GetEventProfilingInfos request(remoteId());
+				std::unique_ptr<dclasio::message::EventProfilingInfosReponse> response(
+						static_cast<dclasio::message::EventProfilingInfosReponse *>(
+								_command->commandQueue()->computeNode().executeCommand(
+										request, dclasio::message::EventProfilingInfosReponse::TYPE).release()));
+
+				setProfilingInfo(response->received.front(), response->queued.front(),
+				        response->submit.front(), response->start.front(),
+				        response->end.front());
+			}
 		} catch (const std::bad_alloc&) {
 			throw Error(CL_OUT_OF_HOST_MEMORY);
 		} catch (const dcl::CLError& err) {
@@ -292,6 +361,50 @@ void Event::synchronize() {
      * 2. Acquire associated memory object changes */
 }
 
+size_t Event::modifiedSize(cl_mem memoryObject) const {
+    size_t cb = _cb;
+
+    if (cb == 0) {
+        memoryObject->getInfo(CL_MEM_SIZE, sizeof(cb), &cb, nullptr);
+    }
+
+    return cb;
+}
+
+bool Event::isProfilingEnabled() const {
+    cl_command_queue_properties properties;
+    _command->commandQueue()->getInfo(CL_QUEUE_PROPERTIES, sizeof(properties),
+            &properties, nullptr);
+    return (properties & CL_QUEUE_PROFILING_ENABLE) != 0;
+}
+
+bool Event::hasProfilingInfo() const {
+    std::lock_guard<std::mutex> lock(_profilingInfoMutex);
+    return (_profilingInfo != nullptr);
+}
+
+void Event::setProfilingInfo(
+        cl_ulong received,
+        cl_ulong queued,
+        cl_ulong submit,
+        cl_ulong start,
+        cl_ulong end) const {
+    /* Convert compute node time to host time, such that the profiling info of
+     * all compute nodes is comparable */
+    dcl::util::ClockOffset clockOffset(_command->commandQueue()->computeNode().clockOffset());
+    if (clockOffset.isValid()) {
+        received = clockOffset.toLocalTime(received);
+    }
+
+    std::lock_guard<std::mutex> lock(_profilingInfoMutex);
+    /* Once set, the profiling info is not changed, such that it can be read
+     * without locking */
+    if (!_profilingInfo) {
+        _profilingInfo.reset(new detail::EventProfilingInfo(
+                received, queued, submit, start, end));
+    }
+}
+
 void Event::onSynchronize(dcl::Process& process) {
     dcl::util::Logger << dcl::util::Debug
             << "(MEM) Event synchronization (ID=" << remoteId()
@@ -300,6 +413,46 @@ void Event::onSynchronize(dcl::Process& process) {
 
     if (_memoryObjects.empty()) return;
 
+    if (_nodeToNode) {
+        /* request event's compute node to release the changes directly to the
+         * requesting compute node, which has connected to it when creating
+         * the substitute event */
+        for (size_t i = 0; i < _memoryObjects.size(); ++i) {
+            _memoryObjects[i]->coherenceDirectory().share(&process, _offset,
+                    modifiedSize(_memoryObjects[i]), _versions[i]);
+        }
+        dclasio::message::EventSynchronizationMessage msg(remoteId(), process.get_id());
+        _command->commandQueue()->computeNode().sendMessage(msg);
+        dcl::util::Logger << dcl::util::Debug
+                << "(MEM) Requested release of changes (ID=" << remoteId()
+                << ") from compute node '" << _command->commandQueue()->computeNode().url()
+                << "' to compute node '" << process.url() << '\''
+                << std::endl;
+        return;
+    }
+
+    /* The changes are served from the host's replicas, if the coherence
+     * directories report valid replicas on the host for all memory objects.
+     * Otherwise, the event's compute node releases all memory objects
+     * associated with this event. */
+    bool cached = std::all_of(std::begin(_memoryObjects), std::end(_memoryObjects),
+            [this](cl_mem memoryObject) {
+                return memoryObject->coherenceDirectory().isHostValid(
+                        _offset, modifiedSize(memoryObject)); });
+
+    if (cached) {
+        for (size_t i = 0; i < _memoryObjects.size(); ++i) {
+            _memoryObjects[i]->coherenceDirectory().hit();
+            _memoryObjects[i]->onAcquireCached(process, _offset,
+                    modifiedSize(_memoryObjects[i]), _versions[i]);
+        }
+        dcl::util::Logger << dcl::util::Debug
+                << "(MEM) Served event synchronization request (ID=" << remoteId()
+                << ") from host replicas"
+                << std::endl;
+        return;
+    }
+
     /* forward synchronization request to event's compute node */
     dclasio::message::EventSynchronizationMessage msg(remoteId());
     _command->commandQueue()->computeNode().sendMessage(msg);
@@ -317,8 +470,10 @@ void Event::onSynchronize(dcl::Process& process) {
      * node-to-node communication). */
 
     /* acquire and release memory objects from event's compute node */
-    for (auto memoryObject : _memoryObjects) {
-        memoryObject->onAcquire(process, _command->commandQueue()->computeNode());
+    for (size_t i = 0; i < _memoryObjects.size(); ++i) {
+        _memoryObjects[i]->coherenceDirectory().miss();
+        _memoryObjects[i]->onAcquire(process, _command->commandQueue()->computeNode(),
+                _offset, modifiedSize(_memoryObjects[i]), _versions[i]);
     }
 }
 
@@ -329,19 +484,10 @@ void Event::onSynchronize(dcl::Process& process) {
 UserEvent::UserEvent(cl_context context) :
 	_cl_event(context, CL_SUBMITTED)
 {
-	try {
-		dclasio::message::CreateEvent request(context->remoteId(), _id,
-		        std::vector<dcl::object_id>());
-		dcl::executeCommand(_context->computeNodes(), request);
-		dcl::util::Logger << dcl::util::Info
-				<< "User event created (ID=" << _id << ')' << std::endl;
-	} catch (const dcl::CLError& err) {
-		throw Error(err);
-	} catch (const dcl::IOException& err) {
-		throw Error(err);
-	} catch (const dcl::ProtocolException& err) {
-		throw Error(err);
-	}
+	/* User events only exist on the host. Substitute events are created on
+	 * demand (see _cl_event::subscribe) */
+	dcl::util::Logger << dcl::util::Info
+			<< "User event created (ID=" << _id << ')' << std::endl;
 
 	_context->retain();
 }
@@ -378,11 +524,10 @@ void UserEvent::setStatus(cl_int status) {
 	}
 
 	/*
-	 * Broadcast user event status update
+	 * Forward user event status update to subscribed compute nodes
 	 */
 	try {
-	    dclasio::message::CommandExecutionStatusChangedMessage request(_id, status);
-		dcl::sendMessage(_context->computeNodes(), request);
+		notifySubscribers(status);
 		dcl::util::Logger << dcl::util::Info
 				<< "User event status set (ID=" << remoteId()
 				<< ", status=" << status
@@ -407,6 +552,24 @@ void UserEvent::getProfilingInfo(
 	throw Error(CL_PROFILING_INFO_NOT_AVAILABLE);
 }
 
+void UserEvent::createSubstituteEvent(dcl::ComputeNode& computeNode) {
+	try {
+		dclasio::message::CreateEvent request(_context->remoteId(), _id,
+		        std::vector<dcl::object_id>());
+		computeNode.executeCommand(request);
+		dcl::util::Logger << dcl::util::Info
+				<< "Substitute user event created (ID=" << _id
+				<< ", compute node='" << computeNode.url() << "')"
+				<< std::endl;
+	} catch (const dcl::CLError& err) {
+		throw Error(err);
+	} catch (const dcl::IOException& err) {
+		throw Error(err);
+	} catch (const dcl::ProtocolException& err) {
+		throw Error(err);
+	}
+}
+
 cl_command_type UserEvent::commandType() const {
 	/* User events always are associated with a user command */
 	return CL_COMMAND_USER;
@@ -417,4 +580,105 @@ cl_command_queue UserEvent::commandQueue() const {
 	return nullptr;
 }
 
+/******************************************************************************
+ * Compound event
+ ******************************************************************************/
+
+CompoundEvent::CompoundEvent(cl_context context, cl_command_type type,
+        cl_command_queue commandQueue, size_t count) :
+    _cl_event(context, CL_QUEUED), _type(type), _commandQueue(commandQueue),
+    _pending(count), _commandStatus(CL_COMPLETE)
+{
+    assert(commandQueue != nullptr); // command queue must not be NULL
+    assert(count > 0); // at least one command must be associated
+
+    /* Compound events only exist on the host. Substitute events are created
+     * on demand (see _cl_event::subscribe) */
+    dcl::util::Logger << dcl::util::Info
+            << "Compound event created (ID=" << _id
+            << ", #commands=" << count << ')' << std::endl;
+
+    _context->retain();
+    _commandQueue->retain();
+}
+
+CompoundEvent::~CompoundEvent() {
+    dclicd::release(_commandQueue);
+    dclicd::release(_context);
+}
+
+dcl::object_id CompoundEvent::remoteId() const {
+    return _id;
+}
+
+void CompoundEvent::wait() const {
+    /* The associated commands have been flushed when they were enqueued */
+    waitNoFlush();
+}
+
+void CompoundEvent::onCommandComplete(cl_int status) {
+    {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        assert(_pending > 0);
+        if (status < 0 && _commandStatus == CL_COMPLETE) {
+            _commandStatus = status;
+        }
+        if (--_pending > 0) return;
+        status = _commandStatus;
+    }
+
+    /* The host sets the final status of this event, such that it has to
+     * forward it to all subscribed compute nodes */
+    try {
+        notifySubscribers(status);
+    } catch (const dcl::DCLException& err) {
+        /* Application state has become inconsistent, abort */
+        std::cerr << "ERROR: event status update failed" << std::endl;
+        abort();
+    }
+
+    dcl::util::Logger << dcl::util::Info
+            << "Compound event status set (ID=" << _id
+            << ", status=" << status
+            << ')' << std::endl;
+
+    /* WARNING: this event may be deleted by this call */
+    setCommandExecutionStatus(status);
+}
+
+void CompoundEvent::getProfilingInfo(
+        cl_profiling_info /* param_name */,
+        size_t            /* param_value_size */,
+        void *            /* param_value */,
+        size_t *          /* param_value_size_ret */) const {
+    /* The associated commands have different profiling info */
+    throw Error(CL_PROFILING_INFO_NOT_AVAILABLE);
+}
+
+void CompoundEvent::createSubstituteEvent(dcl::ComputeNode& computeNode) {
+    try {
+        dclasio::message::CreateEvent request(_context->remoteId(), _id,
+                std::vector<dcl::object_id>());
+        computeNode.executeCommand(request);
+        dcl::util::Logger << dcl::util::Info
+                << "Substitute compound event created (ID=" << _id
+                << ", compute node='" << computeNode.url() << "')"
+                << std::endl;
+    } catch (const dcl::CLError& err) {
+        throw Error(err);
+    } catch (const dcl::IOException& err) {
+        throw Error(err);
+    } catch (const dcl::ProtocolException& err) {
+        throw Error(err);
+    }
+}
+
+cl_command_type CompoundEvent::commandType() const {
+    return _type;
+}
+
+cl_command_queue CompoundEvent::commandQueue() const {
+    return _commandQueue;
+}
+
 } /* namespace dclicd */
@@ -61,6 +61,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace dclicd {
@@ -82,22 +83,38 @@ public:
      * \brief Creates an event associated with a specified command.
      *
      * On compute nodes other than the compute node where the associated command
-     * has been enqueued, a substitute event is created to replace the native
-     * OpenCL event which resides on the compute node where the associated
-     * command has been enqueued.
+     * has been enqueued, a substitute event is created on demand to replace
+     * the native OpenCL event which resides on the compute node where the
+     * associated command has been enqueued.
      * Internally, these substitute event are implemented as user events, but
      * they hold additional information for synchronization purposes.
      *
      * \param[in]  context          the context that is associated with this event
      * \param[in]  command          the command that this event is associated with
      * \param[in]  memoryObjects    the memory objects associated with this event
+     * \param[in]  offset           offset of the range of the memory objects
+     *             modified by \c command
+     * \param[in]  cb               size of the modified range in bytes; if 0,
+     *             the entire memory objects are considered modified
      */
     Event(
             cl_context                                  context,
             const std::shared_ptr<command::Command>&    command,
-            const std::vector<cl_mem>&                  memoryObjects = std::vector<cl_mem>());
+            const std::vector<cl_mem>&                  memoryObjects = std::vector<cl_mem>(),
+            size_t                                      offset = 0,
+            size_t                                      cb = 0);
     virtual ~Event();
 
+    /*!
+     * \brief Checks if changes to memory objects are exchanged between compute nodes directly
+     *
+     * Node-to-node synchronization is enabled by default. It is disabled by
+     * setting the environment variable DCL_NODE_TO_NODE to 0, e.g., if compute
+     * nodes cannot connect to each other. In this case, the changes are forwarded
+     * by the host.
+     */
+    static bool isNodeToNodeEnabled();
+
     dcl::object_id remoteId() const;
 
     /*!
@@ -124,6 +141,22 @@ public:
     bool onCommandExecutionStatusChanged(
             cl_int status);
 
+    /*!
+     * \brief Sets the event's profiling info.
+     *
+     * This method is called with the profiling info that the event's compute
+     * node sends along with the command's completion, or that has been
+     * obtained for several events at once (see
+     * _cl_command_queue::fetchProfilingInfos).
+     * All times are provided by the compute node's clock.
+     */
+    void onProfilingInfo(
+            cl_ulong received,
+            cl_ulong queued,
+            cl_ulong submit,
+            cl_ulong start,
+            cl_ulong end);
+
     void getProfilingInfo(
             cl_profiling_info   param_name,
             size_t              param_value_size,
@@ -142,10 +175,11 @@ public:
     /*
      * SynchronizationListener API
      *
-     * This method is only required to work-around the missing node-to-node
-     * communication. The host will never own an event which a compute node can
-     * synchronize with. However, the host can synchronize with a compute node's
-     * event.
+     * The host will never own an event which a compute node can synchronize
+     * with. However, the host coordinates the synchronization of compute
+     * nodes: it requests the event's compute node to release the changes
+     * either directly to the requesting compute node, or to the host which
+     * forwards them (if node-to-node synchronization is disabled).
      */
 
     void onSynchronize(
@@ -155,12 +189,61 @@ protected:
     cl_command_type commandType() const;
     cl_command_queue commandQueue() const;
 
+    void createSubstituteEvent(
+            dcl::ComputeNode& computeNode);
+
+    /*!
+     * \brief Requests the event's compute node to notify a compute node directly.
+     *
+     * Compute nodes are notified directly if node-to-node communication is
+     * enabled, unless the associated command is completed by the host (e.g.,
+     * 'read buffer'). If the request cannot be sent or fails, the host
+     * forwards the final execution status instead.
+     */
+    bool subscribeDirectly(
+            dcl::ComputeNode& computeNode);
+
 private:
+    /*!
+     * \brief Returns the size of the modified range of a memory object associated with this event
+     */
+    size_t modifiedSize(
+            cl_mem memoryObject) const;
+
+    /*!
+     * \brief Checks if profiling is enabled for the command queue of this event
+     */
+    bool isProfilingEnabled() const;
+
+    /*!
+     * \brief Checks if the profiling info of this event has been obtained
+     */
+    bool hasProfilingInfo() const;
+
+    /*!
+     * \brief Caches the profiling info of this event.
+     *
+     * The receipt time is converted from the compute node's clock to the
+     * host's clock, such that the profiling info of different compute nodes
+     * is comparable.
+     */
+    void setProfilingInfo(
+            cl_ulong received,
+            cl_ulong queued,
+            cl_ulong submit,
+            cl_ulong start,
+            cl_ulong end) const;
+
     std::shared_ptr<command::Command> _command; //!< Command that is associated with this event
     cl_ulong _commandQueued; //!< Queuing time of command on host
     std::vector<cl_mem> _memoryObjects; //!< Memory objects associated with this event
+    std::vector<cl_ulong> _versions; //!< Versions of the memory objects produced by the associated command
+    size_t _offset; //!< Offset of the modified range of the memory objects
+    size_t _cb; //!< Size of the modified range of the memory objects, or 0 if entire memory objects are modified
+    bool _nodeToNode; //!< \c true, if changes are released to other compute nodes directly
 
     mutable std::unique_ptr<detail::EventProfilingInfo> _profilingInfo; //!< Profiling info (optional, cached)
+    mutable std::mutex _profilingInfoMutex; //!< Mutex for profiling info
 };
 
 /******************************************************************************/
@@ -221,6 +304,71 @@ public:
 protected:
     cl_command_type commandType() const;
     cl_command_queue commandQueue() const;
+
+    void createSubstituteEvent(
+            dcl::ComputeNode& computeNode);
+};
+
+/******************************************************************************/
+
+/*!
+ * \brief An event which is associated with several commands.
+ *
+ * The commands may have been enqueued to different compute nodes, e.g., by a
+ * multicast upload. Like a user event, this event only exists on the host, and
+ * substitute events are created on demand. Its status is set by the host, when
+ * all associated commands have completed or one of them has failed.
+ */
+class CompoundEvent: public dcl::Remote, public _cl_event {
+public:
+    /*!
+     * \param[in]  context      the context that is associated with this event
+     * \param[in]  type         the command type reported by this event
+     * \param[in]  commandQueue the command queue reported by this event
+     * \param[in]  count        the number of associated commands
+     */
+    CompoundEvent(
+            cl_context          context,
+            cl_command_type     type,
+            cl_command_queue    commandQueue,
+            size_t              count);
+    virtual ~CompoundEvent();
+
+    dcl::object_id remoteId() const;
+
+    void wait() const;
+
+    /*!
+     * \brief Updates this event when an associated command has completed or failed.
+     *
+     * This method must be called once for each associated command (see
+     * command::Command::setCompletionHandler). The event's status is set to the
+     * first error, or to \c CL_COMPLETE, when all commands have completed.
+     *
+     * \param[in]  status   the final execution status of the command
+     */
+    void onCommandComplete(
+            cl_int status);
+
+    void getProfilingInfo(
+            cl_profiling_info   param_name,
+            size_t              param_value_size,
+            void *              param_value,
+            size_t *            param_value_size_ret) const;
+
+protected:
+    cl_command_type commandType() const;
+    cl_command_queue commandQueue() const;
+
+    void createSubstituteEvent(
+            dcl::ComputeNode& computeNode);
+
+private:
+    cl_command_type _type;
+    cl_command_queue _commandQueue;
+    size_t _pending; //!< Number of associated commands which have not completed yet
+    cl_int _commandStatus; //!< CL_COMPLETE, or error code of first failed command
+    std::mutex _pendingMutex;
 };
 
 } /* namespace dclicd */
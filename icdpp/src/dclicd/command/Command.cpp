@@ -65,6 +65,7 @@
 
 #include <cassert>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
 #include <ostream>
 
@@ -113,6 +114,12 @@ void Command::setEvent(Event& event) {
 #endif
 }
 
+void Command::setCompletionHandler(
+        const std::function<void (cl_int)>& handler) {
+    std::lock_guard<std::recursive_mutex> lock(_executionStatusMutex);
+    _completionHandler = handler;
+}
+
 bool Command::isComplete() const {
 	std::lock_guard<std::recursive_mutex> lock(_executionStatusMutex);
 	return (_executionStatus < 0 /* error */
@@ -147,11 +154,17 @@ void Command::onExecutionStatusChanged(cl_int executionStatus) {
         executionStatus = err.err();
     }
 
+	std::function<void (cl_int)> completionHandler;
+
 	{
 		std::lock_guard<std::recursive_mutex> lock(_executionStatusMutex);
 		/* executionStatus may have been changed concurrently, e.g., by an
 		 * operation in method submit */
 		if (executionStatus < _executionStatus) {
+		    if (_executionStatus > CL_COMPLETE && executionStatus <= CL_COMPLETE) {
+		        /* command has completed or failed */
+		        completionHandler.swap(_completionHandler);
+		    }
 			_executionStatus = executionStatus;
             dcl::util::Logger << dcl::util::Debug
                     << "Changed command execution status (ID=" << _id
@@ -181,6 +194,22 @@ void Command::onExecutionStatusChanged(cl_int executionStatus) {
 			_executionStatusChanged.notify_all();
 		}
 	}
+
+	if (completionHandler) completionHandler(executionStatus);
+}
+
+void Command::onProfilingInfo(cl_ulong received, cl_ulong queued,
+        cl_ulong submit, cl_ulong start, cl_ulong end) {
+    std::lock_guard<std::recursive_mutex> lock(_executionStatusMutex);
+    /* Profiling info is sent before the command is complete, i.e., before
+     * the associated event may have been deleted */
+    if (_event && _executionStatus > CL_COMPLETE) {
+        _event->onProfilingInfo(received, queued, submit, start, end);
+    }
+}
+
+bool Command::isCompletedByHost() const {
+    return false;
 }
 
 cl_int Command::submit() {
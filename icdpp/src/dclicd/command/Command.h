@@ -54,6 +54,7 @@
 #endif
 
 #include <condition_variable>
+#include <functional>
 #include <mutex>
 
 namespace dclicd {
@@ -91,6 +92,18 @@ public:
     void setEvent(
             dclicd::Event& event);
 
+    /*!
+     * \brief Sets a function which is called when this command has completed or failed.
+     *
+     * The handler is called once with the final execution status of this
+     * command. It must be set before the command is submitted to its compute
+     * node.
+     *
+     * \param[in]  handler  the completion handler
+     */
+    void setCompletionHandler(
+            const std::function<void (cl_int)>& handler);
+
     /*!
      * \brief Checks, if this command is complete
      *
@@ -98,6 +111,17 @@ public:
      */
     bool isComplete() const;
 
+    /*!
+     * \brief Checks, if this command is completed by the host
+     *
+     * Commands that are completed by the host, e.g., 'read buffer', are not
+     * completed on their compute node. Hence, the host has to forward the
+     * execution status of such commands to other compute nodes.
+     *
+     * \return \c true, if this command is completed by the host, otherwise \c false
+     */
+    virtual bool isCompletedByHost() const;
+
     /*!
      * \brief Wait for the command to be completed.
      */
@@ -110,6 +134,13 @@ public:
     void onExecutionStatusChanged(
             cl_int executionStatus);
 
+    void onProfilingInfo(
+            cl_ulong received,
+            cl_ulong queued,
+            cl_ulong submit,
+            cl_ulong start,
+            cl_ulong end);
+
 protected:
     /*!
      * \brief Executes this command when its execution status changes to \c CL_SUBMITTED.
@@ -138,6 +169,7 @@ protected:
     mutable std::condition_variable_any _executionStatusChanged; //!< Condition: command execution status changed
 
     dclicd::Event *_event; //!< Associated event; can be \c NULL
+    std::function<void (cl_int)> _completionHandler; //!< Called with the final execution status; can be empty
 };
 
 } /* namespace command */
@@ -58,6 +58,9 @@
 #include <dcl/DataTransfer.h>
 #include <dcl/DCLTypes.h>
 
+#include <dcl/util/Clock.h>
+#include <dcl/util/Trace.h>
+
 #ifdef __APPLE__
 #include <OpenCL/cl.h>
 #else
@@ -77,35 +80,79 @@ MapBufferCommand::MapBufferCommand(
         cl_command_queue commandQueue,
         Buffer *buffer,
         cl_map_flags flags,
+        size_t offset,
         size_t cb,
         void *ptr) :
     Command(CL_COMMAND_MAP_BUFFER, commandQueue), _buffer(buffer),
-    _flags(flags), _cb(cb), _ptr(ptr) {
+    _flags(flags), _offset(offset), _cb(cb), _ptr(ptr), _submitted(0),
+    _pending(0), _status(CL_SUCCESS), _remoteStatus(CL_SUCCESS) {
     assert(_buffer != nullptr); // buffer must not be NULL
     _buffer->retain();
+    _version = _buffer->coherenceDirectory().version();
 }
 
 MapBufferCommand::~MapBufferCommand() {
     release(_buffer);
 }
 
+bool MapBufferCommand::isCompletedByHost() const {
+    /* A mapping for reading is completed when data receipt is complete */
+    return (_flags & CL_MAP_READ) != 0;
+}
+
 cl_int MapBufferCommand::submit() {
+    _submitted = dcl::util::clock.getTime();
+
     if ((_flags & CL_MAP_READ)) {
         /*
          * The mapped buffer region has to be synchronized, i.e., it has to be
          * downloaded to the mapped pointer.
          */
+        /* All receipts must be counted before any receipt can complete */
+        _pending = 2;
         // start data transfer
         std::shared_ptr<dcl::DataTransfer> receipt(
                 _commandQueue->computeNode().receiveData(_cb, _ptr));
         // register callback to complete MapBufferCommand
         receipt->setCallback(std::bind(
-                &MapBufferCommand::onExecutionStatusChanged, this, std::placeholders::_1));
+                &MapBufferCommand::onDataReceived, this, std::placeholders::_1));
+        /* The compute node sends its completion status after the data */
+        receipt = _commandQueue->computeNode().receiveData(
+                sizeof(_remoteStatus), &_remoteStatus);
+        receipt->setCallback(std::bind(
+                &MapBufferCommand::onStatusReceived, this, std::placeholders::_1));
     }
 
     return CL_RUNNING;
 }
 
+void MapBufferCommand::onDataReceived(cl_int status) {
+    if (status != CL_SUCCESS) _status = status;
+    // complete MapBufferCommand when the data and the status have been received
+    if (--_pending == 0) onExecutionStatusChanged(_status);
+}
+
+void MapBufferCommand::onStatusReceived(cl_int status) {
+    /* Report a failure of the compute node, e.g., if the data could not be
+     * read from the device */
+    if (status == CL_SUCCESS) status = _remoteStatus;
+    onDataReceived(status);
+}
+
+cl_int MapBufferCommand::complete(
+        cl_int errcode) {
+    if (errcode == CL_SUCCESS && (_flags & CL_MAP_READ)) {
+        /* The host's replicas of the downloaded blocks are valid, if they have
+         * not been modified in the meantime */
+        _buffer->coherenceDirectory().share(nullptr, _offset, _cb, _version);
+    }
+
+    dcl::util::tracer.record("Map buffer", "memory", _submitted,
+            dcl::util::clock.getTime(), _cb);
+
+    return errcode;
+}
+
 /* ****************************************************************************/
 
 UnmapBufferCommand::UnmapBufferCommand(
@@ -115,7 +162,7 @@ UnmapBufferCommand::UnmapBufferCommand(
         size_t              cb,
         void *              ptr) :
     Command(CL_COMMAND_UNMAP_MEM_OBJECT, commandQueue), _memobj(memobj),
-    _flags(flags), _cb(cb), _ptr(ptr) {
+    _flags(flags), _cb(cb), _ptr(ptr), _submitted(0) {
     assert(_memobj != nullptr); // buffer must not be NULL
     _memobj->retain();
 }
@@ -125,6 +172,8 @@ UnmapBufferCommand::~UnmapBufferCommand() {
 }
 
 cl_int UnmapBufferCommand::submit() {
+    _submitted = dcl::util::clock.getTime();
+
     if ((_flags & CL_MAP_WRITE)) {
         /*
          * The mapped buffer region has to be synchronized, i.e., its data has
@@ -150,6 +199,9 @@ cl_int UnmapBufferCommand::complete(
         }
     }
 
+    dcl::util::tracer.record("Unmap buffer", "memory", _submitted,
+            dcl::util::clock.getTime(), _cb);
+
     return errcode;
 }
 
@@ -52,6 +52,7 @@
 #include <CL/cl.h>
 #endif
 
+#include <atomic>
 #include <cstddef>
 
 namespace dclicd {
@@ -68,17 +69,35 @@ public:
             cl_command_queue    commandQueue,
             Buffer *            buffer,
             cl_map_flags        flags,
+            size_t              offset,
             size_t              cb,
             void *              ptr);
     virtual ~MapBufferCommand();
 
+    bool isCompletedByHost() const;
+
 private:
     cl_int submit();
 
+    cl_int complete(
+            cl_int errcode);
+
+    void onDataReceived(
+            cl_int status);
+
+    void onStatusReceived(
+            cl_int status);
+
     Buffer *_buffer;
     cl_map_flags _flags;
+    size_t _offset;
     size_t _cb;
     void * _ptr;
+    cl_ulong _version; //!< Version of the buffer which is downloaded by this command
+    cl_ulong _submitted; //!< Time of submitting this command (for tracing)
+    std::atomic<size_t> _pending; //!< Number of pending receipts
+    std::atomic<cl_int> _status; //!< Completion status of the receipts
+    cl_int _remoteStatus; //!< Completion status sent by the compute node
 };
 
 /* ****************************************************************************/
@@ -103,6 +122,7 @@ private:
     cl_map_flags _flags;
     size_t _cb;
     void *_ptr;
+    cl_ulong _submitted; //!< Time of submitting this command (for tracing)
 };
 
 } /* namespace command */
@@ -56,6 +56,7 @@
 #include <CL/cl.h>
 #endif
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -65,31 +66,75 @@ namespace dclicd {
 namespace command {
 
 ReadMemoryCommand::ReadMemoryCommand(cl_command_type type,
-		cl_command_queue commandQueue, size_t cb, void *ptr) :
-	Command(type, commandQueue), _cb(cb), _ptr(ptr) {
+		cl_command_queue commandQueue, size_t cb, void *ptr,
+		size_t chunkSize) :
+	Command(type, commandQueue), _cb(cb), _ptr(ptr), _chunkSize(chunkSize),
+	_pending(0), _status(CL_SUCCESS), _remoteStatus(CL_SUCCESS) {
+}
+
+bool ReadMemoryCommand::isCompletedByHost() const {
+    /* ReadMemoryCommand is completed when data receipt is complete */
+    return true;
 }
 
 cl_int ReadMemoryCommand::submit() {
-	// start data receipt
-	std::shared_ptr<dcl::DataTransfer> receipt(
-			_commandQueue->computeNode().receiveData(_cb, _ptr));
-	// register callback to complete ReadMemoryCommand
-	receipt->setCallback(std::bind(
-	        &ReadMemoryCommand::onExecutionStatusChanged, this, std::placeholders::_1));
+    char *ptr = static_cast<char *>(_ptr);
+    size_t chunkSize = (_chunkSize && _cb > _chunkSize) ? _chunkSize : _cb;
+    size_t chunks = (chunkSize < _cb) ? (_cb + chunkSize - 1) / chunkSize : 1;
+
+    // start data receipt
+    /* All receipts must be counted before any receipt can complete */
+    _pending = chunks + 1;
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        size_t offset = chunk * chunkSize;
+        std::shared_ptr<dcl::DataTransfer> receipt(
+                _commandQueue->computeNode().receiveData(
+                        std::min(chunkSize, _cb - offset), ptr + offset));
+        receipt->setCallback(std::bind(
+                &ReadMemoryCommand::onChunkReceived, this, std::placeholders::_1));
+    }
+    /* The compute node sends its completion status after the data */
+    std::shared_ptr<dcl::DataTransfer> receipt(
+            _commandQueue->computeNode().receiveData(
+                    sizeof(_remoteStatus), &_remoteStatus));
+    receipt->setCallback(std::bind(
+            &ReadMemoryCommand::onStatusReceived, this, std::placeholders::_1));
 
 	return CL_RUNNING;
 }
 
+void ReadMemoryCommand::onChunkReceived(cl_int status) {
+    if (status != CL_SUCCESS) _status = status;
+    // complete ReadMemoryCommand when all chunks and the status have been received
+    if (--_pending == 0) onExecutionStatusChanged(_status);
+}
+
+void ReadMemoryCommand::onStatusReceived(cl_int status) {
+    /* Report a failure of the compute node, e.g., if the data could not be
+     * read from the device */
+    if (status == CL_SUCCESS) status = _remoteStatus;
+    onChunkReceived(status);
+}
+
 /* ****************************************************************************/
 
 WriteMemoryCommand::WriteMemoryCommand(cl_command_type type,
-		cl_command_queue commandQueue, size_t cb, const void *ptr) :
-	Command(type, commandQueue), _cb(cb), _ptr(ptr) {
+		cl_command_queue commandQueue, size_t cb, const void *ptr,
+		size_t chunkSize) :
+	Command(type, commandQueue), _cb(cb), _ptr(ptr), _chunkSize(chunkSize) {
 }
 
 cl_int WriteMemoryCommand::submit() {
     // start data sending
-	_commandQueue->computeNode().sendData(_cb, _ptr);
+    if (_chunkSize) {
+        const char *ptr = static_cast<const char *>(_ptr);
+        for (size_t offset = 0; offset < _cb; offset += _chunkSize) {
+            _commandQueue->computeNode().sendData(
+                    std::min(_chunkSize, _cb - offset), ptr + offset);
+        }
+    } else {
+        _commandQueue->computeNode().sendData(_cb, _ptr);
+    }
 	
     // WriteMemoryCommand will be completed by compute node
 
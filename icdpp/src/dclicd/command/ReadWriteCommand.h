@@ -52,6 +52,7 @@
 #include <CL/cl.h>
 #endif
 
+#include <atomic>
 #include <cstddef>
 
 namespace dclicd {
@@ -60,34 +61,57 @@ namespace command {
 
 class ReadMemoryCommand: public Command {
 public:
+    /*!
+     * \param[in]  chunkSize    if not 0, the data is received in chunks of
+     *             this size, each of which must be sent separately
+     */
     ReadMemoryCommand(
             cl_command_type     type,
             cl_command_queue    commandQueue,
             size_t              cb,
-            void *              ptr);
+            void *              ptr,
+            size_t              chunkSize = 0);
+
+    bool isCompletedByHost() const;
 
 private:
     cl_int submit();
 
+    void onChunkReceived(
+            cl_int status);
+
+    void onStatusReceived(
+            cl_int status);
+
     size_t _cb;
     void *_ptr;
+    size_t _chunkSize;
+    std::atomic<size_t> _pending; //!< Number of pending receipts
+    std::atomic<cl_int> _status; //!< Completion status of the receipts
+    cl_int _remoteStatus; //!< Completion status sent by the compute node
 };
 
 /* ****************************************************************************/
 
 class WriteMemoryCommand: public Command {
 public:
+    /*!
+     * \param[in]  chunkSize    if not 0, the data is sent in chunks of this
+     *             size, each of which must be received separately
+     */
     WriteMemoryCommand(
             cl_command_type     type,
             cl_command_queue    commandQueue,
             size_t              cb,
-            const void *        ptr);
+            const void *        ptr,
+            size_t              chunkSize = 0);
 
 private:
     cl_int submit();
 
     size_t _cb;
     const void *_ptr;
+    size_t _chunkSize;
 };
 
 } /* namespace command */
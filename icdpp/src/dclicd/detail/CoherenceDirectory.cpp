@@ -0,0 +1,218 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/**
+ * @file CoherenceDirectory.cpp
+ *
+ * @date 2026-10-16
+ * @author dmanam
+ */
+
+#include "CoherenceDirectory.h"
+
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace dclicd {
+
+namespace detail {
+
+CoherenceDirectory::CoherenceDirectory(
+        size_t size, size_t blockSize, bool hostValid) :
+    _size(size), _blockSize((blockSize > 0 && blockSize < size) ? blockSize : size),
+    _version(0), _hits(0), _misses(0) {
+    _blocks.resize((_size + _blockSize - 1) / _blockSize);
+    for (auto& block : _blocks) {
+        block.modified = 0;
+        if (hostValid) {
+            block.states[nullptr] = State::SHARED;
+        }
+    }
+}
+
+size_t CoherenceDirectory::blockSize() const {
+    return _blockSize;
+}
+
+CoherenceDirectory::State CoherenceDirectory::state(
+        const dcl::Process *process, size_t offset) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto& states = _blocks.at(offset / _blockSize).states;
+    auto i = states.find(process);
+    return (i == std::end(states)) ? State::INVALID : i->second;
+}
+
+cl_ulong CoherenceDirectory::version() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _version;
+}
+
+cl_ulong CoherenceDirectory::modify(const dcl::Process& process,
+        size_t offset, size_t cb, bool hostUpdated) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    size_t first = offset / _blockSize;
+    size_t last = (cb > 0) ? (offset + cb - 1) / _blockSize : first;
+
+    ++_version;
+    for (size_t i = first; i <= last && i < _blocks.size(); ++i) {
+        auto& block = _blocks[i];
+        bool hostValid = hostUpdated && (block.states.count(nullptr) == 1);
+
+        /* invalidate all other replicas */
+        block.states.clear();
+        if (hostValid) {
+            /* the host's replica includes the modification, i.e., the compute
+             * node and the host share the latest data */
+            block.states[nullptr] = State::SHARED;
+            block.states[&process] = State::SHARED;
+        } else {
+            block.states[&process] = State::MODIFIED;
+        }
+        block.modified = _version;
+    }
+
+    return _version;
+}
+
+cl_ulong CoherenceDirectory::modify(const dcl::Process& process) {
+    return modify(process, 0, _size);
+}
+
+void CoherenceDirectory::share(const dcl::Process *process,
+        size_t offset, size_t cb, cl_ulong version) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    /* only blocks entirely covered by the range */
+    size_t first = (offset + _blockSize - 1) / _blockSize;
+    size_t end = (offset + cb == _size) ? _blocks.size() : (offset + cb) / _blockSize;
+
+    for (size_t i = first; i < end; ++i) {
+        auto& block = _blocks[i];
+        if (block.modified > version) continue; // replica is out of date
+
+        for (auto& entry : block.states) {
+            entry.second = State::SHARED;
+        }
+        block.states[process] = State::SHARED;
+    }
+}
+
+bool CoherenceDirectory::lookupHost(size_t offset, size_t cb) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (isValidLocked(nullptr, offset, cb)) {
+        ++_hits;
+        return true;
+    } else {
+        ++_misses;
+        return false;
+    }
+}
+
+bool CoherenceDirectory::isHostValid(size_t offset, size_t cb) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return isValidLocked(nullptr, offset, cb);
+}
+
+std::vector<std::pair<size_t, size_t>> CoherenceDirectory::hostOnlyRanges(
+        const dcl::Process& process) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<std::pair<size_t, size_t>> ranges;
+
+    for (size_t i = 0; i < _blocks.size(); ++i) {
+        const auto& states = _blocks[i].states;
+        if (states.count(nullptr) == 0 || states.count(&process) == 1) continue;
+
+        size_t offset = i * _blockSize;
+        size_t cb = std::min(_blockSize, _size - offset);
+        if (!ranges.empty() && ranges.back().first + ranges.back().second == offset) {
+            ranges.back().second += cb; // merge with preceding block
+        } else {
+            ranges.push_back(std::make_pair(offset, cb));
+        }
+    }
+
+    return ranges;
+}
+
+void CoherenceDirectory::hit() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_hits;
+}
+
+void CoherenceDirectory::miss() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_misses;
+}
+
+cl_ulong CoherenceDirectory::hits() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hits;
+}
+
+cl_ulong CoherenceDirectory::misses() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _misses;
+}
+
+bool CoherenceDirectory::isValid(const dcl::Process *process,
+        size_t offset, size_t cb) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return isValidLocked(process, offset, cb);
+}
+
+bool CoherenceDirectory::isValidLocked(const dcl::Process *process,
+        size_t offset, size_t cb) const {
+    size_t first = offset / _blockSize;
+    size_t last = (cb > 0) ? (offset + cb - 1) / _blockSize : first;
+
+    for (size_t i = first; i <= last && i < _blocks.size(); ++i) {
+        if (_blocks[i].states.count(process) == 0) return false;
+    }
+    return true;
+}
+
+} /* namespace detail */
+
+} /* namespace dclicd */
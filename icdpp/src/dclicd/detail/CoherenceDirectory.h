@@ -0,0 +1,254 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/**
+ * @file CoherenceDirectory.h
+ *
+ * @date 2026-10-16
+ * @author dmanam
+ */
+
+#ifndef COHERENCEDIRECTORY_H_
+#define COHERENCEDIRECTORY_H_
+
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace dcl {
+class Process;
+} /* namespace dcl */
+
+namespace dclicd {
+
+namespace detail {
+
+/**
+ * @brief A directory of the replicas of a memory object.
+ *
+ * The directory implements an MSI protocol: it records for each compute node
+ * and for the host whether it holds the latest modification of the memory
+ * object (modified), a valid replica (shared), or no valid replica (invalid).
+ * The host (denoted by @c NULL) uses the directory to serve requests for a
+ * memory object's data from its own replica rather than transferring the data
+ * from a compute node again.
+ *
+ * The memory object is divided into blocks of a fixed size, for which states
+ * are recorded separately. Thus, only the blocks touched by a command are
+ * invalidated, and replicas of the remaining blocks stay valid.
+ *
+ * Modifications are recorded when a modifying command is enqueued. Each
+ * modification increments the directory's version, such that a replica which
+ * is obtained asynchronously is only considered valid if the blocks have not
+ * been modified in the meantime.
+ */
+class CoherenceDirectory {
+public:
+    enum class State {
+        MODIFIED, SHARED, INVALID
+    };
+
+    /**
+     * @brief Creates a directory for a memory object.
+     *
+     * @param[in]  size         the size of the memory object in bytes
+     * @param[in]  blockSize    the size of a block in bytes; if 0, the memory
+     *                          object is treated as a single block
+     * @param[in]  hostValid    @c true, if the host holds a valid replica of
+     *                          the memory object, e.g., its initial data
+     */
+    CoherenceDirectory(
+            size_t size,
+            size_t blockSize,
+            bool   hostValid);
+
+    size_t blockSize() const;
+
+    /**
+     * @brief Returns the state of a process' replica of a block
+     *
+     * @param[in]  process  a compute node, or @c NULL for the host
+     * @param[in]  offset   an offset within the block
+     * @return the state of the process' replica
+     */
+    State state(
+            const dcl::Process *process,
+            size_t              offset) const;
+
+    /**
+     * @brief Returns the current version of the memory object
+     *
+     * @return the number of modifications recorded by this directory
+     */
+    cl_ulong version() const;
+
+    /**
+     * @brief Records a modification of a range of the memory object by a compute node.
+     *
+     * The compute node becomes the owner of all blocks overlapping the range,
+     * while all other replicas of these blocks are invalidated.
+     *
+     * @param[in]  process      the compute node that modifies the memory object
+     * @param[in]  offset       offset of the modified range
+     * @param[in]  cb           size of the modified range in bytes
+     * @param[in]  hostUpdated  @c true, if the modification is made from the
+     *                          host's replica (e.g., unmapping); a valid host
+     *                          replica then remains valid
+     * @return the version produced by the modification
+     */
+    cl_ulong modify(
+            const dcl::Process& process,
+            size_t              offset,
+            size_t              cb,
+            bool                hostUpdated = false);
+
+    /**
+     * @brief Records a modification of the entire memory object by a compute node.
+     */
+    cl_ulong modify(
+            const dcl::Process& process);
+
+    /**
+     * @brief Records that a process obtained a replica of a range of a specified version.
+     *
+     * Only replicas of blocks that are entirely covered by the range become
+     * valid, and only if these blocks have not been modified since
+     * @c version. A modified replica of such a block is downgraded to shared.
+     *
+     * @param[in]  process  the compute node that obtained a replica, or
+     *                      @c NULL for the host
+     * @param[in]  offset   offset of the obtained range
+     * @param[in]  cb       size of the obtained range in bytes
+     * @param[in]  version  the version of the obtained replica
+     */
+    void share(
+            const dcl::Process *process,
+            size_t              offset,
+            size_t              cb,
+            cl_ulong            version);
+
+    /**
+     * @brief Looks up the host's replica of a range.
+     *
+     * The lookup is counted as hit if the host's replicas of all blocks
+     * overlapping the range are valid, otherwise it is counted as miss.
+     *
+     * @param[in]  offset   offset of the range
+     * @param[in]  cb       size of the range in bytes
+     * @return @c true, if the host's replica is valid, otherwise @c false
+     */
+    bool lookupHost(
+            size_t offset,
+            size_t cb);
+
+    /**
+     * @brief Checks if a process holds a valid replica of a range.
+     *
+     * @param[in]  process  a compute node, or @c NULL for the host
+     * @param[in]  offset   offset of the range
+     * @param[in]  cb       size of the range in bytes
+     * @return @c true, if the process' replicas of all blocks overlapping the
+     *         range are valid, otherwise @c false
+     */
+    bool isValid(
+            const dcl::Process *process,
+            size_t              offset,
+            size_t              cb) const;
+
+    bool isHostValid(
+            size_t offset,
+            size_t cb) const;
+
+    /**
+     * @brief Determines the ranges which a process can obtain from the host.
+     *
+     * These are the ranges of blocks for which the host holds a valid replica,
+     * while the process does not.
+     *
+     * @param[in]  process  a compute node
+     * @return the ranges as pairs of offset and size; adjacent blocks are
+     *         merged into a single range
+     */
+    std::vector<std::pair<size_t, size_t>> hostOnlyRanges(
+            const dcl::Process& process) const;
+
+    void hit();
+    void miss();
+
+    cl_ulong hits() const;
+    cl_ulong misses() const;
+
+private:
+    /**
+     * @brief Checks if a process holds a valid replica of a range.
+     *
+     * The directory's mutex must be locked by the caller.
+     *
+     * @see isValid
+     */
+    bool isValidLocked(
+            const dcl::Process *process,
+            size_t              offset,
+            size_t              cb) const;
+
+    struct Block {
+        /* Directory entries; replicas without an entry are invalid */
+        std::map<const dcl::Process *, State> states;
+        cl_ulong modified; /**< Version of the last modification of this block */
+    };
+
+    size_t _size; /**< Size of the memory object */
+    size_t _blockSize;
+    std::vector<Block> _blocks;
+    cl_ulong _version; /**< Number of recorded modifications */
+    cl_ulong _hits; /**< Requests served from the host's replica */
+    cl_ulong _misses; /**< Requests that required a data transfer from a compute node */
+    mutable std::mutex _mutex;
+};
+
+} /* namespace detail */
+
+} /* namespace dclicd */
+
+#endif /* COHERENCEDIRECTORY_H_ */
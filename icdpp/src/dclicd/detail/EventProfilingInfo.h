@@ -62,10 +62,12 @@ public:
      * The input times are provided by two different clocks (compute node and
      * device clock). Internally the skew of these clocks is computed and added
      * to all values. Thus, the values returned by this event profiling info are
-     * adjusted to the compute node clock.
+     * adjusted to the clock of the received time.
+     * The host converts the received time to its own clock, such that the
+     * profiling info of different compute nodes is comparable.
      *
-     * @param[in]  received time of receiving/enqueuing (compute node clock) on
-     *                      the compute node
+     * @param[in]  received time of receiving/enqueuing the command on the
+     *                      compute node (compute node or host clock)
      * @param[in]  queued   time of enqueuing the command (device clock)
      * @param[in]  submit   time of submitting the command (device clock)
      * @param[in]  start    time of starting the command (device clock)
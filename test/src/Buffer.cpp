@@ -131,4 +131,42 @@ BOOST_AUTO_TEST_CASE( CreateBufferCopyHostPtr )
     clReleaseMemObject(buffer);
 }
 
+BOOST_AUTO_TEST_CASE( WriteReadBufferChunks )
+{
+    /* The buffer range spans several chunks (see DCL_PIPELINE_CHUNK_SIZE)
+     * with a smaller last chunk */
+    const size_t VEC_SIZE = 3 * 1024 * 1024 + 17;
+    const size_t OFFSET = 5;
+    std::vector<cl_int> vec1(VEC_SIZE, 0), vec2(VEC_SIZE, 1);
+    cl_int err = CL_SUCCESS;
+
+    dcltest::fillVector(vec1, 1, 1); // initialize input data
+
+    cl_mem buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, (VEC_SIZE + OFFSET) * sizeof(cl_int), nullptr, &err);
+    BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+
+    // upload first host pointer to buffer
+    err = clEnqueueWriteBuffer(
+            commandQueue,
+            buffer,
+            CL_FALSE,
+            OFFSET * sizeof(cl_int), VEC_SIZE * sizeof(cl_int), &vec1.front(),
+            0, nullptr, nullptr);
+    BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+
+    // download buffer to second host pointer
+    err = clEnqueueReadBuffer(
+            commandQueue,
+            buffer,
+            CL_TRUE,
+            OFFSET * sizeof(cl_int), VEC_SIZE * sizeof(cl_int), &vec2.front(),
+            0, nullptr, nullptr);
+    BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+
+    BOOST_CHECK_MESSAGE(vec1 == vec2, "Input and output buffers differ"); // compare input and output data
+
+    // clean up
+    clReleaseMemObject(buffer);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Buffer test suite
@@ -0,0 +1,143 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file ByteBuffer.cpp
+ *
+ * Byte buffer allocation benchmark
+ *
+ * Counts heap allocations of message pack/unpack cycles, which should not
+ * allocate any memory in steady state as byte buffers are pooled.
+ *
+ * \date 2026-10-15
+ * \author dmanam
+ */
+
+#include <dclasio/message/EnqueueNDRangeKernel.h>
+
+#include <dcl/ByteBuffer.h>
+#include <dcl/DCLTypes.h>
+
+#define BOOST_TEST_MODULE ByteBuffer
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace {
+
+std::atomic<unsigned long> allocations(0); //!< number of heap allocations
+
+const unsigned long NUM_CYCLES = 1000000;
+
+} /* unnamed namespace */
+
+/* count all heap allocations of this program */
+void * operator new(std::size_t size) {
+    ++allocations;
+    void *ptr = std::malloc(size ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void * operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    std::free(ptr);
+}
+
+BOOST_AUTO_TEST_CASE( GrowBuffer )
+{
+    dcl::ByteBuffer buf;
+    std::vector<cl_uint> values(100000);
+
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        buf << static_cast<cl_uint>(i);
+    }
+    BOOST_REQUIRE_EQUAL(buf.size(), values.size() * sizeof(cl_uint));
+
+    for (auto& value : values) {
+        buf >> value;
+    }
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(values[i], i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( PackUnpackAllocations )
+{
+    std::vector<dcl::object_id> eventIds(8, 1);
+    dclasio::message::EnqueueNDRangeKernel request(1, 2, 3,
+            std::vector<size_t>(), std::vector<size_t>(3, 1024),
+            std::vector<size_t>(3, 16), &eventIds, true);
+    dclasio::message::EnqueueNDRangeKernel received;
+    std::vector<char> bytes;
+
+    auto cycle = [&] {
+        dcl::ByteBuffer buf;
+        request.pack(buf);
+        bytes.assign(buf.begin(), buf.end()); // 'send' message
+
+        dcl::ByteBuffer in(dcl::ByteBuffer::view(bytes.size(), bytes.data()));
+        received.unpack(in);
+    };
+
+    cycle(); // warm up block pool and message fields
+
+    unsigned long initialAllocations = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < NUM_CYCLES; ++i) {
+        cycle();
+    }
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    unsigned long cycleAllocations = allocations - initialAllocations;
+
+    BOOST_TEST_MESSAGE(NUM_CYCLES << " EnqueueNDRangeKernel pack/unpack cycles: "
+            << cycleAllocations << " heap allocations, "
+            << (time.count() * 1e9 / NUM_CYCLES) << " ns/cycle");
+    BOOST_CHECK_EQUAL(cycleAllocations, 0);
+    BOOST_CHECK_EQUAL(received.global().size(), 3);
+}
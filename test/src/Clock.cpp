@@ -0,0 +1,157 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file Clock.cpp
+ *
+ * Clock offset estimation test
+ *
+ * Checks that the offset and drift of a remote clock are estimated from
+ * synthetic samples and that samples with a large round-trip delay are
+ * ignored.
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include <dcl/util/Clock.h>
+
+#define BOOST_TEST_MODULE Clock
+#include <boost/test/unit_test.hpp>
+
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#include <cmath>
+
+namespace {
+
+/*!
+ * \brief Adds a sample of a remote clock with a specified offset and drift
+ *
+ * \param[in]  clockOffset  the estimator to add the sample to
+ * \param[in]  t0           local time of sending the request
+ * \param[in]  offset       offset of the remote clock at local time 0
+ * \param[in]  drift        drift of the remote clock
+ * \param[in]  delay        one-way delay of request and response
+ */
+void addSample(dcl::util::ClockOffset& clockOffset, cl_ulong t0,
+        double offset, double drift, cl_ulong delay) {
+    const cl_ulong PROCESSING_TIME = 1000;
+    auto remoteTime = [=](cl_ulong localTime) {
+        return static_cast<cl_ulong>(std::llround(localTime + offset + drift * localTime));
+    };
+
+    cl_ulong t1 = remoteTime(t0 + delay);
+    cl_ulong t2 = remoteTime(t0 + delay + PROCESSING_TIME);
+    clockOffset.addSample(t0, t1, t2, t0 + 2 * delay + PROCESSING_TIME);
+}
+
+} /* unnamed namespace */
+
+BOOST_AUTO_TEST_CASE( NoSamples )
+{
+    dcl::util::ClockOffset clockOffset;
+
+    BOOST_CHECK(!clockOffset.isValid());
+    BOOST_CHECK_EQUAL(clockOffset.toLocalTime(1000), 1000);
+}
+
+BOOST_AUTO_TEST_CASE( ConstantOffset )
+{
+    const double OFFSET = 5e9;
+    dcl::util::ClockOffset clockOffset;
+
+    for (cl_ulong i = 0; i < 8; ++i) {
+        addSample(clockOffset, 1000000 + i * 100000, OFFSET, 0.0, 20000);
+    }
+
+    BOOST_REQUIRE(clockOffset.isValid());
+    BOOST_CHECK_CLOSE(clockOffset.offset(2000000), OFFSET, 1e-6);
+    BOOST_CHECK_EQUAL(clockOffset.drift(), 0.0);
+    BOOST_CHECK_LE(clockOffset.error(), 20000.0);
+    BOOST_CHECK_EQUAL(clockOffset.toLocalTime(6000000000), 1000000000);
+}
+
+BOOST_AUTO_TEST_CASE( NegativeOffset )
+{
+    dcl::util::ClockOffset clockOffset;
+
+    addSample(clockOffset, 8000000000, -3e9, 0.0, 20000);
+
+    BOOST_CHECK_CLOSE(clockOffset.offset(8000000000), -3e9, 1e-6);
+    BOOST_CHECK_EQUAL(clockOffset.toLocalTime(5000000000), 8000000000);
+}
+
+BOOST_AUTO_TEST_CASE( Drift )
+{
+    const double OFFSET = 1e6;
+    const double DRIFT = 50e-6; // 50 ppm
+    dcl::util::ClockOffset clockOffset;
+
+    /* Samples span 10 seconds */
+    for (cl_ulong i = 0; i <= 10; ++i) {
+        addSample(clockOffset, i * 1000000000, OFFSET, DRIFT, 20000);
+    }
+
+    BOOST_CHECK_CLOSE(clockOffset.drift(), DRIFT, 0.1);
+    BOOST_CHECK_LE(clockOffset.error(), 20000.0);
+
+    /* Extrapolate beyond the last sample */
+    const cl_ulong localTime = 20000000000;
+    const double remoteTime = localTime + OFFSET + DRIFT * localTime;
+    BOOST_CHECK_CLOSE(clockOffset.offset(localTime), remoteTime - localTime, 0.1);
+    BOOST_CHECK_LE(std::abs(static_cast<double>(clockOffset.toLocalTime(
+            static_cast<cl_ulong>(remoteTime))) - localTime), 1000.0);
+}
+
+BOOST_AUTO_TEST_CASE( IgnoreDelayedSamples )
+{
+    const double OFFSET = 1e6;
+    dcl::util::ClockOffset clockOffset;
+
+    addSample(clockOffset, 1000000, OFFSET, 0.0, 20000);
+    /* A response which is delayed by a queue distorts the offset */
+    clockOffset.addSample(2000000, 2000000 + 20000 + OFFSET,
+            2000000 + 21000 + OFFSET, 2000000 + 20000 + 1000 + 5000000);
+    addSample(clockOffset, 3000000, OFFSET, 0.0, 20000);
+
+    BOOST_CHECK_CLOSE(clockOffset.offset(3000000), OFFSET, 1e-6);
+    BOOST_CHECK_LE(clockOffset.error(), 20000.0);
+}
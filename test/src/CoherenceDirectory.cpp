@@ -0,0 +1,159 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file CoherenceDirectory.cpp
+ *
+ * Coherence directory test
+ *
+ * Checks the states which the coherence directory of a memory object records
+ * for the replicas of its blocks on compute nodes and on the host.
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include "CoherenceDirectory.h"
+
+#include <dcl/DataTransfer.h>
+#include <dcl/DCLTypes.h>
+#include <dcl/Process.h>
+
+#define BOOST_TEST_MODULE CoherenceDirectory
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using dclicd::detail::CoherenceDirectory;
+
+namespace {
+
+const size_t BLOCK_SIZE = 1024;
+
+/*!
+ * \brief A compute node which only serves as a key of directory entries
+ */
+class ComputeNode : public dcl::Process {
+public:
+    ComputeNode(dcl::process_id id) : _id(id), _url("localhost") { }
+
+    dcl::process_id get_id() const { return _id; }
+    const std::string& url() const { return _url; }
+    void sendMessage(const dclasio::message::Message&) const { }
+    std::shared_ptr<dcl::DataTransfer> sendData(size_t, const void *,
+            dcl::DataTransfer::Priority) { return nullptr; }
+    std::shared_ptr<dcl::DataTransfer> receiveData(size_t, void *,
+            dcl::DataTransfer::Priority) { return nullptr; }
+
+private:
+    dcl::process_id _id;
+    std::string _url;
+};
+
+} /* unnamed namespace */
+
+BOOST_AUTO_TEST_CASE( SharePartialBlocks )
+{
+    ComputeNode node(1);
+    CoherenceDirectory directory(4 * BLOCK_SIZE, BLOCK_SIZE, false);
+
+    cl_ulong version = directory.modify(node);
+    BOOST_CHECK(directory.state(&node, 0) == CoherenceDirectory::State::MODIFIED);
+    BOOST_CHECK(!directory.isHostValid(0, 4 * BLOCK_SIZE));
+
+    /* only block 1 is entirely covered by the range */
+    directory.share(nullptr, BLOCK_SIZE / 2, 2 * BLOCK_SIZE, version);
+    BOOST_CHECK(!directory.isHostValid(0, BLOCK_SIZE));
+    BOOST_CHECK(directory.isHostValid(BLOCK_SIZE, BLOCK_SIZE));
+    BOOST_CHECK(!directory.isHostValid(2 * BLOCK_SIZE, BLOCK_SIZE));
+    BOOST_CHECK(directory.state(&node, 0) == CoherenceDirectory::State::MODIFIED);
+    BOOST_CHECK(directory.state(&node, BLOCK_SIZE) == CoherenceDirectory::State::SHARED);
+
+    /* a replica of an outdated version does not become valid */
+    directory.modify(node, 3 * BLOCK_SIZE, BLOCK_SIZE);
+    directory.share(nullptr, 2 * BLOCK_SIZE, 2 * BLOCK_SIZE, version);
+    BOOST_CHECK(directory.isHostValid(2 * BLOCK_SIZE, BLOCK_SIZE));
+    BOOST_CHECK(!directory.isHostValid(3 * BLOCK_SIZE, BLOCK_SIZE));
+}
+
+BOOST_AUTO_TEST_CASE( ModifyFromHost )
+{
+    ComputeNode node1(1), node2(2);
+    CoherenceDirectory directory(4 * BLOCK_SIZE, BLOCK_SIZE, true);
+
+    /* the host's replica includes the modification */
+    directory.modify(node1, 0, BLOCK_SIZE, true);
+    BOOST_CHECK(directory.state(nullptr, 0) == CoherenceDirectory::State::SHARED);
+    BOOST_CHECK(directory.state(&node1, 0) == CoherenceDirectory::State::SHARED);
+
+    /* other replicas are invalidated */
+    directory.modify(node2, 0, 2 * BLOCK_SIZE, true);
+    BOOST_CHECK(directory.state(&node1, 0) == CoherenceDirectory::State::INVALID);
+    BOOST_CHECK(directory.state(&node2, BLOCK_SIZE) == CoherenceDirectory::State::SHARED);
+    BOOST_CHECK(directory.isHostValid(0, 2 * BLOCK_SIZE));
+
+    /* the host's replica does not become valid if it has been invalid before */
+    directory.modify(node1, 2 * BLOCK_SIZE, BLOCK_SIZE);
+    directory.modify(node2, 2 * BLOCK_SIZE, BLOCK_SIZE, true);
+    BOOST_CHECK(!directory.isHostValid(2 * BLOCK_SIZE, BLOCK_SIZE));
+    BOOST_CHECK(directory.state(&node2, 2 * BLOCK_SIZE) == CoherenceDirectory::State::MODIFIED);
+}
+
+BOOST_AUTO_TEST_CASE( MergeHostOnlyRanges )
+{
+    /* the last block is smaller than the others */
+    const size_t size = 6 * BLOCK_SIZE - BLOCK_SIZE / 2;
+    ComputeNode node1(1), node2(2);
+    CoherenceDirectory directory(size, BLOCK_SIZE, true);
+
+    directory.modify(node2, 2 * BLOCK_SIZE, BLOCK_SIZE);
+    directory.share(&node1, 3 * BLOCK_SIZE, BLOCK_SIZE, directory.version());
+
+    auto ranges = directory.hostOnlyRanges(node1);
+    BOOST_REQUIRE_EQUAL(ranges.size(), 2);
+    BOOST_CHECK_EQUAL(ranges[0].first, 0);
+    BOOST_CHECK_EQUAL(ranges[0].second, 2 * BLOCK_SIZE);
+    BOOST_CHECK_EQUAL(ranges[1].first, 4 * BLOCK_SIZE);
+    BOOST_CHECK_EQUAL(ranges[1].second, size - 4 * BLOCK_SIZE);
+
+    /* all blocks are valid on node2 or not valid on the host */
+    directory.share(&node2, 0, size, directory.version());
+    BOOST_CHECK(directory.hostOnlyRanges(node2).empty());
+}
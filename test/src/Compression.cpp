@@ -0,0 +1,157 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file Compression.cpp
+ *
+ * Data stream compression test and benchmark
+ *
+ * Checks that chunks survive compression unchanged, that incompressible
+ * chunks are detected, and measures the compression throughput.
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include <comm/Compression.h>
+
+#define BOOST_TEST_MODULE Compression
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+namespace {
+
+const std::size_t CHUNK_SIZE = 1024 * 1024;
+
+/*!
+ * \brief Compresses and decompresses a chunk
+ *
+ * \param[in]  chunk    the chunk to compress
+ * \return the size of the compressed chunk, or 0 if the chunk is incompressible
+ */
+std::size_t roundTrip(const std::vector<char>& chunk) {
+    std::vector<char> compressed(chunk.size() - chunk.size() / 8);
+    std::size_t size = dclasio::comm::compression::compress(
+            chunk.data(), chunk.size(), compressed.data(), compressed.size());
+    if (size == 0) return 0;
+
+    std::vector<char> decompressed(chunk.size());
+    std::size_t decompressedSize = 0;
+    BOOST_REQUIRE(dclasio::comm::compression::decompress(
+            compressed.data(), size, decompressed.data(), decompressed.size(), decompressedSize));
+    BOOST_REQUIRE_EQUAL(decompressedSize, chunk.size());
+    BOOST_CHECK_MESSAGE(decompressed == chunk, "Decompressed chunk differs");
+    return size;
+}
+
+} /* unnamed namespace */
+
+BOOST_AUTO_TEST_CASE( CompressRegularData )
+{
+    std::vector<char> chunk(CHUNK_SIZE);
+    std::vector<float> values(CHUNK_SIZE / sizeof(float));
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(i % 1000) * 0.5f;
+    }
+    std::copy(reinterpret_cast<const char *>(values.data()),
+            reinterpret_cast<const char *>(values.data() + values.size()), chunk.begin());
+
+    auto start = std::chrono::steady_clock::now();
+    std::size_t size = roundTrip(chunk);
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+
+    BOOST_REQUIRE_GT(size, 0U);
+    BOOST_TEST_MESSAGE("Compression ratio: " << static_cast<double>(chunk.size()) / size
+            << ", round trip: " << 1000.0 * chunk.size() / elapsed.count() << " MB/s");
+}
+
+BOOST_AUTO_TEST_CASE( DetectIncompressibleData )
+{
+    std::vector<char> chunk(CHUNK_SIZE);
+    std::mt19937 generator;
+    for (auto& byte : chunk) {
+        byte = static_cast<char>(generator());
+    }
+
+    BOOST_CHECK_EQUAL(roundTrip(chunk), 0U);
+}
+
+BOOST_AUTO_TEST_CASE( CompressMixedData )
+{
+    /* chunk sizes include tiny chunks and chunks whose matches overlap their
+     * last bytes */
+    std::mt19937 generator;
+    for (std::size_t size : { 0, 1, 12, 13, 64, 4097, 65536 + 7, 300000 }) {
+        std::vector<char> chunk(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            chunk[i] = static_cast<char>((i % 300 < 200) ? i / 7 % 5 : generator() % 4);
+        }
+
+        std::vector<char> compressed(size + size / 255 + 16);
+        std::size_t compressedSize = dclasio::comm::compression::compress(
+                chunk.data(), size, compressed.data(), compressed.size());
+        BOOST_REQUIRE_GT(compressedSize, 0U);
+
+        std::vector<char> decompressed(size);
+        std::size_t decompressedSize = 0;
+        BOOST_REQUIRE(dclasio::comm::compression::decompress(
+                compressed.data(), compressedSize, decompressed.data(), size, decompressedSize));
+        BOOST_CHECK_EQUAL(decompressedSize, size);
+        BOOST_CHECK_MESSAGE(decompressed == chunk, "Decompressed chunk differs");
+    }
+}
+
+BOOST_AUTO_TEST_CASE( RejectCorruptedData )
+{
+    std::vector<char> chunk(CHUNK_SIZE, 0);
+    std::vector<char> compressed(CHUNK_SIZE);
+    std::size_t size = dclasio::comm::compression::compress(
+            chunk.data(), chunk.size(), compressed.data(), compressed.size());
+    BOOST_REQUIRE_GT(size, 0U);
+
+    // decompressed chunk must not exceed its buffer
+    std::vector<char> decompressed(CHUNK_SIZE / 2);
+    std::size_t decompressedSize = 0;
+    BOOST_CHECK(!dclasio::comm::compression::decompress(
+            compressed.data(), size, decompressed.data(), decompressed.size(), decompressedSize));
+}
@@ -220,4 +220,41 @@ BOOST_AUTO_TEST_CASE( ConcurrentWriteRead )
     clReleaseMemObject(buffer1);
 }
 
+/*!
+ * \brief Test that the initial data of a buffer does not overwrite changes
+ *        which a compute node acquired before using the buffer
+ */
+BOOST_AUTO_TEST_CASE( AcquireBeforeFirstUse )
+{
+    cl_event write = nullptr;
+    std::vector<cl_int> vecInit(vecSize, 0), vecIn(vecSize, 0), vecOut(vecSize, 0);
+    cl_int err = CL_SUCCESS;
+
+    dcltest::fillVector(vecIn, 1, 1); // initialize input data
+
+    // initial data is uploaded to a compute node on first use
+    cl_mem initBuffer = clCreateBuffer(context,
+            CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, cb, &vecInit.front(), &err);
+    BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+
+    // modify buffer on first compute node
+    err = clEnqueueWriteBuffer(commandQueues[0], initBuffer, CL_FALSE, 0, cb,
+            &vecIn.front(), 0, nullptr, &write);
+    BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+    // second compute node acquires changes with a command which does not use the buffer
+    err = clEnqueueReadBuffer(commandQueues[1], buffer, CL_TRUE, 0, cb,
+            &vecOut.front(), 1, &write, nullptr);
+    BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+    // use buffer on second compute node for the first time
+    err = clEnqueueReadBuffer(commandQueues[1], initBuffer, CL_TRUE, 0, cb,
+            &vecOut.front(), 1, &write, nullptr);
+    BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+
+    BOOST_CHECK_MESSAGE(vecIn == vecOut, "Input and output buffers differ"); // compare input and output data
+
+    // clean up
+    clReleaseEvent(write);
+    clReleaseMemObject(initBuffer);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,204 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+
+/*!
+ * \file RequestExecutor.cpp
+ *
+ * Request executor test
+ *
+ * Checks that tasks of a strand are executed in order, and that tasks which
+ * are submitted to several strands are executed after the preceding tasks of
+ * these strands.
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include "comm/RequestExecutor.h"
+
+#define BOOST_TEST_MODULE RequestExecutor
+#include <boost/test/unit_test.hpp>
+
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using dclasio::comm::RequestExecutor;
+
+namespace {
+
+/*!
+ * \brief Records the order in which tasks are executed
+ */
+class Log {
+public:
+    RequestExecutor::task_type record(const std::string& name) {
+        return [this, name] {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _entries.push_back(name);
+        };
+    }
+
+    std::vector<std::string> entries() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _entries;
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::string> _entries;
+};
+
+const dcl::process_id PID = 1;
+const RequestExecutor::strand_id HOST(PID, 0);
+const RequestExecutor::strand_id QUEUE1(PID, 1);
+const RequestExecutor::strand_id QUEUE2(PID, 2);
+
+} /* unnamed namespace */
+
+BOOST_AUTO_TEST_CASE( ExecuteInOrder )
+{
+    RequestExecutor executor(4);
+    Log log;
+    std::promise<void> done;
+
+    for (int i = 0; i < 100; ++i) {
+        executor.execute(QUEUE1, log.record(std::to_string(i)));
+    }
+    executor.execute(QUEUE1, [&done] { done.set_value(); });
+    done.get_future().wait();
+
+    auto entries = log.entries();
+    BOOST_REQUIRE_EQUAL(entries.size(), 100);
+    for (int i = 0; i < 100; ++i) {
+        BOOST_CHECK_EQUAL(entries[i], std::to_string(i));
+    }
+}
+
+BOOST_AUTO_TEST_CASE( ExecuteAfter )
+{
+    RequestExecutor executor(4);
+    Log log;
+    std::promise<void> gate;
+    std::shared_future<void> opened(gate.get_future());
+    std::promise<void> done;
+
+    auto create = log.record("create");
+    executor.execute(HOST, [create, opened] { opened.wait(); create(); });
+    executor.executeAfter(std::vector<RequestExecutor::strand_id>(1, QUEUE1),
+            std::vector<RequestExecutor::strand_id>(1, HOST), log.record("enqueue"));
+    executor.execute(QUEUE1, [&done] { done.set_value(); });
+
+    gate.set_value();
+    done.get_future().wait();
+
+    auto entries = log.entries();
+    BOOST_REQUIRE_EQUAL(entries.size(), 2);
+    BOOST_CHECK_EQUAL(entries[0], "create");
+    BOOST_CHECK_EQUAL(entries[1], "enqueue");
+}
+
+BOOST_AUTO_TEST_CASE( ExecuteAfterIdleStrand )
+{
+    RequestExecutor executor(4);
+    std::promise<void> gate;
+    std::shared_future<void> opened(gate.get_future());
+    std::promise<void> done;
+
+    /* the host's strand is blocked by a task which is submitted afterwards */
+    executor.executeAfter(std::vector<RequestExecutor::strand_id>(1, QUEUE1),
+            std::vector<RequestExecutor::strand_id>(1, HOST),
+            [&done] { done.set_value(); });
+    executor.execute(HOST, [opened] { opened.wait(); });
+
+    done.get_future().wait();
+    gate.set_value();
+}
+
+BOOST_AUTO_TEST_CASE( ExecuteBarrier )
+{
+    RequestExecutor executor(4);
+    Log log;
+    std::promise<void> gate;
+    std::shared_future<void> opened(gate.get_future());
+    std::promise<void> done;
+
+    auto enqueue1 = log.record("enqueue1");
+    auto enqueue2 = log.record("enqueue2");
+    executor.execute(QUEUE1, [enqueue1, opened] { opened.wait(); enqueue1(); });
+    executor.execute(QUEUE2, [enqueue2, opened] { opened.wait(); enqueue2(); });
+    executor.executeBarrier(std::vector<RequestExecutor::strand_id>(1, HOST),
+            log.record("release"));
+    /* tasks submitted afterwards to strands of the barrier wait for it */
+    executor.execute(QUEUE1, log.record("enqueue3"));
+    executor.execute(HOST, [&done] { done.set_value(); });
+
+    gate.set_value();
+    done.get_future().wait();
+    /* wait for the last task of the other strand */
+    std::promise<void> flushed;
+    executor.execute(QUEUE1, [&flushed] { flushed.set_value(); });
+    flushed.get_future().wait();
+
+    auto entries = log.entries();
+    BOOST_REQUIRE_EQUAL(entries.size(), 4);
+    BOOST_CHECK_EQUAL(entries[2], "release");
+    BOOST_CHECK_EQUAL(entries[3], "enqueue3");
+}
+
+BOOST_AUTO_TEST_CASE( CancelJointTask )
+{
+    RequestExecutor executor(4);
+    Log log;
+    std::promise<void> gate;
+    std::shared_future<void> opened(gate.get_future());
+    std::promise<void> started;
+    std::promise<void> cancelled;
+
+    executor.execute(QUEUE1, [&started, opened] { started.set_value(); opened.wait(); });
+    started.get_future().wait();
+    /* QUEUE2 is parked until QUEUE1 reaches the joint task */
+    executor.executeAfter(std::vector<RequestExecutor::strand_id>{ QUEUE1, QUEUE2 },
+            std::vector<RequestExecutor::strand_id>(), log.record("broadcast"));
+
+    executor.cancel(PID, [&cancelled] { cancelled.set_value(); });
+    gate.set_value();
+    cancelled.get_future().wait();
+
+    BOOST_CHECK(log.entries().empty());
+}
@@ -0,0 +1,188 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file ResponseBuffer.cpp
+ *
+ * Response buffer test suite
+ *
+ * Checks that responses are matched to their requests, and measures the cost
+ * of dispatching a response while a large number of other requests is in
+ * flight.
+ *
+ * \date 2026-10-15
+ * \author dmanam
+ */
+
+#include <comm/ResponseBuffer.h>
+
+#include <dclasio/message/DeleteKernel.h>
+#include <dclasio/message/Request.h>
+#include <dclasio/message/Response.h>
+
+#define BOOST_TEST_MODULE ResponseBuffer
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const unsigned int NUM_RESPONSES = 20000;
+
+std::unique_ptr<dclasio::message::Response> createResponse(
+        const dclasio::message::Request& request) {
+    return std::unique_ptr<dclasio::message::Response>(
+            new dclasio::message::DefaultResponse(request));
+}
+
+/*!
+ * \brief Measures the average time of dispatching a response to a waiting thread.
+ *
+ * \param[in]  inFlight the number of other outstanding requests
+ * \return the average time per response in nanoseconds
+ */
+double dispatchTime(std::size_t inFlight) {
+    dclasio::comm::ResponseBuffer responseBuffer;
+    std::vector<dclasio::message::DeleteKernel> pending(inFlight);
+    std::vector<dclasio::message::DeleteKernel> requests(NUM_RESPONSES);
+
+    /* fill buffer with responses nobody is waiting for yet */
+    for (const auto& request : pending) {
+        responseBuffer.put(createResponse(request));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread dispatcher([&] {
+        for (const auto& request : requests) {
+            responseBuffer.put(createResponse(request));
+        }
+    });
+    for (const auto& request : requests) {
+        BOOST_REQUIRE(responseBuffer.get(request));
+    }
+    dispatcher.join();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+
+    /* outstanding responses must not have been lost */
+    for (const auto& request : pending) {
+        BOOST_REQUIRE(responseBuffer.tryGet(request));
+    }
+
+    return static_cast<double>(elapsed.count()) / NUM_RESPONSES;
+}
+
+} /* unnamed namespace */
+
+BOOST_AUTO_TEST_CASE( OutOfOrderResponses )
+{
+    dclasio::comm::ResponseBuffer responseBuffer;
+    std::vector<dclasio::message::DeleteKernel> requests(8);
+
+    /* complete requests in reverse order */
+    for (auto request = requests.rbegin(); request != requests.rend(); ++request) {
+        responseBuffer.put(createResponse(*request));
+    }
+
+    for (const auto& request : requests) {
+        auto response = responseBuffer.tryGet(request);
+        BOOST_REQUIRE(response);
+        BOOST_CHECK_EQUAL(response->get_request_id(), request.id);
+        /* a response must be returned only once */
+        BOOST_CHECK(!responseBuffer.tryGet(request));
+    }
+}
+
+BOOST_AUTO_TEST_CASE( DiscardExpiredResponse )
+{
+    dclasio::comm::ResponseBuffer responseBuffer;
+    dclasio::message::DeleteKernel expired;
+    dclasio::message::DeleteKernel request;
+
+    BOOST_CHECK(!responseBuffer.get(expired, std::chrono::milliseconds(1)));
+
+    /* late response must be discarded, other responses must be kept */
+    responseBuffer.put(createResponse(expired));
+    responseBuffer.put(createResponse(request));
+    BOOST_CHECK(!responseBuffer.tryGet(expired));
+
+    auto response = responseBuffer.tryGet(request);
+    BOOST_REQUIRE(response);
+    BOOST_CHECK_EQUAL(response->get_request_id(), request.id);
+}
+
+BOOST_AUTO_TEST_CASE( ConcurrentWaiters )
+{
+    dclasio::comm::ResponseBuffer responseBuffer;
+    std::vector<dclasio::message::DeleteKernel> requests(16);
+    std::vector<dclasio::message::Request::id_type> responseIds(requests.size());
+    std::vector<std::thread> waiters;
+
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        waiters.push_back(std::thread([&, i] {
+            auto response = responseBuffer.get(requests[i]);
+            if (response) responseIds[i] = response->get_request_id();
+        }));
+    }
+
+    /* complete requests in reverse order */
+    for (auto request = requests.rbegin(); request != requests.rend(); ++request) {
+        responseBuffer.put(createResponse(*request));
+    }
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        BOOST_CHECK_EQUAL(responseIds[i], requests[i].id);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( DispatchResponses )
+{
+    /* Timings are only reported, as they depend on the machine's load */
+    for (std::size_t inFlight : { 16, 256, 4096, 16384 }) {
+        double time = dispatchTime(inFlight);
+        BOOST_TEST_MESSAGE(inFlight << " requests in flight: " << time << " ns/response");
+    }
+}
@@ -0,0 +1,191 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file Serialization.cpp
+ *
+ * Message serialization benchmark
+ *
+ * Measures pack and unpack throughput of messages with copying and with
+ * zero-copy (scatter/gather) serialization.
+ *
+ * \date 2026-10-15
+ * \author dmanam
+ */
+
+#include <dclasio/message/CreateKernelsInProgram.h>
+#include <dclasio/message/EnqueueNDRangeKernel.h>
+#include <dclasio/message/FlushRequest.h>
+#include <dclasio/message/Message.h>
+#include <dclasio/message/SetKernelArg.h>
+
+#include <dcl/ByteBuffer.h>
+#include <dcl/DCLTypes.h>
+
+#define BOOST_TEST_MODULE Serialization
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+
+const unsigned int NUM_ITERATIONS = 2000;
+const dcl::ByteBuffer::size_type GATHER_THRESHOLD = 256;
+
+/*!
+ * \brief Copies the segments of a buffer into contiguous memory, as a socket would do
+ */
+std::vector<char> gather(const dcl::ByteBuffer& buf) {
+    std::vector<dcl::ByteBuffer::segment_type> segments;
+    std::vector<char> bytes;
+
+    buf.segments(segments);
+    bytes.reserve(buf.size());
+    for (const auto& segment : segments) {
+        bytes.insert(std::end(bytes), segment.first, segment.first + segment.second);
+    }
+
+    return bytes;
+}
+
+/*!
+ * \brief Measures pack and unpack throughput of a message
+ *
+ * \param[in]  name     name of the message type
+ * \param[in]  message  the message to pack
+ * \param[in]  zeroCopy \c true, if large message fields should not be copied
+ * \return the number of bytes packed per second
+ */
+template<typename T>
+double packThroughput(const std::string& name, const T& message, bool zeroCopy) {
+    dcl::ByteBuffer::size_type size = 0;
+    std::vector<dcl::ByteBuffer::segment_type> segments;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < NUM_ITERATIONS; ++i) {
+        dcl::ByteBuffer buf;
+        if (zeroCopy) buf.set_gather_threshold(GATHER_THRESHOLD);
+        message.pack(buf);
+        buf.segments(segments); // obtain content as a socket write would do
+        size = buf.size();
+    }
+    std::chrono::duration<double> packTime = std::chrono::steady_clock::now() - start;
+
+    /* unpack from contiguous memory, as the message would be received */
+    dcl::ByteBuffer buf;
+    if (zeroCopy) buf.set_gather_threshold(GATHER_THRESHOLD);
+    message.pack(buf);
+    std::vector<char> bytes(gather(buf));
+    BOOST_REQUIRE_EQUAL(bytes.size(), size);
+
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < NUM_ITERATIONS; ++i) {
+        dcl::ByteBuffer in(dcl::ByteBuffer::view(bytes.size(), bytes.data()));
+        T copy;
+        copy.unpack(in);
+        BOOST_REQUIRE_EQUAL(in.size(), 0); // message must have been read completely
+    }
+    std::chrono::duration<double> unpackTime = std::chrono::steady_clock::now() - start;
+
+    double packRate = (double(size) * NUM_ITERATIONS) / packTime.count();
+    double unpackRate = (double(size) * NUM_ITERATIONS) / unpackTime.count();
+    BOOST_TEST_MESSAGE(name << " (" << size << " bytes, "
+            << (zeroCopy ? "zero-copy" : "copy") << "): pack "
+            << packRate / (1024 * 1024) << " MiB/s, unpack "
+            << unpackRate / (1024 * 1024) << " MiB/s");
+
+    return packRate;
+}
+
+template<typename T>
+void benchmark(const std::string& name, const T& message) {
+    packThroughput(name, message, false);
+    packThroughput(name, message, true);
+}
+
+} /* unnamed namespace */
+
+BOOST_AUTO_TEST_CASE( ZeroCopyPack )
+{
+    std::vector<char> value(1024 * 1024, 'x');
+    dclasio::message::SetKernelArgBinary request(1, 0, value.size(), value.data());
+    dcl::ByteBuffer buf;
+
+    buf.set_gather_threshold(GATHER_THRESHOLD);
+    request.pack(buf);
+
+    /* the argument value must be referenced rather than copied */
+    std::vector<dcl::ByteBuffer::segment_type> segments;
+    buf.segments(segments);
+    bool referenced = false;
+    for (const auto& segment : segments) {
+        if (segment.second == value.size()) referenced = true;
+    }
+    BOOST_CHECK(referenced);
+    BOOST_CHECK_GT(buf.size(), value.size());
+
+    /* messages larger than the former 64 KiB limit must survive a round trip */
+    std::vector<char> bytes(gather(buf));
+    dcl::ByteBuffer in(dcl::ByteBuffer::view(bytes.size(), bytes.data()));
+    dclasio::message::SetKernelArgBinary copy;
+    copy.unpack(in);
+    BOOST_REQUIRE_EQUAL(copy.argSize(), value.size());
+    BOOST_CHECK(std::memcmp(copy.argValue(), value.data(), value.size()) == 0);
+}
+
+BOOST_AUTO_TEST_CASE( PackUnpackThroughput )
+{
+    std::vector<dcl::object_id> ids(65536);
+    for (std::size_t i = 0; i < ids.size(); ++i) ids[i] = i;
+    std::vector<char> value(4096, 'x');
+    std::vector<dcl::object_id> eventIds(16, 1);
+
+    benchmark("FlushRequest",
+            dclasio::message::FlushRequest(1));
+    benchmark("EnqueueNDRangeKernel",
+            dclasio::message::EnqueueNDRangeKernel(1, 2, 3,
+                    std::vector<size_t>(), std::vector<size_t>(3, 1024),
+                    std::vector<size_t>(3, 16), &eventIds, true));
+    benchmark("SetKernelArgBinary",
+            dclasio::message::SetKernelArgBinary(1, 0, value.size(), value.data()));
+    benchmark("CreateKernelsInProgram",
+            dclasio::message::CreateKernelsInProgram(1, ids));
+}
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file Trace.cpp
+ *
+ * Trace buffer and trace file test
+ *
+ * Checks that trace buffers retain the most recent spans and that spans are
+ * written in the Chrome trace event format.
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include <dcl/util/Trace.h>
+
+#define BOOST_TEST_MODULE Trace
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE( RecordSpans )
+{
+    dcl::util::TraceBuffer buffer(8, 3);
+    std::vector<dcl::util::TraceRecord> records;
+
+    buffer.record("Span", "test", 100, 250, 42);
+    buffer.copy(records);
+
+    BOOST_REQUIRE_EQUAL(records.size(), 1);
+    BOOST_CHECK_EQUAL(records[0].name, "Span");
+    BOOST_CHECK_EQUAL(records[0].category, "test");
+    BOOST_CHECK_EQUAL(records[0].thread, 3);
+    BOOST_CHECK_EQUAL(records[0].start, 100);
+    BOOST_CHECK_EQUAL(records[0].end, 250);
+    BOOST_CHECK_EQUAL(records[0].arg, 42);
+}
+
+BOOST_AUTO_TEST_CASE( OverwriteOldestSpans )
+{
+    const size_t CAPACITY = 8;
+    dcl::util::TraceBuffer buffer(CAPACITY, 1);
+    std::vector<dcl::util::TraceRecord> records;
+
+    for (cl_ulong i = 0; i < 3 * CAPACITY; ++i) {
+        buffer.record("Span", "test", i, i + 1, i);
+    }
+    buffer.copy(records);
+
+    /* The slot of the next span is considered to be in use */
+    BOOST_REQUIRE_EQUAL(records.size(), CAPACITY - 1);
+    for (size_t i = 0; i < records.size(); ++i) {
+        BOOST_CHECK_EQUAL(records[i].arg, 2 * CAPACITY + 1 + i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( WriteTrace )
+{
+    std::ostringstream out;
+    std::vector<dcl::util::TraceRecord> records(1);
+
+    records[0].name = "Request";
+    records[0].category = "request";
+    records[0].thread = 2;
+    records[0].start = 1500;
+    records[0].end = 4000;
+    records[0].arg = 7;
+
+    {
+        dcl::util::TraceWriter writer(out);
+        writer.write(1, "node\"1\"", records);
+    }
+
+    std::string trace = out.str();
+    BOOST_CHECK_EQUAL(trace.find("{\"traceEvents\":["), 0);
+    BOOST_CHECK(trace.find("\"args\":{\"name\":\"node\\\"1\\\"\"}") != std::string::npos);
+    BOOST_CHECK(trace.find("\"name\":\"Request\",\"cat\":\"request\",\"ph\":\"X\","
+            "\"ts\":1.500,\"dur\":2.500,\"pid\":1,\"tid\":2,\"args\":{\"arg\":7}")
+            != std::string::npos);
+    BOOST_CHECK(trace.rfind("]") != std::string::npos);
+}
@@ -0,0 +1,241 @@
+/******************************************************************************
+ * This file is part of dOpenCL.
+ * 
+ * dOpenCL is an implementation of the OpenCL application programming
+ * interface for distributed systems. See <http://dopencl.uni-muenster.de/>
+ * for more information.
+ * 
+ * Developed by: Research Group Parallel and Distributed Systems
+ *               Department of Mathematics and Computer Science
+ *               University of Muenster, Germany
+ *               <http://pvs.uni-muenster.de/>
+ * 
+ * Copyright (C) 2026  dmanam <https://github.com/dmanam>
+ *
+ * dOpenCL is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * dOpenCL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with dOpenCL. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * Permission to use dOpenCL for scientific, non-commercial work is
+ * granted under the terms of the dOpenCL Academic License provided
+ * appropriate credit is given. See the dOpenCL Academic License for
+ * more details.
+ * 
+ * You should have received a copy of the dOpenCL Academic License
+ * along with dOpenCL. If not, see <http://dopencl.uni-muenster.de/>.
+ ******************************************************************************/
+
+/*!
+ * \file WriteBuffers.cpp
+ *
+ * Multicast upload benchmark
+ *
+ * Compares uploading host memory to a buffer on every compute node using
+ * clEnqueueWriteBuffersWWU, which reads and sends the host memory once, with
+ * separate clEnqueueWriteBuffer calls for every buffer.
+ *
+ * \date 2026-10-16
+ * \author dmanam
+ */
+
+#include "utility.h"
+
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#include <OpenCL/cl_wwu_collective.h>
+#include <OpenCL/cl_wwu_dcl.h>
+#else
+#include <CL/cl.h>
+#include <CL/cl_wwu_collective.h>
+#include <CL/cl_wwu_dcl.h>
+#endif
+
+#define BOOST_TEST_MODULE WriteBuffers
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+const unsigned int NUM_ITERATIONS = 10;
+
+struct MultiNodeContext {
+    MultiNodeContext() :
+            vecSize(16 * 1024 * 1024) /* #vector elements */,
+            cb(vecSize * sizeof(cl_int)) /* buffer size */
+    {
+        cl_platform_id platform = dcltest::getPlatform();
+        cl_uint num_nodes = 0;
+
+        cl_int err = clGetComputeNodesWWU(platform, 0, nullptr, &num_nodes);
+        BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+        BOOST_REQUIRE_GE(num_nodes, 1);
+
+        std::vector<cl_compute_node_WWU> nodes(num_nodes);
+        dcltest::getComputeNodes(platform, num_nodes, nodes.data());
+        for (auto node : nodes) {
+            devices.push_back(dcltest::getDevice(node));
+        }
+
+        context = dcltest::createContext(devices.size(), devices.data());
+        for (auto device : devices) {
+            commandQueues.push_back(dcltest::createCommandQueue(context, device));
+            buffers.push_back(dcltest::createRWBuffer(context, cb));
+        }
+
+        BOOST_TEST_MESSAGE("Set up fixture with " << num_nodes << " compute node(s)");
+    }
+
+    ~MultiNodeContext() {
+        // clean up
+        for (auto buffer : buffers) clReleaseMemObject(buffer);
+        for (auto commandQueue : commandQueues) clReleaseCommandQueue(commandQueue);
+        clReleaseContext(context);
+
+        BOOST_TEST_MESSAGE("Teared down fixture");
+    }
+
+    void finish() {
+        for (auto commandQueue : commandQueues) {
+            cl_int err = clFinish(commandQueue);
+            BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+        }
+    }
+
+    std::vector<cl_device_id> devices;
+    std::vector<cl_command_queue> commandQueues;
+    std::vector<cl_mem> buffers;
+    cl_context context;
+    size_t vecSize;
+    size_t cb;
+};
+
+} // anonymous namespace
+
+/* ****************************************************************************/
+
+BOOST_FIXTURE_TEST_SUITE( WriteBuffers, MultiNodeContext )
+
+/* ****************************************************************************
+ * Test cases
+ ******************************************************************************/
+
+BOOST_AUTO_TEST_CASE( WriteBuffers )
+{
+    std::vector<cl_int> vec1(vecSize), vec2(vecSize);
+    cl_int err = CL_SUCCESS;
+
+    dcltest::fillVector(vec1, 1, 1); // initialize input data
+
+    err = clEnqueueWriteBuffersWWU(
+            commandQueues.data(), buffers.size(), buffers.data(), nullptr,
+            cb, vec1.data(),
+            0, nullptr, nullptr);
+    BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+
+    // download every buffer and compare it with the input data
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        std::fill(std::begin(vec2), std::end(vec2), 0);
+        err = clEnqueueReadBuffer(
+                commandQueues[i],
+                buffers[i],
+                CL_TRUE,
+                0, cb, vec2.data(),
+                0, nullptr, nullptr);
+        BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+
+        BOOST_CHECK_MESSAGE(vec1 == vec2, "Input and output buffers differ");
+    }
+}
+
+BOOST_AUTO_TEST_CASE( WaitForUpload )
+{
+    std::vector<cl_int> vec1(vecSize), vec2(vecSize, 0);
+    cl_event upload;
+    cl_int err = CL_SUCCESS;
+
+    dcltest::fillVector(vec1, 1, 1); // initialize input data
+
+    /* the reading command queue is a different one than the buffer's, and
+     * uses the last compute node's device */
+    cl_command_queue commandQueue = dcltest::createCommandQueue(context, devices.back());
+
+    err = clEnqueueWriteBuffersWWU(
+            commandQueues.data(), buffers.size(), buffers.data(), nullptr,
+            cb, vec1.data(),
+            0, nullptr, &upload);
+    BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+
+    // the read waits for the upload and acquires the uploaded data
+    err = clEnqueueReadBuffer(
+            commandQueue,
+            buffers.front(),
+            CL_TRUE,
+            0, cb, vec2.data(),
+            1, &upload, nullptr);
+    BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+
+    BOOST_CHECK_MESSAGE(vec1 == vec2, "Input and output buffers differ");
+
+    clReleaseEvent(upload);
+    clReleaseCommandQueue(commandQueue);
+}
+
+BOOST_AUTO_TEST_CASE( UploadThroughput )
+{
+    std::vector<cl_int> vec(vecSize);
+    cl_int err = CL_SUCCESS;
+
+    dcltest::fillVector(vec, 1, 1); // initialize input data
+
+    /* separate uploads: the host memory is sent once per buffer */
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < NUM_ITERATIONS; ++i) {
+        for (size_t j = 0; j < buffers.size(); ++j) {
+            err = clEnqueueWriteBuffer(
+                    commandQueues[j],
+                    buffers[j],
+                    CL_FALSE,
+                    0, cb, vec.data(),
+                    0, nullptr, nullptr);
+            BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+        }
+        finish();
+    }
+    std::chrono::duration<double> separateTime = std::chrono::steady_clock::now() - start;
+
+    /* multicast upload: the host memory is sent once and forwarded */
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < NUM_ITERATIONS; ++i) {
+        err = clEnqueueWriteBuffersWWU(
+                commandQueues.data(), buffers.size(), buffers.data(), nullptr,
+                cb, vec.data(),
+                0, nullptr, nullptr);
+        BOOST_REQUIRE_EQUAL(err, CL_SUCCESS);
+        finish();
+    }
+    std::chrono::duration<double> multicastTime = std::chrono::steady_clock::now() - start;
+
+    /* throughput in bytes written to buffers per second */
+    double bytes = double(cb) * buffers.size() * NUM_ITERATIONS;
+    BOOST_TEST_MESSAGE("Upload of " << cb << " bytes to " << buffers.size()
+            << " buffer(s): clEnqueueWriteBuffer "
+            << bytes / separateTime.count() / (1024 * 1024) << " MiB/s, "
+            << "clEnqueueWriteBuffersWWU "
+            << bytes / multicastTime.count() / (1024 * 1024) << " MiB/s");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // WriteBuffers test suite